@@ -1,6 +1,7 @@
 #include "hwbp_core.h"
 #include "hwbp_core_regs.h"
 #include "hwbp_core_types.h"
+#include "hwbp_core_com.h"
 
 #include "app.h"
 #include "app_funcs.h"
@@ -16,8 +17,7 @@ extern AppRegs app_regs;
 extern uint8_t app_regs_type[];
 extern uint16_t app_regs_n_elements[];
 extern uint8_t *app_regs_pointer[];
-extern void (*app_func_rd_pointer[])(void);
-extern bool (*app_func_wr_pointer[])(void*);
+extern const __flash app_reg_handlers_t app_reg_handlers[];
 
 /************************************************************************/
 /* Initialize app                                                       */
@@ -30,7 +30,7 @@ void hwbp_app_initialize(void)
     uint8_t hwH = 1;
     uint8_t hwL = 0;
     uint8_t fwH = 1;
-    uint8_t fwL = 3;
+    uint8_t fwL = 4;
     uint8_t ass = 0;
     
    	/* Start core */
@@ -62,10 +62,499 @@ void core_callback_catastrophic_error_detected(void)
 /************************************************************************/
 /* Add your functions here or load external functions if needed */
 
+/* TCC0 runs at 4 MHz (32 MHz / 8), so each microsecond is 4 counts */
+/* The CCA and CCB waveform outputs drive CONVSTA (PC0) and CONVSTB (PC1) directly */
+/* Both outputs go high on each timer update and low when the count reaches the compare value */
+#define SAMPLING_TIMER_COUNTS_PER_US 4
+#define CONVST_PULSE_COUNTS 4
+
+/* Bursts, started by the ADC readout and DI0 interrupts */
+extern volatile uint8_t burst_state;
+
+void update_sampling_timer(void)
+{
+	if (app_regs.REG_START &&
+		app_regs.REG_SAMPLE_FREQUENCY == GM_SAMPLING_PERIOD &&
+		app_regs.REG_DI0_CONF != GM_DI0_RISE_CATCH_SAMPLE)
+	{
+		uint16_t period = app_regs.REG_SAMPLING_PERIOD * SAMPLING_TIMER_COUNTS_PER_US - 1;
+		
+		/* The overflow interrupt is only needed to set the trigger output */
+		TCC0_INTCTRLA = (app_regs.REG_TRIGGER_DESTINY != GM_TRIG_TO_NONE) ? TC_OVFINTLVL_LO_gc : TC_OVFINTLVL_OFF_gc;
+		
+		if (TCC0_CTRLA == TC_CLKSEL_OFF_gc)
+		{
+			TCC0_PER = period;
+			TCC0_CCA = CONVST_PULSE_COUNTS;
+			TCC0_CCB = CONVST_PULSE_COUNTS;
+			TCC0_CTRLB = TC0_CCAEN_bm | TC0_CCBEN_bm | TC_WGMODE_SS_gc;
+			TCC0_CTRLFSET = TC_CMD_RESTART_gc;
+			TCC0_CTRLA = TC_CLKSEL_DIV8_gc;
+		}
+		else
+		{
+			/* Already running, so the new period starts on the next update without glitches */
+			TCC0_PERBUF = period;
+		}
+	}
+	else
+	{
+		/* Stop the timer and give CONVSTA and CONVSTB back to the port */
+		TCC0_CTRLA = TC_CLKSEL_OFF_gc;
+		TCC0_INTCTRLA = TC_OVFINTLVL_OFF_gc;
+		TCC0_CTRLB = 0;
+	}
+	
+	/* A burst being acquired is stopped by the readout interrupt and one being uploaded is still sent */
+	if (app_regs.REG_START && app_regs.REG_SAMPLE_FREQUENCY == GM_BURST)
+	{
+		if (burst_state == BURST_IDLE)
+		{
+			burst_state = BURST_ARMED;
+			burst_trigger(GM_BURST_IMMEDIATE);
+		}
+	}
+	else if (burst_state == BURST_ARMED)
+	{
+		burst_state = BURST_IDLE;
+	}
+}
+
+/* Maximum and minimum conversion times (us) of the AD7606 for each oversampling ratio, from 1x to 64x */
+static const uint16_t conversion_time_us[] = {5, 10, 20, 40, 80, 160, 320};
+static const uint16_t conversion_min_time_us[] = {3, 7, 16, 33, 66, 133, 257};
+
+/* SPI readout of the 4 channels at 4 MHz plus the interrupts' latency */
+#define ADC_READOUT_US 25
+
+/* Latency of the BUSY interrupt until CONVSTA and CONVSTB are low again */
+#define ADC_BUSY_HANDLING_US 10
+
+uint8_t conversion_fits_period(uint8_t oversampling_ratio, uint8_t sample_frequency, uint16_t sampling_period, uint8_t acquisition_mode)
+{
+	uint16_t period_us;
+	
+	/* Each conversion of a burst starts when the previous one is read, so any ratio fits */
+	if (sample_frequency == GM_BURST)
+		return true;
+	
+	switch (sample_frequency)
+	{
+		case GM_1KHZ: period_us = 1000; break;
+		case GM_2KHZ: period_us = 500; break;
+		default: period_us = sampling_period; break;
+	}
+	
+	if (acquisition_mode == GM_ACQUISITION_PIPELINED)
+	{
+		/* The readout must end before the conversion it overlaps with updates the ADC's output registers */
+		if (ADC_READOUT_US > conversion_min_time_us[oversampling_ratio])
+			return false;
+		
+		return conversion_time_us[oversampling_ratio] + ADC_BUSY_HANDLING_US <= period_us;
+	}
+	
+	return conversion_time_us[oversampling_ratio] + ADC_READOUT_US <= period_us;
+}
+
+/* Set on the BUSY interrupt */
+extern bool adc_pipelined;
+extern volatile bool adc_result_pending;
+
+void update_acquisition_mode(void)
+{
+	/* A caught sample may not be followed by another conversion, so it is always read right away */
+	/* The same for bursts, where the next conversion is only started after the readout */
+	adc_pipelined = app_regs.REG_ACQUISITION_MODE == GM_ACQUISITION_PIPELINED &&
+		app_regs.REG_DI0_CONF != GM_DI0_RISE_CATCH_SAMPLE &&
+		app_regs.REG_SAMPLE_FREQUENCY != GM_BURST;
+	adc_result_pending = false;
+	
+	/* In pipelined mode the rising edge of BUSY, the start of the next conversion, starts the readout */
+	PORTD.PIN1CTRL = (PORTD.PIN1CTRL & ~PORT_ISC_gm) | (adc_pipelined ? PORT_ISC_BOTHEDGES_gc : PORT_ISC_FALLING_gc);
+}
+
+/* Samples are filled by the ADC readout interrupt and drained here */
+extern sample_t sample_ring[];
+extern volatile uint8_t sample_ring_head;
+extern volatile uint8_t sample_ring_tail;
+
+/* The same for the changes of the outputs made by the thresholds */
+extern do_event_t do_event_ring[];
+extern volatile uint8_t do_event_ring_head;
+extern volatile uint8_t do_event_ring_tail;
+
+uint8_t enabled_channels_count(uint8_t enabled_channels)
+{
+	uint8_t count = 0;
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (enabled_channels & (1 << i))
+			count++;
+	}
+	
+	return count;
+}
+
+/* Samples are accumulated here and sent as a single ANALOG_INPUTS event with REG_BATCH_SIZE samples */
+/* Each sample only has the channels enabled on REG_ENABLED_CHANNELS */
+/* The event carries the timestamp of the first sample of the batch */
+int16_t analog_batch[ANALOG_BATCH_MAX_VALUES];
+uint8_t analog_batch_count = 0;
+uint8_t analog_batch_size;
+uint8_t analog_batch_channels;
+uint8_t analog_batch_values;
+uint32_t analog_batch_seconds;
+uint16_t analog_batch_micros;
+volatile bool analog_batch_reset = false;
+
+/* With GM_ENCODING_DELTA the batch is encoded as its samples are added and sent on ANALOG_DELTA */
+/* The payload is the enabled channels, the I16 values of the first sample, and then one byte per value */
+/* with the zig-zag encoded difference to the previous value of the channel, or ANALOG_DELTA_ESCAPE and the I16 value */
+/* Each event starts with its own keyframe, so it is decoded without the previous ones */
+bool analog_batch_delta;
+uint8_t analog_delta[ANALOG_DELTA_MAX_BYTES];
+uint8_t analog_delta_bytes;
+int16_t analog_delta_previous[4];
+
+/* Capture windows, filled by the ADC readout interrupt */
+extern sample_t capture_history[];
+extern uint8_t capture_pre_first;
+extern volatile uint8_t capture_pre_count;
+extern volatile uint8_t capture_state;
+extern volatile bool capture_reset;
+
+/* Bursts, filled by the ADC readout interrupt */
+/* The events of a burst carry as many samples as fit on ANALOG_INPUTS, without the delta encoding */
+extern int16_t *const burst_values;
+extern uint8_t burst_channels;
+extern uint16_t burst_samples;
+extern uint32_t burst_seconds;
+extern uint16_t burst_micros;
+extern uint32_t burst_elapsed;
+uint16_t burst_sent = 0;
+volatile bool burst_reset = false;
+
+/* Speed Mode, set and cleared by the core's callbacks */
+/* REG_ENABLED_CHANNELS can't be written meanwhile, so every frame has the same length */
+volatile bool speed_mode = false;
+bool speed_started;
+uint8_t speed_sequence;
+
+/* Called before REG_START goes from ZERO to ONE */
+extern bool previous_capture_valid;
+extern volatile bool decimation_reset;
+
+void prepare_acquisition(void)
+{
+	/* Don't measure the interval from the last conversion of the previous acquisition */
+	previous_capture_valid = false;
+	
+	/* Start a new decimation window */
+	decimation_reset = true;
+	
+	/* Drop the partial batch left from the previous acquisition */
+	analog_batch_reset = true;
+	
+	/* Don't read the last conversion of the previous acquisition */
+	adc_result_pending = false;
+	
+	/* Drop the window left from the previous acquisition and wait for a new trigger */
+	capture_pre_count = 0;
+	capture_reset = true;
+	capture_state = CAPTURE_ARMED;
+	
+	/* Drop the burst left from the previous acquisition, update_sampling_timer() arms a new one */
+	burst_reset = true;
+	burst_state = BURST_IDLE;
+}
+
+static void send_stamped_event(uint8_t add, void *values, uint8_t n_elements, uint32_t seconds, uint16_t micros)
+{
+	/* The low and medium level interrupts also use the user timestamp and send events */
+	/* Hold them while sending, but keep the high level ones so the UART is still serviced */
+	PMIC_CTRL &= ~(PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm);
+	
+	/* The core sends the register through these tables, so they are pointed to the values */
+	/* and put back once the event is sent, so a read of the register still returns the last sample */
+	uint8_t *register_pointer = app_regs_pointer[add - APP_REGS_ADD_MIN];
+	uint16_t register_n_elements = app_regs_n_elements[add - APP_REGS_ADD_MIN];
+	
+	app_regs_pointer[add - APP_REGS_ADD_MIN] = (uint8_t*)(values);
+	app_regs_n_elements[add - APP_REGS_ADD_MIN] = n_elements;
+	
+	core_func_update_user_timestamp(seconds, micros);
+	core_func_send_event(add, false);
+	
+	app_regs_pointer[add - APP_REGS_ADD_MIN] = register_pointer;
+	app_regs_n_elements[add - APP_REGS_ADD_MIN] = register_n_elements;
+	
+	PMIC_CTRL |= PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm;
+}
+
+static void send_batch(void)
+{
+	analog_batch_count = 0;
+	
+	if (analog_batch_delta)
+		send_stamped_event(ADD_REG_ANALOG_DELTA, analog_delta, analog_delta_bytes, analog_batch_seconds, analog_batch_micros);
+	else
+		send_stamped_event(ADD_REG_ANALOG_INPUTS, analog_batch, analog_batch_values, analog_batch_seconds, analog_batch_micros);
+}
+
+static void send_speed_frame(const int16_t *values, uint8_t n_values)
+{
+	uint8_t frame[SPEED_FRAME_MAX_BYTES];
+	uint8_t *byte = frame;
+	
+	*byte++ = SPEED_FRAME_SYNC;
+	*byte++ = speed_sequence++;
+	
+	for (uint8_t i = 0; i < n_values; i++)
+	{
+		*byte++ = (uint8_t)values[i];
+		*byte++ = (uint8_t)((uint16_t)values[i] >> 8);
+	}
+	
+	uint8_t checksum = 0;
+	for (uint8_t *b = frame; b < byte; b++)
+		checksum += *b;
+	*byte++ = checksum;
+	
+	/* Held as in send_stamped_event, so the interrupts don't write to the UART in the middle of the frame */
+	PMIC_CTRL &= ~(PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm);
+	hwbp_uart_xmit(frame, byte - frame);
+	PMIC_CTRL |= PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm;
+}
+
+static void add_speed_frame(sample_t *sample)
+{
+	int16_t values[4];
+	uint8_t n_values = 0;
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (app_regs.REG_ENABLED_CHANNELS & (1 << i))
+			values[n_values++] = sample->analog[i];
+	}
+	
+	send_speed_frame(values, n_values);
+}
+
+/* Sends the next event of a burst, and re-arms when the last one is sent */
+/* On Speed Mode the same samples are sent as frames, without the interval */
+static void send_burst(void)
+{
+	uint8_t channels = enabled_channels_count(burst_channels);
+	
+	if (burst_sent == 0 && !speed_mode)
+	{
+		/* Marks the burst on the stream with its mean interval, the samples follow */
+		app_regs.REG_BURST_INTERVAL = (burst_samples > 1) ? (burst_elapsed + (burst_samples - 1) / 2) / (burst_samples - 1) : 0;
+		
+		PMIC_CTRL &= ~(PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm);
+		core_func_update_user_timestamp(burst_seconds, burst_micros);
+		core_func_send_event(ADD_REG_BURST_INTERVAL, false);
+		PMIC_CTRL |= PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm;
+	}
+	
+	uint16_t n = ANALOG_BATCH_MAX_VALUES / channels;
+	if (n > burst_samples - burst_sent)
+		n = burst_samples - burst_sent;
+	
+	/* Each event is stamped with its first sample, placed from the start of the burst and the mean interval */
+	uint32_t ticks = burst_micros + ((uint32_t)burst_sent * app_regs.REG_BURST_INTERVAL + CAPTURE_TIMER_COUNTS_PER_HARP_TICK / 2) / CAPTURE_TIMER_COUNTS_PER_HARP_TICK;
+	
+	if (speed_mode)
+	{
+		for (uint16_t i = 0; i < n; i++)
+			send_speed_frame(&burst_values[(burst_sent + i) * channels], channels);
+	}
+	else
+	{
+		send_stamped_event(ADD_REG_ANALOG_INPUTS, &burst_values[burst_sent * channels], n * channels, burst_seconds + ticks / 31250, ticks % 31250);
+	}
+	
+	burst_sent += n;
+	
+	if (burst_sent == burst_samples)
+	{
+		burst_sent = 0;
+		
+		if (app_regs.REG_START)
+		{
+			burst_state = BURST_ARMED;
+			burst_trigger(GM_BURST_IMMEDIATE);
+		}
+		else
+		{
+			burst_state = BURST_IDLE;
+		}
+	}
+}
+
+/* Each call adds a sample to the delta encoded batch, with the keyframe on the first one */
+static void add_delta(sample_t *sample)
+{
+	uint8_t *byte = &analog_delta[analog_delta_bytes];
+	
+	if (analog_batch_count == 0)
+		*byte++ = analog_batch_channels;
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (!(analog_batch_channels & (1 << i)))
+			continue;
+		
+		int16_t value = sample->analog[i];
+		int16_t delta = value - analog_delta_previous[i];
+		uint16_t zigzag = ((uint16_t)delta << 1) ^ (uint16_t)(delta >> 15);
+		analog_delta_previous[i] = value;
+		
+		if (analog_batch_count && zigzag < ANALOG_DELTA_ESCAPE)
+		{
+			*byte++ = zigzag;
+		}
+		else
+		{
+			/* The keyframe has no escape */
+			if (analog_batch_count)
+				*byte++ = ANALOG_DELTA_ESCAPE;
+			
+			*byte++ = (uint8_t)value;
+			*byte++ = (uint8_t)((uint16_t)value >> 8);
+		}
+	}
+	
+	analog_delta_bytes = byte - analog_delta;
+	
+	/* Sent early when the next sample might not fit, with 3 bytes for each of its values */
+	if (++analog_batch_count == analog_batch_size || analog_delta_bytes > ANALOG_DELTA_MAX_BYTES - 3 * 4)
+		send_batch();
+}
+
+static void add_to_batch(sample_t *sample)
+{
+	if (analog_batch_count == 0)
+	{
+		analog_batch_size = app_regs.REG_BATCH_SIZE;
+		analog_batch_channels = app_regs.REG_ENABLED_CHANNELS;
+		analog_batch_values = 0;
+		analog_batch_seconds = sample->seconds;
+		analog_batch_micros = sample->micros;
+		analog_batch_delta = app_regs.REG_DATA_ENCODING == GM_ENCODING_DELTA;
+		analog_delta_bytes = 0;
+	}
+	
+	if (analog_batch_delta)
+	{
+		add_delta(sample);
+		return;
+	}
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (analog_batch_channels & (1 << i))
+			analog_batch[analog_batch_values++] = sample->analog[i];
+	}
+	
+	if (++analog_batch_count == analog_batch_size)
+		send_batch();
+}
+
+void send_acquired_samples(void)
+{
+	bool speed = speed_mode;
+	
+	if (analog_batch_reset)
+	{
+		analog_batch_reset = false;
+		analog_batch_count = 0;
+	}
+	
+	if (burst_reset)
+	{
+		burst_reset = false;
+		burst_sent = 0;
+	}
+	
+	/* The outputs changed by the thresholds, stamped with the conversion that crossed */
+	while (do_event_ring_tail != do_event_ring_head)
+	{
+		do_event_t *event = &do_event_ring[do_event_ring_tail];
+		send_stamped_event(ADD_REG_DO_WRITE, &event->value, 1, event->seconds, event->micros);
+		
+		__asm volatile("" ::: "memory");
+		do_event_ring_tail = (do_event_ring_tail + 1) & (DO_EVENT_RING_SIZE - 1);
+	}
+	
+	/* One event of a burst on each pass, the interrupt doesn't touch it until it is all sent */
+	if (burst_state == BURST_UPLOADING)
+	{
+		send_burst();
+		return;
+	}
+	
+	/* The samples from before the trigger go first, the interrupt doesn't touch them until the window is sent */
+	while (capture_pre_count)
+	{
+		if (speed)
+			add_speed_frame(&capture_history[capture_pre_first]);
+		else
+			add_to_batch(&capture_history[capture_pre_first]);
+		capture_pre_first = (capture_pre_first + 1) & (CAPTURE_HISTORY_SIZE - 1);
+		capture_pre_count--;
+	}
+	
+	/* Read before the ring, so the last sample of a window is already on it */
+	bool window_closed = app_regs.REG_CAPTURE_TRIGGER != GM_CAPTURE_OFF && capture_state == CAPTURE_SENDING;
+	
+	while (sample_ring_tail != sample_ring_head)
+	{
+		if (speed)
+			add_speed_frame(&sample_ring[sample_ring_tail]);
+		else
+			add_to_batch(&sample_ring[sample_ring_tail]);
+		
+		/* The slot is only given back to the interrupt after being copied */
+		__asm volatile("" ::: "memory");
+		sample_ring_tail = (sample_ring_tail + 1) & (SAMPLE_RING_SIZE - 1);
+	}
+	
+	if (window_closed)
+	{
+		/* The last samples of a window don't wait for a full batch */
+		if (analog_batch_count)
+			send_batch();
+		
+		/* The history is refilled from empty for the next window */
+		capture_reset = true;
+		capture_state = CAPTURE_ARMED;
+	}
+	
+	/* Stopping the acquisition ends Speed Mode, once its last samples are sent */
+	if (speed)
+	{
+		if (app_regs.REG_START)
+		{
+			speed_started = true;
+		}
+		else if (speed_started)
+		{
+			speed_mode = false;
+			core_func_leave_speed_mode_and_go_to_standby_mode();
+		}
+	}
+}
+
 /************************************************************************/
 /* Initialization Callbacks                                             */
 /************************************************************************/
 extern bool previous_DIO;
+extern uint8_t thresholds_low_written;
+extern uint8_t adc_dma_buffer[];
+extern uint8_t adc_dma_dummy;
 
 void core_callback_define_clock_default(void) {}
 
@@ -80,6 +569,43 @@ void core_callback_initialize_hardware(void)
 	/* Initialize SPI with 4MHz */
 	SPIC_CTRL = SPI_MASTER_bm | SPI_ENABLE_bm | SPI_MODE_0_gc | SPI_CLK2X_bm | SPI_PRESCALER_DIV16_gc;
 	
+	/* Initialize DMA to read the ADC */
+	/* CH0 moves each received byte from SPIC_DATA to adc_dma_buffer[] */
+	/* CH1 writes the dummy byte that clocks the next byte out of the ADC */
+	/* Accessing SPIC_DATA clears the SPIC request, so only CH0 is triggered by it and CH1 is paced by TCC1 */
+	DMA_CTRL = DMA_ENABLE_bm | DMA_PRIMODE_CH0123_gc;
+	
+	DMA_CH0_ADDRCTRL = DMA_CH_SRCRELOAD_NONE_gc | DMA_CH_SRCDIR_FIXED_gc | DMA_CH_DESTRELOAD_TRANSACTION_gc | DMA_CH_DESTDIR_INC_gc;
+	DMA_CH0_TRIGSRC = DMA_CH_TRIGSRC_SPIC_gc;
+	DMA_CH0_SRCADDR0 = (uint8_t)((uint16_t)(&SPIC_DATA) >> 0);
+	DMA_CH0_SRCADDR1 = (uint8_t)((uint16_t)(&SPIC_DATA) >> 8);
+	DMA_CH0_SRCADDR2 = 0;
+	DMA_CH0_DESTADDR0 = (uint8_t)((uint16_t)(adc_dma_buffer) >> 0);
+	DMA_CH0_DESTADDR1 = (uint8_t)((uint16_t)(adc_dma_buffer) >> 8);
+	DMA_CH0_DESTADDR2 = 0;
+	DMA_CH0_CTRLB = DMA_CH_TRNINTLVL_LO_gc;
+	
+	DMA_CH1_ADDRCTRL = DMA_CH_SRCRELOAD_NONE_gc | DMA_CH_SRCDIR_FIXED_gc | DMA_CH_DESTRELOAD_NONE_gc | DMA_CH_DESTDIR_FIXED_gc;
+	DMA_CH1_TRIGSRC = DMA_CH_TRIGSRC_TCC1_OVF_gc;
+	DMA_CH1_SRCADDR0 = (uint8_t)((uint16_t)(&adc_dma_dummy) >> 0);
+	DMA_CH1_SRCADDR1 = (uint8_t)((uint16_t)(&adc_dma_dummy) >> 8);
+	DMA_CH1_SRCADDR2 = 0;
+	DMA_CH1_DESTADDR0 = (uint8_t)((uint16_t)(&SPIC_DATA) >> 0);
+	DMA_CH1_DESTADDR1 = (uint8_t)((uint16_t)(&SPIC_DATA) >> 8);
+	DMA_CH1_DESTADDR2 = 0;
+	
+	/* TCC1 overflows once per byte while the ADC is read, it is started and stopped with the readout */
+	TCC1_PER = ADC_BYTE_PACING_CYCLES - 1;
+	
+	/* Initialize TCD0 as a free running timer at 4 MHz */
+	/* The rising edge of CONVSTA is routed through event channel 7 and captured on CCA */
+	PORTC_PIN0CTRL = (PORTC_PIN0CTRL & ~PORT_ISC_gm) | PORT_ISC_RISING_gc;
+	EVSYS_CH7MUX = EVSYS_CHMUX_PORTC_PIN0_gc;
+	TCD0_PER = 0xFFFF;
+	TCD0_CTRLB = TC0_CCAEN_bm | TC_WGMODE_NORMAL_gc;
+	TCD0_CTRLD = TC_EVACT_CAPT_gc | TC_EVSEL_CH7_gc;
+	TCD0_CTRLA = TC_CLKSEL_DIV8_gc;
+	
 	/* Reset ADC */
 	_delay_ms(100);
 	set_RESET;
@@ -104,6 +630,7 @@ void core_callback_reset_registers(void)
 	app_regs.REG_START = 0;
 	
 	app_regs.REG_RANGE_AND_INPUT_FILTER = GM_10V_1K5;
+	app_regs.REG_OVERSAMPLING_RATIO = GM_OS_64X;
 	app_regs.REG_SAMPLE_FREQUENCY = GM_1KHZ;
 	
 	app_regs.REG_DI0_CONF = GM_DI0_SYNC;
@@ -121,6 +648,11 @@ void core_callback_reset_registers(void)
 	app_regs.REG_DO1_TH_VALUE = 0;
 	app_regs.REG_DO2_TH_VALUE = 0;
 	app_regs.REG_DO3_TH_VALUE = 0;
+	app_regs.REG_DO0_TH_LOW_VALUE = 0;
+	app_regs.REG_DO1_TH_LOW_VALUE = 0;
+	app_regs.REG_DO2_TH_LOW_VALUE = 0;
+	app_regs.REG_DO3_TH_LOW_VALUE = 0;
+	thresholds_low_written = 0;
 	app_regs.REG_DO0_TH_UP_SAMPLES = 1;
 	app_regs.REG_DO1_TH_UP_SAMPLES = 1;
 	app_regs.REG_DO2_TH_UP_SAMPLES = 1;
@@ -129,6 +661,31 @@ void core_callback_reset_registers(void)
 	app_regs.REG_DO1_TH_DOWN_SAMPLES = 1;
 	app_regs.REG_DO2_TH_DOWN_SAMPLES = 1;
 	app_regs.REG_DO3_TH_DOWN_SAMPLES = 1;
+	
+	app_regs.REG_SAMPLING_PERIOD = 1000;
+	app_regs.REG_BATCH_SIZE = 1;
+	app_regs.REG_ENABLED_CHANNELS = B_CH0 | B_CH1 | B_CH2 | B_CH3;
+	
+	app_regs.REG_RING_OVERFLOWS = 0;
+	app_regs.REG_RING_HIGH_WATER = 0;
+	
+	app_regs.REG_CONVERSION_INTERVAL[0] = 0xFFFF;
+	app_regs.REG_CONVERSION_INTERVAL[1] = 0;
+	
+	app_regs.REG_DECIMATION_FACTOR = 1;
+	app_regs.REG_DECIMATION_FILTER = GM_DECIMATION_BOXCAR;
+	app_regs.REG_THRESHOLDS_SOURCE = GM_THRESHOLDS_RAW;
+	app_regs.REG_ACQUISITION_MODE = GM_ACQUISITION_SERIALIZED;
+	
+	app_regs.REG_CAPTURE_TRIGGER = GM_CAPTURE_OFF;
+	app_regs.REG_CAPTURE_PRE_SAMPLES = 64;
+	app_regs.REG_CAPTURE_POST_SAMPLES = 64;
+	
+	app_regs.REG_BURST_SAMPLES = 224;
+	app_regs.REG_BURST_TRIGGER = GM_BURST_IMMEDIATE;
+	app_regs.REG_BURST_INTERVAL = 0;
+	
+	app_regs.REG_DATA_ENCODING = GM_ENCODING_RAW;
 }
 
 void core_callback_registers_were_reinitialized(void)
@@ -136,16 +693,48 @@ void core_callback_registers_were_reinitialized(void)
 	/* Update registers if needed */
 	app_write_REG_DO_WRITE(&app_regs.REG_DO_WRITE);
 	
-	app_write_REG_RANGE_AND_INPUT_FILTER(&app_regs.REG_RANGE_AND_INPUT_FILTER);
+	/* Bursts reuse the capture history and start their own conversions, so they can't be restored with either */
+	if (app_regs.REG_SAMPLE_FREQUENCY == GM_BURST &&
+		(app_regs.REG_CAPTURE_TRIGGER != GM_CAPTURE_OFF || app_regs.REG_DI0_CONF == GM_DI0_RISE_CATCH_SAMPLE))
+	{
+		app_regs.REG_SAMPLE_FREQUENCY = GM_1KHZ;
+	}
+	
+	/* Fall back to serialized if the restored oversampling ratio can't be pipelined */
+	if (!app_write_REG_ACQUISITION_MODE(&app_regs.REG_ACQUISITION_MODE))
+	{
+		app_regs.REG_ACQUISITION_MODE = GM_ACQUISITION_SERIALIZED;
+		update_acquisition_mode();
+	}
+	
+	/* Fall back to the default range and oversampling if the restored ones are invalid or don't fit the sampling period */
+	if (!app_write_REG_RANGE_AND_INPUT_FILTER(&app_regs.REG_RANGE_AND_INPUT_FILTER))
+	{
+		uint8_t range = GM_10V_1K5;
+		
+		/* A period too short for the default oversampling goes back to the default sampling frequency */
+		if (!conversion_fits_period(range & MSK_OVERSAMPLING_RATIO, app_regs.REG_SAMPLE_FREQUENCY, app_regs.REG_SAMPLING_PERIOD, app_regs.REG_ACQUISITION_MODE))
+			app_regs.REG_SAMPLE_FREQUENCY = GM_1KHZ;
+		
+		app_write_REG_RANGE_AND_INPUT_FILTER(&range);
+	}
+	
+	update_sampling_timer();
 	
-//		app_regs.REG_DO0_CH = GM_ANA3;
-// 		app_regs.REG_DO1_CH = GM_ANA1;
- 		app_regs.REG_DO2_CH = GM_ANA3;
-// 		app_regs.REG_DO3_CH = GM_ANA3;
-		app_regs.REG_DO0_TH_VALUE = 5000;
-		app_regs.REG_DO1_TH_VALUE = 5000;
-		app_regs.REG_DO2_TH_VALUE = 5000;
-		app_regs.REG_DO3_TH_VALUE = 5000;
+	app_write_REG_ENABLED_CHANNELS(&app_regs.REG_ENABLED_CHANNELS);
+	
+	/* A restored low value that differs from its threshold was written, so it keeps its hysteresis */
+	int16_t *value = &app_regs.REG_DO0_TH_VALUE;
+	int16_t *low = &app_regs.REG_DO0_TH_LOW_VALUE;
+	
+	thresholds_low_written = 0;
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (low[i] != value[i])
+			thresholds_low_written |= (1 << i);
+	}
+	
+	update_thresholds();
 }
 
 /************************************************************************/
@@ -168,11 +757,23 @@ void core_callback_visualen_to_off(void)
 /************************************************************************/
 void core_callback_device_to_standby(void)
 {
+	speed_mode = false;
 	app_regs.REG_START = 0;
+	update_sampling_timer();
+}
+void core_callback_device_to_active(void)
+{
+	speed_mode = false;
 }
-void core_callback_device_to_active(void) {}
 void core_callback_device_to_enchanced_active(void) {}
-void core_callback_device_to_speed(void) {}
+void core_callback_device_to_speed(void)
+{
+	/* The samples of a partial batch are dropped, the stream starts with a new sequence */
+	analog_batch_reset = true;
+	speed_sequence = 0;
+	speed_started = false;
+	speed_mode = true;
+}
 
 /************************************************************************/
 /* Callbacks: 1 ms timer                                                */
@@ -216,7 +817,6 @@ void core_callback_t_500us(void)
 		{
 			if (app_regs.REG_SAMPLE_FREQUENCY == GM_2KHZ)
 			{
-				core_func_mark_user_timestamp();
 				set_CONVSTA;
 				set_CONVSTB;
 				switch (app_regs.REG_TRIGGER_DESTINY)
@@ -245,12 +845,12 @@ void core_callback_t_500us(void)
 }
 void core_callback_t_1ms(void)
 {
-	/* Read ADC */
-	if (app_regs.REG_DI0_CONF != GM_DI0_RISE_CATCH_SAMPLE)
+	/* Read ADC if 1KHz or 2Khz sample rate is selected */
+	/* With GM_SAMPLING_PERIOD the conversions are started by TCC0 and with GM_BURST by the readout */
+	if (app_regs.REG_DI0_CONF != GM_DI0_RISE_CATCH_SAMPLE && app_regs.REG_SAMPLE_FREQUENCY <= GM_2KHZ)
 	{
 		if (app_regs.REG_START)
 		{
-			core_func_mark_user_timestamp();		
 			set_CONVSTA;
 			set_CONVSTB;
 			switch (app_regs.REG_TRIGGER_DESTINY)
@@ -296,7 +896,9 @@ bool core_read_app_register(uint8_t add, uint8_t type)
 		return false;
 	
 	/* Receive data */
-	(*app_func_rd_pointer[add-APP_REGS_ADD_MIN])();	
+	void (*read)(void) = app_reg_handlers[add-APP_REGS_ADD_MIN].read;
+	if (read)
+		read();
 
 	/* Return success */
 	return true;
@@ -320,5 +922,11 @@ bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint1
 		return false;
 
 	/* Process data and return false if write is not allowed or contains errors */
-	return (*app_func_wr_pointer[add-APP_REGS_ADD_MIN])(content);
+	bool (*write)(void*) = app_reg_handlers[add-APP_REGS_ADD_MIN].write;
+	if (write)
+		return write(content);
+	
+	/* The reserved registers only keep the value */
+	memcpy(app_regs_pointer[add-APP_REGS_ADD_MIN], content, n_elements * (type & MSK_TYPE_LEN));
+	return true;
 }
\ No newline at end of file
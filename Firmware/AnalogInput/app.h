@@ -15,4 +15,119 @@
 void hwbp_app_initialize(void);
 
 
+/************************************************************************/
+/* User functions                                                       */
+/************************************************************************/
+/* Starts, updates or stops the timer that triggers the conversions when */
+/* REG_SAMPLE_FREQUENCY is GM_SAMPLING_PERIOD, or arms the bursts when    */
+/* it is GM_BURST                                                         */
+void update_sampling_timer(void);
+
+/* Checks if a conversion with the oversampling ratio plus the readout fit in the sampling period */
+/* In pipelined mode the readout must also fit in the conversion it overlaps with */
+uint8_t conversion_fits_period(uint8_t oversampling_ratio, uint8_t sample_frequency, uint16_t sampling_period, uint8_t acquisition_mode);
+
+/* Applies REG_ACQUISITION_MODE and REG_DI0_CONF to the BUSY interrupt */
+void update_acquisition_mode(void);
+
+/* Returns the number of channels enabled on the mask */
+uint8_t enabled_channels_count(uint8_t enabled_channels);
+
+/* Resets the acquisition state, called before REG_START goes from ZERO to ONE */
+void prepare_acquisition(void);
+
+/* Copies the thresholds' registers to the table used while acquiring */
+void update_thresholds(void);
+
+/* Sends the samples waiting on the samples' ring buffer, and the history of a capture window before them */
+/* Called from the main loop */
+void send_acquired_samples(void);
+
+
+/************************************************************************/
+/* Conversion timestamps                                                */
+/************************************************************************/
+/* TCD0 is a free running timer at 4 MHz that captures the rising edge of CONVSTA */
+/* The Harp timestamp has a resolution of 32 us, which is 128 counts of TCD0 */
+#define CAPTURE_TIMER_COUNTS_PER_HARP_TICK 128
+
+
+/************************************************************************/
+/* ADC readout                                                          */
+/************************************************************************/
+/* DMA CH0 reads each byte on the SPIC transfer complete and DMA CH1 writes */
+/* the byte that clocks the next one on the TCC1 overflow, so the SPIC       */
+/* trigger has a single consumer. A byte takes 64 CPU cycles at 4 MHz and    */
+/* the period leaves 16 more for CH0 to read it before the next is written   */
+#define ADC_BYTE_PACING_CYCLES 80
+
+
+/************************************************************************/
+/* Samples' ring buffer                                                 */
+/************************************************************************/
+/* Must be a power of 2 and hold one sample more than the ones that can be waiting */
+#define SAMPLE_RING_SIZE 64
+
+typedef struct
+{
+	int16_t analog[4];
+	uint32_t seconds;
+	uint16_t micros;
+} sample_t;
+
+
+/************************************************************************/
+/* Thresholds' events                                                   */
+/************************************************************************/
+/* Must be a power of 2 */
+#define DO_EVENT_RING_SIZE 8
+
+typedef struct
+{
+	uint8_t value;
+	uint32_t seconds;
+	uint16_t micros;
+} do_event_t;
+
+
+/************************************************************************/
+/* Capture windows                                                      */
+/************************************************************************/
+/* Samples kept from before a trigger, must be a power of 2 up to 128 */
+#define CAPTURE_HISTORY_SIZE 128
+
+#define CAPTURE_ARMED 0      // Samples go to the history, waiting for a trigger
+#define CAPTURE_POST 1       // Samples after the trigger go to the ring
+#define CAPTURE_SENDING 2    // Samples are dropped until the main loop sends the window
+
+/* Opens a window if REG_CAPTURE_TRIGGER is the source and no window is open */
+void capture_trigger(uint8_t source);
+
+
+/************************************************************************/
+/* Bursts                                                               */
+/************************************************************************/
+/* Values of the enabled channels kept on each burst */
+/* The bursts are kept on the capture history, that is not used while bursting */
+#define BURST_MAX_VALUES 896
+
+#define BURST_IDLE 0         // Not acquiring
+#define BURST_ARMED 1        // Waiting for the trigger
+#define BURST_ACQUIRING 2    // Each conversion is started when the previous one is read
+#define BURST_UPLOADING 3    // The conversions are stopped until the main loop sends the burst
+
+/* Starts a burst if REG_BURST_TRIGGER is the source and a burst is armed */
+void burst_trigger(uint8_t source);
+
+
+/************************************************************************/
+/* Speed Mode                                                           */
+/************************************************************************/
+/* While the core is on Speed Mode each sample is written to the UART as a frame, without the Harp message around it: */
+/* SPEED_FRAME_SYNC, a sequence number that wraps at 255, the I16 values of the channels on REG_ENABLED_CHANNELS */
+/* and a checksum, the sum of the frame's other bytes as on the Harp messages */
+#define SPEED_FRAME_SYNC 0xA5
+#define SPEED_FRAME_MAX_BYTES (2 + 2 * 4 + 1)
+
+
 #endif /* _APP_H_ */
\ No newline at end of file
@@ -1,136 +1,77 @@
+#include "app.h"
 #include "app_funcs.h"
 #include "app_ios_and_regs.h"
 #include "hwbp_core.h"
 
 extern uint16_t pulse_counter_ms;
+extern volatile bool decimation_reset;
+extern uint8_t adc_read_bytes;
+extern volatile bool speed_mode;
+
+/* Bit i is set once REG_DOi_TH_LOW_VALUE is written, until then it follows REG_DOi_TH_VALUE and there is no hysteresis */
+uint8_t thresholds_low_written = 0;
 
 /************************************************************************/
 /* Create pointers to functions                                         */
 /************************************************************************/
 extern AppRegs app_regs;
 
-void (*app_func_rd_pointer[])(void) = {
-	&app_read_REG_START,
-	&app_read_REG_ANALOG_INPUTS,
-	&app_read_REG_DI0,
-	&app_read_REG_RESERVED0,
-	&app_read_REG_RESERVED00,
-	&app_read_REG_RANGE_AND_INPUT_FILTER,
-	&app_read_REG_SAMPLE_FREQUENCY,
-	&app_read_REG_DI0_CONF,
-	&app_read_REG_DO0_CONF,
-	&app_read_REG_DO0_PULSE,
-	&app_read_REG_DO_SET,
-	&app_read_REG_DO_CLEAR,
-	&app_read_REG_DO_TOGGLE,
-	&app_read_REG_DO_WRITE,
-	&app_read_REG_RESERVED1,
-	&app_read_REG_RESERVED2,
-	&app_read_REG_TRIGGER_DESTINY,
-	&app_read_REG_RESERVED3,
-	&app_read_REG_RESERVED4,
-	&app_read_REG_RESERVED5,
-	&app_read_REG_RESERVED6,
-	&app_read_REG_RESERVED7,
-	&app_read_REG_RESERVED8,
-	&app_read_REG_RESERVED9,
-	&app_read_REG_RESERVED10,
-	&app_read_REG_RESERVED11,
-	&app_read_REG_DO0_CH,
-	&app_read_REG_DO1_CH,
-	&app_read_REG_DO2_CH,
-	&app_read_REG_DO3_CH,
-	&app_read_REG_RESERVED12,
-	&app_read_REG_RESERVED13,
-	&app_read_REG_RESERVED14,
-	&app_read_REG_RESERVED15,
-	&app_read_REG_DO0_TH_VALUE,
-	&app_read_REG_DO1_TH_VALUE,
-	&app_read_REG_DO2_TH_VALUE,
-	&app_read_REG_DO3_TH_VALUE,
-	&app_read_REG_RESERVED17,
-	&app_read_REG_RESERVED18,
-	&app_read_REG_RESERVED19,
-	&app_read_REG_RESERVED20,
-	&app_read_REG_DO0_TH_UP_SAMPLES,
-	&app_read_REG_DO1_TH_UP_SAMPLES,
-	&app_read_REG_DO2_TH_UP_SAMPLES,
-	&app_read_REG_DO3_TH_UP_SAMPLES,
-	&app_read_REG_RESERVED21,
-	&app_read_REG_RESERVED22,
-	&app_read_REG_RESERVED23,
-	&app_read_REG_RESERVED24,
-	&app_read_REG_DO0_TH_DOWN_SAMPLES,
-	&app_read_REG_DO1_TH_DOWN_SAMPLES,
-	&app_read_REG_DO2_TH_DOWN_SAMPLES,
-	&app_read_REG_DO3_TH_DOWN_SAMPLES,
-	&app_read_REG_RESERVED25,
-	&app_read_REG_RESERVED26,
-	&app_read_REG_RESERVED27,
-	&app_read_REG_RESERVED28,
-	&app_read_REG_RESERVED29
-};
-
-bool (*app_func_wr_pointer[])(void*) = {
-	&app_write_REG_START,
-	&app_write_REG_ANALOG_INPUTS,
-	&app_write_REG_DI0,
-	&app_write_REG_RESERVED0,
-	&app_write_REG_RESERVED00,
-	&app_write_REG_RANGE_AND_INPUT_FILTER,
-	&app_write_REG_SAMPLE_FREQUENCY,
-	&app_write_REG_DI0_CONF,
-	&app_write_REG_DO0_CONF,
-	&app_write_REG_DO0_PULSE,
-	&app_write_REG_DO_SET,
-	&app_write_REG_DO_CLEAR,
-	&app_write_REG_DO_TOGGLE,
-	&app_write_REG_DO_WRITE,
-	&app_write_REG_RESERVED1,
-	&app_write_REG_RESERVED2,
-	&app_write_REG_TRIGGER_DESTINY,
-	&app_write_REG_RESERVED3,
-	&app_write_REG_RESERVED4,
-	&app_write_REG_RESERVED5,
-	&app_write_REG_RESERVED6,
-	&app_write_REG_RESERVED7,
-	&app_write_REG_RESERVED8,
-	&app_write_REG_RESERVED9,
-	&app_write_REG_RESERVED10,
-	&app_write_REG_RESERVED11,
-	&app_write_REG_DO0_CH,
-	&app_write_REG_DO1_CH,
-	&app_write_REG_DO2_CH,
-	&app_write_REG_DO3_CH,
-	&app_write_REG_RESERVED12,
-	&app_write_REG_RESERVED13,
-	&app_write_REG_RESERVED14,
-	&app_write_REG_RESERVED15,
-	&app_write_REG_DO0_TH_VALUE,
-	&app_write_REG_DO1_TH_VALUE,
-	&app_write_REG_DO2_TH_VALUE,
-	&app_write_REG_DO3_TH_VALUE,
-	&app_write_REG_RESERVED17,
-	&app_write_REG_RESERVED18,
-	&app_write_REG_RESERVED19,
-	&app_write_REG_RESERVED20,
-	&app_write_REG_DO0_TH_UP_SAMPLES,
-	&app_write_REG_DO1_TH_UP_SAMPLES,
-	&app_write_REG_DO2_TH_UP_SAMPLES,
-	&app_write_REG_DO3_TH_UP_SAMPLES,
-	&app_write_REG_RESERVED21,
-	&app_write_REG_RESERVED22,
-	&app_write_REG_RESERVED23,
-	&app_write_REG_RESERVED24,
-	&app_write_REG_DO0_TH_DOWN_SAMPLES,
-	&app_write_REG_DO1_TH_DOWN_SAMPLES,
-	&app_write_REG_DO2_TH_DOWN_SAMPLES,
-	&app_write_REG_DO3_TH_DOWN_SAMPLES,
-	&app_write_REG_RESERVED25,
-	&app_write_REG_RESERVED26,
-	&app_write_REG_RESERVED27,
-	&app_write_REG_RESERVED28,
-	&app_write_REG_RESERVED29
+/* Each register is placed by its address, so the reserved ones are left zeroed and get the default handlers */
+#define APP_REG_HANDLERS(reg) [ADD_##reg - APP_REGS_ADD_MIN] = {&app_read_##reg, &app_write_##reg}
+
+const __flash app_reg_handlers_t app_reg_handlers[APP_REGS_ADD_MAX - APP_REGS_ADD_MIN + 1] = {
+	APP_REG_HANDLERS(REG_START),
+	APP_REG_HANDLERS(REG_ANALOG_INPUTS),
+	APP_REG_HANDLERS(REG_DI0),
+	APP_REG_HANDLERS(REG_RANGE_AND_INPUT_FILTER),
+	APP_REG_HANDLERS(REG_SAMPLE_FREQUENCY),
+	APP_REG_HANDLERS(REG_DI0_CONF),
+	APP_REG_HANDLERS(REG_DO0_CONF),
+	APP_REG_HANDLERS(REG_DO0_PULSE),
+	APP_REG_HANDLERS(REG_DO_SET),
+	APP_REG_HANDLERS(REG_DO_CLEAR),
+	APP_REG_HANDLERS(REG_DO_TOGGLE),
+	APP_REG_HANDLERS(REG_DO_WRITE),
+	APP_REG_HANDLERS(REG_TRIGGER_DESTINY),
+	APP_REG_HANDLERS(REG_DO0_CH),
+	APP_REG_HANDLERS(REG_DO1_CH),
+	APP_REG_HANDLERS(REG_DO2_CH),
+	APP_REG_HANDLERS(REG_DO3_CH),
+	APP_REG_HANDLERS(REG_DO0_TH_VALUE),
+	APP_REG_HANDLERS(REG_DO1_TH_VALUE),
+	APP_REG_HANDLERS(REG_DO2_TH_VALUE),
+	APP_REG_HANDLERS(REG_DO3_TH_VALUE),
+	APP_REG_HANDLERS(REG_DO0_TH_LOW_VALUE),
+	APP_REG_HANDLERS(REG_DO1_TH_LOW_VALUE),
+	APP_REG_HANDLERS(REG_DO2_TH_LOW_VALUE),
+	APP_REG_HANDLERS(REG_DO3_TH_LOW_VALUE),
+	APP_REG_HANDLERS(REG_DO0_TH_UP_SAMPLES),
+	APP_REG_HANDLERS(REG_DO1_TH_UP_SAMPLES),
+	APP_REG_HANDLERS(REG_DO2_TH_UP_SAMPLES),
+	APP_REG_HANDLERS(REG_DO3_TH_UP_SAMPLES),
+	APP_REG_HANDLERS(REG_DO0_TH_DOWN_SAMPLES),
+	APP_REG_HANDLERS(REG_DO1_TH_DOWN_SAMPLES),
+	APP_REG_HANDLERS(REG_DO2_TH_DOWN_SAMPLES),
+	APP_REG_HANDLERS(REG_DO3_TH_DOWN_SAMPLES),
+	APP_REG_HANDLERS(REG_SAMPLING_PERIOD),
+	APP_REG_HANDLERS(REG_BATCH_SIZE),
+	APP_REG_HANDLERS(REG_RING_OVERFLOWS),
+	APP_REG_HANDLERS(REG_RING_HIGH_WATER),
+	APP_REG_HANDLERS(REG_CONVERSION_INTERVAL),
+	APP_REG_HANDLERS(REG_OVERSAMPLING_RATIO),
+	APP_REG_HANDLERS(REG_DECIMATION_FACTOR),
+	APP_REG_HANDLERS(REG_DECIMATION_FILTER),
+	APP_REG_HANDLERS(REG_THRESHOLDS_SOURCE),
+	APP_REG_HANDLERS(REG_ENABLED_CHANNELS),
+	APP_REG_HANDLERS(REG_ACQUISITION_MODE),
+	APP_REG_HANDLERS(REG_CAPTURE_TRIGGER),
+	APP_REG_HANDLERS(REG_CAPTURE_PRE_SAMPLES),
+	APP_REG_HANDLERS(REG_CAPTURE_POST_SAMPLES),
+	APP_REG_HANDLERS(REG_BURST_SAMPLES),
+	APP_REG_HANDLERS(REG_BURST_TRIGGER),
+	APP_REG_HANDLERS(REG_BURST_INTERVAL),
+	APP_REG_HANDLERS(REG_DATA_ENCODING),
+	APP_REG_HANDLERS(REG_ANALOG_DELTA)
 };
 
 
@@ -147,7 +88,11 @@ bool app_write_REG_START(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
 
+	if (reg && !app_regs.REG_START)
+		prepare_acquisition();
+	
 	app_regs.REG_START = reg;
+	update_sampling_timer();
 	return true;
 }
 
@@ -191,42 +136,6 @@ bool app_write_REG_DI0(void *a)
 }
 
 
-/************************************************************************/
-/* REG_RESERVED0                                                        */
-/************************************************************************/
-void app_read_REG_RESERVED0(void)
-{
-	//app_regs.REG_RESERVED0 = 0;
-
-}
-
-bool app_write_REG_RESERVED0(void *a)
-{
-	uint8_t reg = *((uint8_t*)a);
-
-	app_regs.REG_RESERVED0 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED00                                                       */
-/************************************************************************/
-void app_read_REG_RESERVED00(void)
-{
-	//app_regs.REG_RESERVED00 = 0;
-
-}
-
-bool app_write_REG_RESERVED00(void *a)
-{
-	uint8_t reg = *((uint8_t*)a);
-
-	app_regs.REG_RESERVED00 = reg;
-	return true;
-}
-
-
 /************************************************************************/
 /* REG_RANGE_AND_INPUT_FILTER                                           */
 /************************************************************************/
@@ -238,16 +147,23 @@ bool app_write_REG_RANGE_AND_INPUT_FILTER(void *a)
 	if (reg & ~MSK_RANGE_AND_INPUT_FILTER)
 		return false;
 	
+	/* The lower bits are the oversampling ratio, so they follow the same rules as REG_OVERSAMPLING_RATIO */
+	if ((reg & MSK_OVERSAMPLING_RATIO) > GM_OS_64X)
+		return false;
+	
+	if (!conversion_fits_period(reg & MSK_OVERSAMPLING_RATIO, app_regs.REG_SAMPLE_FREQUENCY, app_regs.REG_SAMPLING_PERIOD, app_regs.REG_ACQUISITION_MODE))
+		return false;
+	
 	PORTD.OUTCLR = 0x1C;
 	PORTD.OUTSET = (reg << 2) & 0x1C;
 	
-	
 	if (reg & 0x10)
 		set_RANGE;
 	else
 		clr_RANGE;
 
 	app_regs.REG_RANGE_AND_INPUT_FILTER = reg;
+	app_regs.REG_OVERSAMPLING_RATIO = reg & MSK_OVERSAMPLING_RATIO;
 	return true;
 }
 
@@ -262,8 +178,29 @@ bool app_write_REG_SAMPLE_FREQUENCY(void *a)
 	
 	if (reg & ~MSK_SAMPLE_FREQUENCY)
 		return false;
+	
+	bool burst_changed = (reg == GM_BURST) != (app_regs.REG_SAMPLE_FREQUENCY == GM_BURST);
+	
+	if (burst_changed)
+	{
+		/* Bursts start their own conversions, so they are only entered or left while stopped */
+		if (app_regs.REG_START)
+			return false;
+		
+		/* The burst is kept on the capture history and caught samples aren't converted periodically */
+		if (reg == GM_BURST && (app_regs.REG_CAPTURE_TRIGGER != GM_CAPTURE_OFF || app_regs.REG_DI0_CONF == GM_DI0_RISE_CATCH_SAMPLE))
+			return false;
+	}
+	
+	if (!conversion_fits_period(app_regs.REG_OVERSAMPLING_RATIO, reg, app_regs.REG_SAMPLING_PERIOD, app_regs.REG_ACQUISITION_MODE))
+		return false;
 
 	app_regs.REG_SAMPLE_FREQUENCY = reg;
+	update_sampling_timer();
+	
+	if (burst_changed)
+		update_acquisition_mode();
+	
 	return true;
 }
 
@@ -278,8 +215,13 @@ bool app_write_REG_DI0_CONF(void *a)
 	
 	if (reg & (~MSK_DI0_SEL))
 		return false;
+	
+	if (reg == GM_DI0_RISE_CATCH_SAMPLE && app_regs.REG_SAMPLE_FREQUENCY == GM_BURST)
+		return false;
 
 	app_regs.REG_DI0_CONF = reg;
+	update_sampling_timer();
+	update_acquisition_mode();
 	return true;
 }
 
@@ -298,6 +240,7 @@ bool app_write_REG_DO0_CONF(void *a)
 	uint8_t reg = *((uint8_t*)a);
 
 	app_regs.REG_DO0_CONF = reg;
+	update_thresholds();
 	return true;
 }
 
@@ -461,42 +404,6 @@ bool app_write_REG_DO_WRITE(void *a)
 }
 
 
-/************************************************************************/
-/* REG_RESERVED1                                                        */
-/************************************************************************/
-void app_read_REG_RESERVED1(void)
-{
-	//app_regs.REG_RESERVED1 = 0;
-
-}
-
-bool app_write_REG_RESERVED1(void *a)
-{
-	uint8_t reg = *((uint8_t*)a);
-
-	app_regs.REG_RESERVED1 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED2                                                        */
-/************************************************************************/
-void app_read_REG_RESERVED2(void)
-{
-	//app_regs.REG_RESERVED2 = 0;
-
-}
-
-bool app_write_REG_RESERVED2(void *a)
-{
-	uint8_t reg = *((uint8_t*)a);
-
-	app_regs.REG_RESERVED2 = reg;
-	return true;
-}
-
-
 /************************************************************************/
 /* REG_TRIGGER_DESTINY                                                  */
 /************************************************************************/
@@ -509,168 +416,7 @@ bool app_write_REG_TRIGGER_DESTINY(void *a)
 		return false;
 
 	app_regs.REG_TRIGGER_DESTINY = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED3                                                        */
-/************************************************************************/
-void app_read_REG_RESERVED3(void)
-{
-	//app_regs.REG_RESERVED3 = 0;
-
-}
-
-bool app_write_REG_RESERVED3(void *a)
-{
-	int16_t reg = *((int16_t*)a);
-
-	app_regs.REG_RESERVED3 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED4                                                        */
-/************************************************************************/
-void app_read_REG_RESERVED4(void)
-{
-	//app_regs.REG_RESERVED4 = 0;
-
-}
-
-bool app_write_REG_RESERVED4(void *a)
-{
-	int16_t reg = *((int16_t*)a);
-
-	app_regs.REG_RESERVED4 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED5                                                        */
-/************************************************************************/
-void app_read_REG_RESERVED5(void)
-{
-	//app_regs.REG_RESERVED5 = 0;
-
-}
-
-bool app_write_REG_RESERVED5(void *a)
-{
-	int16_t reg = *((int16_t*)a);
-
-	app_regs.REG_RESERVED5 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED6                                                        */
-/************************************************************************/
-void app_read_REG_RESERVED6(void)
-{
-	//app_regs.REG_RESERVED6 = 0;
-
-}
-
-bool app_write_REG_RESERVED6(void *a)
-{
-	int16_t reg = *((int16_t*)a);
-
-	app_regs.REG_RESERVED6 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED7                                                        */
-/************************************************************************/
-void app_read_REG_RESERVED7(void)
-{
-	//app_regs.REG_RESERVED7 = 0;
-
-}
-
-bool app_write_REG_RESERVED7(void *a)
-{
-	int16_t reg = *((int16_t*)a);
-
-	app_regs.REG_RESERVED7 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED8                                                        */
-/************************************************************************/
-void app_read_REG_RESERVED8(void)
-{
-	//app_regs.REG_RESERVED8 = 0;
-
-}
-
-bool app_write_REG_RESERVED8(void *a)
-{
-	int16_t reg = *((int16_t*)a);
-
-	app_regs.REG_RESERVED8 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED9                                                        */
-/************************************************************************/
-void app_read_REG_RESERVED9(void)
-{
-	//app_regs.REG_RESERVED9 = 0;
-
-}
-
-bool app_write_REG_RESERVED9(void *a)
-{
-	int16_t reg = *((int16_t*)a);
-
-	app_regs.REG_RESERVED9 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED10                                                       */
-/************************************************************************/
-void app_read_REG_RESERVED10(void)
-{
-	//app_regs.REG_RESERVED10 = 0;
-
-}
-
-bool app_write_REG_RESERVED10(void *a)
-{
-	uint8_t reg = *((uint8_t*)a);
-
-	app_regs.REG_RESERVED10 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED11                                                       */
-/************************************************************************/
-void app_read_REG_RESERVED11(void)
-{
-	//app_regs.REG_RESERVED11 = 0;
-
-}
-
-bool app_write_REG_RESERVED11(void *a)
-{
-	uint8_t reg = *((uint8_t*)a);
-
-	app_regs.REG_RESERVED11 = reg;
+	update_sampling_timer();
 	return true;
 }
 
@@ -687,8 +433,12 @@ void app_read_REG_DO0_CH(void)
 bool app_write_REG_DO0_CH(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_ANA3 && reg != GM_NOT_USED)
+		return false;
 
 	app_regs.REG_DO0_CH = reg;
+	update_thresholds();
 	return true;
 }
 
@@ -705,8 +455,12 @@ void app_read_REG_DO1_CH(void)
 bool app_write_REG_DO1_CH(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_ANA3 && reg != GM_NOT_USED)
+		return false;
 
 	app_regs.REG_DO1_CH = reg;
+	update_thresholds();
 	return true;
 }
 
@@ -723,8 +477,12 @@ void app_read_REG_DO2_CH(void)
 bool app_write_REG_DO2_CH(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_ANA3 && reg != GM_NOT_USED)
+		return false;
 
 	app_regs.REG_DO2_CH = reg;
+	update_thresholds();
 	return true;
 }
 
@@ -741,80 +499,12 @@ void app_read_REG_DO3_CH(void)
 bool app_write_REG_DO3_CH(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_ANA3 && reg != GM_NOT_USED)
+		return false;
 
 	app_regs.REG_DO3_CH = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED12                                                       */
-/************************************************************************/
-void app_read_REG_RESERVED12(void)
-{
-	//app_regs.REG_RESERVED12 = 0;
-
-}
-
-bool app_write_REG_RESERVED12(void *a)
-{
-	uint8_t reg = *((uint8_t*)a);
-
-	app_regs.REG_RESERVED12 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED13                                                       */
-/************************************************************************/
-void app_read_REG_RESERVED13(void)
-{
-	//app_regs.REG_RESERVED13 = 0;
-
-}
-
-bool app_write_REG_RESERVED13(void *a)
-{
-	uint8_t reg = *((uint8_t*)a);
-
-	app_regs.REG_RESERVED13 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED14                                                       */
-/************************************************************************/
-void app_read_REG_RESERVED14(void)
-{
-	//app_regs.REG_RESERVED14 = 0;
-
-}
-
-bool app_write_REG_RESERVED14(void *a)
-{
-	uint8_t reg = *((uint8_t*)a);
-
-	app_regs.REG_RESERVED14 = reg;
-	return true;
-}
-
-
-/************************************************************************/
-/* REG_RESERVED15                                                       */
-/************************************************************************/
-void app_read_REG_RESERVED15(void)
-{
-	//app_regs.REG_RESERVED15 = 0;
-
-}
-
-bool app_write_REG_RESERVED15(void *a)
-{
-	uint8_t reg = *((uint8_t*)a);
-
-	app_regs.REG_RESERVED15 = reg;
+	update_thresholds();
 	return true;
 }
 
@@ -833,6 +523,9 @@ bool app_write_REG_DO0_TH_VALUE(void *a)
 	int16_t reg = *((int16_t*)a);
 
 	app_regs.REG_DO0_TH_VALUE = reg;
+	if (!(thresholds_low_written & B_DO0))
+		app_regs.REG_DO0_TH_LOW_VALUE = reg;
+	update_thresholds();
 	return true;
 }
 
@@ -851,6 +544,9 @@ bool app_write_REG_DO1_TH_VALUE(void *a)
 	int16_t reg = *((int16_t*)a);
 
 	app_regs.REG_DO1_TH_VALUE = reg;
+	if (!(thresholds_low_written & B_DO1))
+		app_regs.REG_DO1_TH_LOW_VALUE = reg;
+	update_thresholds();
 	return true;
 }
 
@@ -869,6 +565,9 @@ bool app_write_REG_DO2_TH_VALUE(void *a)
 	int16_t reg = *((int16_t*)a);
 
 	app_regs.REG_DO2_TH_VALUE = reg;
+	if (!(thresholds_low_written & B_DO2))
+		app_regs.REG_DO2_TH_LOW_VALUE = reg;
+	update_thresholds();
 	return true;
 }
 
@@ -887,78 +586,101 @@ bool app_write_REG_DO3_TH_VALUE(void *a)
 	int16_t reg = *((int16_t*)a);
 
 	app_regs.REG_DO3_TH_VALUE = reg;
+	if (!(thresholds_low_written & B_DO3))
+		app_regs.REG_DO3_TH_LOW_VALUE = reg;
+	update_thresholds();
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED17                                                       */
+/* REG_DO0_TH_LOW_VALUE                                                 */
 /************************************************************************/
-void app_read_REG_RESERVED17(void)
+void app_read_REG_DO0_TH_LOW_VALUE(void)
 {
-	//app_regs.REG_RESERVED17 = 0;
+	//app_regs.REG_DO0_TH_LOW_VALUE = 0;
 
 }
 
-bool app_write_REG_RESERVED17(void *a)
+bool app_write_REG_DO0_TH_LOW_VALUE(void *a)
 {
 	int16_t reg = *((int16_t*)a);
 
-	app_regs.REG_RESERVED17 = reg;
+	if (reg > app_regs.REG_DO0_TH_VALUE)
+		return false;
+
+	app_regs.REG_DO0_TH_LOW_VALUE = reg;
+	thresholds_low_written |= B_DO0;
+	update_thresholds();
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED18                                                       */
+/* REG_DO1_TH_LOW_VALUE                                                 */
 /************************************************************************/
-void app_read_REG_RESERVED18(void)
+void app_read_REG_DO1_TH_LOW_VALUE(void)
 {
-	//app_regs.REG_RESERVED18 = 0;
+	//app_regs.REG_DO1_TH_LOW_VALUE = 0;
 
 }
 
-bool app_write_REG_RESERVED18(void *a)
+bool app_write_REG_DO1_TH_LOW_VALUE(void *a)
 {
 	int16_t reg = *((int16_t*)a);
 
-	app_regs.REG_RESERVED18 = reg;
+	if (reg > app_regs.REG_DO1_TH_VALUE)
+		return false;
+
+	app_regs.REG_DO1_TH_LOW_VALUE = reg;
+	thresholds_low_written |= B_DO1;
+	update_thresholds();
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED19                                                       */
+/* REG_DO2_TH_LOW_VALUE                                                 */
 /************************************************************************/
-void app_read_REG_RESERVED19(void)
+void app_read_REG_DO2_TH_LOW_VALUE(void)
 {
-	//app_regs.REG_RESERVED19 = 0;
+	//app_regs.REG_DO2_TH_LOW_VALUE = 0;
 
 }
 
-bool app_write_REG_RESERVED19(void *a)
+bool app_write_REG_DO2_TH_LOW_VALUE(void *a)
 {
 	int16_t reg = *((int16_t*)a);
 
-	app_regs.REG_RESERVED19 = reg;
+	if (reg > app_regs.REG_DO2_TH_VALUE)
+		return false;
+
+	app_regs.REG_DO2_TH_LOW_VALUE = reg;
+	thresholds_low_written |= B_DO2;
+	update_thresholds();
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED20                                                       */
+/* REG_DO3_TH_LOW_VALUE                                                 */
 /************************************************************************/
-void app_read_REG_RESERVED20(void)
+void app_read_REG_DO3_TH_LOW_VALUE(void)
 {
-	//app_regs.REG_RESERVED20 = 0;
+	//app_regs.REG_DO3_TH_LOW_VALUE = 0;
 
 }
 
-bool app_write_REG_RESERVED20(void *a)
+bool app_write_REG_DO3_TH_LOW_VALUE(void *a)
 {
 	int16_t reg = *((int16_t*)a);
 
-	app_regs.REG_RESERVED20 = reg;
+	if (reg > app_regs.REG_DO3_TH_VALUE)
+		return false;
+
+	app_regs.REG_DO3_TH_LOW_VALUE = reg;
+	thresholds_low_written |= B_DO3;
+	update_thresholds();
 	return true;
 }
 
@@ -977,6 +699,7 @@ bool app_write_REG_DO0_TH_UP_SAMPLES(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO0_TH_UP_SAMPLES = reg;
+	update_thresholds();
 	return true;
 }
 
@@ -995,6 +718,7 @@ bool app_write_REG_DO1_TH_UP_SAMPLES(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO1_TH_UP_SAMPLES = reg;
+	update_thresholds();
 	return true;
 }
 
@@ -1013,6 +737,7 @@ bool app_write_REG_DO2_TH_UP_SAMPLES(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO2_TH_UP_SAMPLES = reg;
+	update_thresholds();
 	return true;
 }
 
@@ -1031,239 +756,427 @@ bool app_write_REG_DO3_TH_UP_SAMPLES(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO3_TH_UP_SAMPLES = reg;
+	update_thresholds();
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED21                                                       */
+/* REG_DO0_TH_DOWN_SAMPLES                                              */
 /************************************************************************/
-void app_read_REG_RESERVED21(void)
+void app_read_REG_DO0_TH_DOWN_SAMPLES(void)
 {
-	//app_regs.REG_RESERVED21 = 0;
+	//app_regs.REG_DO0_TH_DOWN_SAMPLES = 0;
 
 }
 
-bool app_write_REG_RESERVED21(void *a)
+bool app_write_REG_DO0_TH_DOWN_SAMPLES(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
 
-	app_regs.REG_RESERVED21 = reg;
+	app_regs.REG_DO0_TH_DOWN_SAMPLES = reg;
+	update_thresholds();
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED22                                                       */
+/* REG_DO1_TH_DOWN_SAMPLES                                              */
 /************************************************************************/
-void app_read_REG_RESERVED22(void)
+void app_read_REG_DO1_TH_DOWN_SAMPLES(void)
 {
-	//app_regs.REG_RESERVED22 = 0;
+	//app_regs.REG_DO1_TH_DOWN_SAMPLES = 0;
 
 }
 
-bool app_write_REG_RESERVED22(void *a)
+bool app_write_REG_DO1_TH_DOWN_SAMPLES(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
 
-	app_regs.REG_RESERVED22 = reg;
+	app_regs.REG_DO1_TH_DOWN_SAMPLES = reg;
+	update_thresholds();
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED23                                                       */
+/* REG_DO2_TH_DOWN_SAMPLES                                              */
 /************************************************************************/
-void app_read_REG_RESERVED23(void)
+void app_read_REG_DO2_TH_DOWN_SAMPLES(void)
 {
-	//app_regs.REG_RESERVED23 = 0;
+	//app_regs.REG_DO2_TH_DOWN_SAMPLES = 0;
 
 }
 
-bool app_write_REG_RESERVED23(void *a)
+bool app_write_REG_DO2_TH_DOWN_SAMPLES(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
 
-	app_regs.REG_RESERVED23 = reg;
+	app_regs.REG_DO2_TH_DOWN_SAMPLES = reg;
+	update_thresholds();
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED24                                                       */
+/* REG_DO3_TH_DOWN_SAMPLES                                              */
 /************************************************************************/
-void app_read_REG_RESERVED24(void)
+void app_read_REG_DO3_TH_DOWN_SAMPLES(void)
 {
-	//app_regs.REG_RESERVED24 = 0;
+	//app_regs.REG_DO3_TH_DOWN_SAMPLES = 0;
 
 }
 
-bool app_write_REG_RESERVED24(void *a)
+bool app_write_REG_DO3_TH_DOWN_SAMPLES(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
 
-	app_regs.REG_RESERVED24 = reg;
+	app_regs.REG_DO3_TH_DOWN_SAMPLES = reg;
+	update_thresholds();
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_DO0_TH_DOWN_SAMPLES                                              */
+/* REG_SAMPLING_PERIOD                                                  */
 /************************************************************************/
-void app_read_REG_DO0_TH_DOWN_SAMPLES(void)
+void app_read_REG_SAMPLING_PERIOD(void) {}
+bool app_write_REG_SAMPLING_PERIOD(void *a)
 {
-	//app_regs.REG_DO0_TH_DOWN_SAMPLES = 0;
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg < 50 || reg > 16000)
+		return false;
+	
+	if (!conversion_fits_period(app_regs.REG_OVERSAMPLING_RATIO, app_regs.REG_SAMPLE_FREQUENCY, reg, app_regs.REG_ACQUISITION_MODE))
+		return false;
 
+	app_regs.REG_SAMPLING_PERIOD = reg;
+	update_sampling_timer();
+	return true;
 }
 
-bool app_write_REG_DO0_TH_DOWN_SAMPLES(void *a)
+
+/************************************************************************/
+/* REG_BATCH_SIZE                                                       */
+/************************************************************************/
+void app_read_REG_BATCH_SIZE(void) {}
+bool app_write_REG_BATCH_SIZE(void *a)
 {
-	uint16_t reg = *((uint16_t*)a);
+	uint8_t reg = *((uint8_t*)a);
+	
+	/* The batch is latched when its first sample arrives, so a new size is used on the next batch */
+	if (reg < 1 || reg * enabled_channels_count(app_regs.REG_ENABLED_CHANNELS) > ANALOG_BATCH_MAX_VALUES)
+		return false;
 
-	app_regs.REG_DO0_TH_DOWN_SAMPLES = reg;
+	app_regs.REG_BATCH_SIZE = reg;
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_DO1_TH_DOWN_SAMPLES                                              */
+/* REG_RING_OVERFLOWS                                                   */
 /************************************************************************/
-void app_read_REG_DO1_TH_DOWN_SAMPLES(void)
+void app_read_REG_RING_OVERFLOWS(void) {}
+bool app_write_REG_RING_OVERFLOWS(void *a)
 {
-	//app_regs.REG_DO1_TH_DOWN_SAMPLES = 0;
-
+	/* Any write resets the register */
+	app_regs.REG_RING_OVERFLOWS = 0;
+	return true;
 }
 
-bool app_write_REG_DO1_TH_DOWN_SAMPLES(void *a)
-{
-	uint16_t reg = *((uint16_t*)a);
 
-	app_regs.REG_DO1_TH_DOWN_SAMPLES = reg;
+/************************************************************************/
+/* REG_RING_HIGH_WATER                                                  */
+/************************************************************************/
+void app_read_REG_RING_HIGH_WATER(void) {}
+bool app_write_REG_RING_HIGH_WATER(void *a)
+{
+	/* Any write resets the register */
+	app_regs.REG_RING_HIGH_WATER = 0;
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_DO2_TH_DOWN_SAMPLES                                              */
+/* REG_CONVERSION_INTERVAL                                              */
 /************************************************************************/
-void app_read_REG_DO2_TH_DOWN_SAMPLES(void)
+// This register is an array with 2 positions
+void app_read_REG_CONVERSION_INTERVAL(void) {}
+bool app_write_REG_CONVERSION_INTERVAL(void *a)
 {
-	//app_regs.REG_DO2_TH_DOWN_SAMPLES = 0;
-
+	/* Any write restarts the statistics */
+	app_regs.REG_CONVERSION_INTERVAL[0] = 0xFFFF;
+	app_regs.REG_CONVERSION_INTERVAL[1] = 0;
+	return true;
 }
 
-bool app_write_REG_DO2_TH_DOWN_SAMPLES(void *a)
+
+/************************************************************************/
+/* REG_OVERSAMPLING_RATIO                                               */
+/************************************************************************/
+void app_read_REG_OVERSAMPLING_RATIO(void) {}
+bool app_write_REG_OVERSAMPLING_RATIO(void *a)
 {
-	uint16_t reg = *((uint16_t*)a);
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_OS_64X)
+		return false;
+	
+	if (!conversion_fits_period(reg, app_regs.REG_SAMPLE_FREQUENCY, app_regs.REG_SAMPLING_PERIOD, app_regs.REG_ACQUISITION_MODE))
+		return false;
+	
+	/* Only the oversampling pins are changed, the range is kept */
+	PORTD.OUTCLR = 0x1C;
+	PORTD.OUTSET = (reg << 2) & 0x1C;
 
-	app_regs.REG_DO2_TH_DOWN_SAMPLES = reg;
+	app_regs.REG_OVERSAMPLING_RATIO = reg;
+	app_regs.REG_RANGE_AND_INPUT_FILTER = (app_regs.REG_RANGE_AND_INPUT_FILTER & ~MSK_OVERSAMPLING_RATIO) | reg;
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_DO3_TH_DOWN_SAMPLES                                              */
+/* REG_DECIMATION_FACTOR                                                */
 /************************************************************************/
-void app_read_REG_DO3_TH_DOWN_SAMPLES(void)
+void app_read_REG_DECIMATION_FACTOR(void) {}
+bool app_write_REG_DECIMATION_FACTOR(void *a)
 {
-	//app_regs.REG_DO3_TH_DOWN_SAMPLES = 0;
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg < 1)
+		return false;
 
+	app_regs.REG_DECIMATION_FACTOR = reg;
+	decimation_reset = true;
+	return true;
 }
 
-bool app_write_REG_DO3_TH_DOWN_SAMPLES(void *a)
+
+/************************************************************************/
+/* REG_DECIMATION_FILTER                                                */
+/************************************************************************/
+void app_read_REG_DECIMATION_FILTER(void) {}
+bool app_write_REG_DECIMATION_FILTER(void *a)
 {
-	uint16_t reg = *((uint16_t*)a);
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_DECIMATION_FILTER)
+		return false;
 
-	app_regs.REG_DO3_TH_DOWN_SAMPLES = reg;
+	app_regs.REG_DECIMATION_FILTER = reg;
+	decimation_reset = true;
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED25                                                       */
+/* REG_THRESHOLDS_SOURCE                                                */
 /************************************************************************/
-void app_read_REG_RESERVED25(void)
+void app_read_REG_THRESHOLDS_SOURCE(void) {}
+bool app_write_REG_THRESHOLDS_SOURCE(void *a)
 {
-	//app_regs.REG_RESERVED25 = 0;
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_THRESHOLDS_SOURCE)
+		return false;
 
+	app_regs.REG_THRESHOLDS_SOURCE = reg;
+	return true;
 }
 
-bool app_write_REG_RESERVED25(void *a)
+
+/************************************************************************/
+/* REG_ENABLED_CHANNELS                                                 */
+/************************************************************************/
+void app_read_REG_ENABLED_CHANNELS(void) {}
+bool app_write_REG_ENABLED_CHANNELS(void *a)
 {
-	uint16_t reg = *((uint16_t*)a);
+	uint8_t reg = *((uint8_t*)a);
+	
+	if ((reg & ~MSK_ENABLED_CHANNELS) || !reg)
+		return false;
+	
+	if (app_regs.REG_BATCH_SIZE * enabled_channels_count(reg) > ANALOG_BATCH_MAX_VALUES)
+		return false;
+	
+	if ((uint32_t)app_regs.REG_BURST_SAMPLES * enabled_channels_count(reg) > BURST_MAX_VALUES)
+		return false;
+	
+	/* The burst being acquired is read with the channels it started with */
+	if (app_regs.REG_START && app_regs.REG_SAMPLE_FREQUENCY == GM_BURST)
+		return false;
+	
+	/* The Speed Mode frames have a fixed length */
+	if (speed_mode)
+		return false;
+	
+	/* The ADC outputs the channels in order, so the readout stops after the last enabled one */
+	if (reg & B_CH3)
+		adc_read_bytes = 8;
+	else if (reg & B_CH2)
+		adc_read_bytes = 6;
+	else if (reg & B_CH1)
+		adc_read_bytes = 4;
+	else
+		adc_read_bytes = 2;
 
-	app_regs.REG_RESERVED25 = reg;
+	app_regs.REG_ENABLED_CHANNELS = reg;
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED26                                                       */
+/* REG_ACQUISITION_MODE                                                 */
 /************************************************************************/
-void app_read_REG_RESERVED26(void)
+void app_read_REG_ACQUISITION_MODE(void) {}
+bool app_write_REG_ACQUISITION_MODE(void *a)
 {
-	//app_regs.REG_RESERVED26 = 0;
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_ACQUISITION_MODE)
+		return false;
+	
+	/* The readout is rearmed on different edges of BUSY, so the mode is only changed while stopped */
+	if (app_regs.REG_START)
+		return false;
+	
+	if (!conversion_fits_period(app_regs.REG_OVERSAMPLING_RATIO, app_regs.REG_SAMPLE_FREQUENCY, app_regs.REG_SAMPLING_PERIOD, reg))
+		return false;
 
+	app_regs.REG_ACQUISITION_MODE = reg;
+	update_acquisition_mode();
+	return true;
 }
 
-bool app_write_REG_RESERVED26(void *a)
+
+/************************************************************************/
+/* REG_CAPTURE_TRIGGER                                                  */
+/************************************************************************/
+void app_read_REG_CAPTURE_TRIGGER(void) {}
+bool app_write_REG_CAPTURE_TRIGGER(void *a)
 {
-	uint16_t reg = *((uint16_t*)a);
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_CAPTURE_TRIGGER)
+		return false;
+	
+	/* The samples take another path while capturing, so the mode is only changed while stopped */
+	if (app_regs.REG_START)
+		return false;
+	
+	/* The capture history holds the bursts */
+	if (reg != GM_CAPTURE_OFF && app_regs.REG_SAMPLE_FREQUENCY == GM_BURST)
+		return false;
 
-	app_regs.REG_RESERVED26 = reg;
+	app_regs.REG_CAPTURE_TRIGGER = reg;
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED27                                                       */
+/* REG_CAPTURE_PRE_SAMPLES                                              */
 /************************************************************************/
-void app_read_REG_RESERVED27(void)
+void app_read_REG_CAPTURE_PRE_SAMPLES(void) {}
+bool app_write_REG_CAPTURE_PRE_SAMPLES(void *a)
 {
-	//app_regs.REG_RESERVED27 = 0;
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > CAPTURE_HISTORY_SIZE)
+		return false;
+	
+	if (app_regs.REG_START)
+		return false;
 
+	app_regs.REG_CAPTURE_PRE_SAMPLES = reg;
+	return true;
 }
 
-bool app_write_REG_RESERVED27(void *a)
+
+/************************************************************************/
+/* REG_CAPTURE_POST_SAMPLES                                             */
+/************************************************************************/
+void app_read_REG_CAPTURE_POST_SAMPLES(void) {}
+bool app_write_REG_CAPTURE_POST_SAMPLES(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
+	
+	if (app_regs.REG_START)
+		return false;
 
-	app_regs.REG_RESERVED27 = reg;
+	app_regs.REG_CAPTURE_POST_SAMPLES = reg;
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED28                                                       */
+/* REG_BURST_SAMPLES                                                    */
 /************************************************************************/
-void app_read_REG_RESERVED28(void)
+void app_read_REG_BURST_SAMPLES(void) {}
+bool app_write_REG_BURST_SAMPLES(void *a)
 {
-	//app_regs.REG_RESERVED28 = 0;
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg < 1 || (uint32_t)reg * enabled_channels_count(app_regs.REG_ENABLED_CHANNELS) > BURST_MAX_VALUES)
+		return false;
 
+	app_regs.REG_BURST_SAMPLES = reg;
+	return true;
 }
 
-bool app_write_REG_RESERVED28(void *a)
+
+/************************************************************************/
+/* REG_BURST_TRIGGER                                                    */
+/************************************************************************/
+void app_read_REG_BURST_TRIGGER(void) {}
+bool app_write_REG_BURST_TRIGGER(void *a)
 {
-	uint16_t reg = *((uint16_t*)a);
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_BURST_TRIGGER)
+		return false;
+	
+	if (reg > GM_BURST_DI0_FALLING)
+		return false;
 
-	app_regs.REG_RESERVED28 = reg;
+	app_regs.REG_BURST_TRIGGER = reg;
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED29                                                       */
+/* REG_BURST_INTERVAL                                                   */
 /************************************************************************/
-void app_read_REG_RESERVED29(void)
+void app_read_REG_BURST_INTERVAL(void) {}
+bool app_write_REG_BURST_INTERVAL(void *a)
 {
-	//app_regs.REG_RESERVED29 = 0;
-
+	/* Measured by the device on each burst */
+	return false;
 }
 
-bool app_write_REG_RESERVED29(void *a)
+
+/************************************************************************/
+/* REG_DATA_ENCODING                                                    */
+/************************************************************************/
+void app_read_REG_DATA_ENCODING(void) {}
+bool app_write_REG_DATA_ENCODING(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_DATA_ENCODING)
+		return false;
 
-	app_regs.REG_RESERVED29 = reg;
+	/* Used from the next batch on */
+	app_regs.REG_DATA_ENCODING = reg;
 	return true;
-}
\ No newline at end of file
+}
+
+
+/************************************************************************/
+/* REG_ANALOG_DELTA                                                     */
+/************************************************************************/
+void app_read_REG_ANALOG_DELTA(void) {}
+bool app_write_REG_ANALOG_DELTA(void *a)
+{
+	return false;
+}
@@ -17,14 +17,24 @@
 #endif
 
 
+/************************************************************************/
+/* Register handlers                                                    */
+/************************************************************************/
+/* Kept in flash and indexed by the address minus APP_REGS_ADD_MIN */
+/* The reserved registers have no handlers: reads do nothing and writes keep the value */
+typedef struct
+{
+	void (*read)(void);
+	bool (*write)(void*);
+} app_reg_handlers_t;
+
+
 /************************************************************************/
 /* Prototypes                                                           */
 /************************************************************************/
 void app_read_REG_START(void);
 void app_read_REG_ANALOG_INPUTS(void);
 void app_read_REG_DI0(void);
-void app_read_REG_RESERVED0(void);
-void app_read_REG_RESERVED00(void);
 void app_read_REG_RANGE_AND_INPUT_FILTER(void);
 void app_read_REG_SAMPLE_FREQUENCY(void);
 void app_read_REG_DI0_CONF(void);
@@ -34,57 +44,50 @@ void app_read_REG_DO_SET(void);
 void app_read_REG_DO_CLEAR(void);
 void app_read_REG_DO_TOGGLE(void);
 void app_read_REG_DO_WRITE(void);
-void app_read_REG_RESERVED1(void);
-void app_read_REG_RESERVED2(void);
 void app_read_REG_TRIGGER_DESTINY(void);
-void app_read_REG_RESERVED3(void);
-void app_read_REG_RESERVED4(void);
-void app_read_REG_RESERVED5(void);
-void app_read_REG_RESERVED6(void);
-void app_read_REG_RESERVED7(void);
-void app_read_REG_RESERVED8(void);
-void app_read_REG_RESERVED9(void);
-void app_read_REG_RESERVED10(void);
-void app_read_REG_RESERVED11(void);
 void app_read_REG_DO0_CH(void);
 void app_read_REG_DO1_CH(void);
 void app_read_REG_DO2_CH(void);
 void app_read_REG_DO3_CH(void);
-void app_read_REG_RESERVED12(void);
-void app_read_REG_RESERVED13(void);
-void app_read_REG_RESERVED14(void);
-void app_read_REG_RESERVED15(void);
 void app_read_REG_DO0_TH_VALUE(void);
 void app_read_REG_DO1_TH_VALUE(void);
 void app_read_REG_DO2_TH_VALUE(void);
 void app_read_REG_DO3_TH_VALUE(void);
-void app_read_REG_RESERVED17(void);
-void app_read_REG_RESERVED18(void);
-void app_read_REG_RESERVED19(void);
-void app_read_REG_RESERVED20(void);
+void app_read_REG_DO0_TH_LOW_VALUE(void);
+void app_read_REG_DO1_TH_LOW_VALUE(void);
+void app_read_REG_DO2_TH_LOW_VALUE(void);
+void app_read_REG_DO3_TH_LOW_VALUE(void);
 void app_read_REG_DO0_TH_UP_SAMPLES(void);
 void app_read_REG_DO1_TH_UP_SAMPLES(void);
 void app_read_REG_DO2_TH_UP_SAMPLES(void);
 void app_read_REG_DO3_TH_UP_SAMPLES(void);
-void app_read_REG_RESERVED21(void);
-void app_read_REG_RESERVED22(void);
-void app_read_REG_RESERVED23(void);
-void app_read_REG_RESERVED24(void);
 void app_read_REG_DO0_TH_DOWN_SAMPLES(void);
 void app_read_REG_DO1_TH_DOWN_SAMPLES(void);
 void app_read_REG_DO2_TH_DOWN_SAMPLES(void);
 void app_read_REG_DO3_TH_DOWN_SAMPLES(void);
-void app_read_REG_RESERVED25(void);
-void app_read_REG_RESERVED26(void);
-void app_read_REG_RESERVED27(void);
-void app_read_REG_RESERVED28(void);
-void app_read_REG_RESERVED29(void);
+void app_read_REG_SAMPLING_PERIOD(void);
+void app_read_REG_BATCH_SIZE(void);
+void app_read_REG_RING_OVERFLOWS(void);
+void app_read_REG_RING_HIGH_WATER(void);
+void app_read_REG_CONVERSION_INTERVAL(void);
+void app_read_REG_OVERSAMPLING_RATIO(void);
+void app_read_REG_DECIMATION_FACTOR(void);
+void app_read_REG_DECIMATION_FILTER(void);
+void app_read_REG_THRESHOLDS_SOURCE(void);
+void app_read_REG_ENABLED_CHANNELS(void);
+void app_read_REG_ACQUISITION_MODE(void);
+void app_read_REG_CAPTURE_TRIGGER(void);
+void app_read_REG_CAPTURE_PRE_SAMPLES(void);
+void app_read_REG_CAPTURE_POST_SAMPLES(void);
+void app_read_REG_BURST_SAMPLES(void);
+void app_read_REG_BURST_TRIGGER(void);
+void app_read_REG_BURST_INTERVAL(void);
+void app_read_REG_DATA_ENCODING(void);
+void app_read_REG_ANALOG_DELTA(void);
 
 bool app_write_REG_START(void *a);
 bool app_write_REG_ANALOG_INPUTS(void *a);
 bool app_write_REG_DI0(void *a);
-bool app_write_REG_RESERVED0(void *a);
-bool app_write_REG_RESERVED00(void *a);
 bool app_write_REG_RANGE_AND_INPUT_FILTER(void *a);
 bool app_write_REG_SAMPLE_FREQUENCY(void *a);
 bool app_write_REG_DI0_CONF(void *a);
@@ -94,51 +97,46 @@ bool app_write_REG_DO_SET(void *a);
 bool app_write_REG_DO_CLEAR(void *a);
 bool app_write_REG_DO_TOGGLE(void *a);
 bool app_write_REG_DO_WRITE(void *a);
-bool app_write_REG_RESERVED1(void *a);
-bool app_write_REG_RESERVED2(void *a);
 bool app_write_REG_TRIGGER_DESTINY(void *a);
-bool app_write_REG_RESERVED3(void *a);
-bool app_write_REG_RESERVED4(void *a);
-bool app_write_REG_RESERVED5(void *a);
-bool app_write_REG_RESERVED6(void *a);
-bool app_write_REG_RESERVED7(void *a);
-bool app_write_REG_RESERVED8(void *a);
-bool app_write_REG_RESERVED9(void *a);
-bool app_write_REG_RESERVED10(void *a);
-bool app_write_REG_RESERVED11(void *a);
 bool app_write_REG_DO0_CH(void *a);
 bool app_write_REG_DO1_CH(void *a);
 bool app_write_REG_DO2_CH(void *a);
 bool app_write_REG_DO3_CH(void *a);
-bool app_write_REG_RESERVED12(void *a);
-bool app_write_REG_RESERVED13(void *a);
-bool app_write_REG_RESERVED14(void *a);
-bool app_write_REG_RESERVED15(void *a);
 bool app_write_REG_DO0_TH_VALUE(void *a);
 bool app_write_REG_DO1_TH_VALUE(void *a);
 bool app_write_REG_DO2_TH_VALUE(void *a);
 bool app_write_REG_DO3_TH_VALUE(void *a);
-bool app_write_REG_RESERVED17(void *a);
-bool app_write_REG_RESERVED18(void *a);
-bool app_write_REG_RESERVED19(void *a);
-bool app_write_REG_RESERVED20(void *a);
+bool app_write_REG_DO0_TH_LOW_VALUE(void *a);
+bool app_write_REG_DO1_TH_LOW_VALUE(void *a);
+bool app_write_REG_DO2_TH_LOW_VALUE(void *a);
+bool app_write_REG_DO3_TH_LOW_VALUE(void *a);
 bool app_write_REG_DO0_TH_UP_SAMPLES(void *a);
 bool app_write_REG_DO1_TH_UP_SAMPLES(void *a);
 bool app_write_REG_DO2_TH_UP_SAMPLES(void *a);
 bool app_write_REG_DO3_TH_UP_SAMPLES(void *a);
-bool app_write_REG_RESERVED21(void *a);
-bool app_write_REG_RESERVED22(void *a);
-bool app_write_REG_RESERVED23(void *a);
-bool app_write_REG_RESERVED24(void *a);
 bool app_write_REG_DO0_TH_DOWN_SAMPLES(void *a);
 bool app_write_REG_DO1_TH_DOWN_SAMPLES(void *a);
 bool app_write_REG_DO2_TH_DOWN_SAMPLES(void *a);
 bool app_write_REG_DO3_TH_DOWN_SAMPLES(void *a);
-bool app_write_REG_RESERVED25(void *a);
-bool app_write_REG_RESERVED26(void *a);
-bool app_write_REG_RESERVED27(void *a);
-bool app_write_REG_RESERVED28(void *a);
-bool app_write_REG_RESERVED29(void *a);
+bool app_write_REG_SAMPLING_PERIOD(void *a);
+bool app_write_REG_BATCH_SIZE(void *a);
+bool app_write_REG_RING_OVERFLOWS(void *a);
+bool app_write_REG_RING_HIGH_WATER(void *a);
+bool app_write_REG_CONVERSION_INTERVAL(void *a);
+bool app_write_REG_OVERSAMPLING_RATIO(void *a);
+bool app_write_REG_DECIMATION_FACTOR(void *a);
+bool app_write_REG_DECIMATION_FILTER(void *a);
+bool app_write_REG_THRESHOLDS_SOURCE(void *a);
+bool app_write_REG_ENABLED_CHANNELS(void *a);
+bool app_write_REG_ACQUISITION_MODE(void *a);
+bool app_write_REG_CAPTURE_TRIGGER(void *a);
+bool app_write_REG_CAPTURE_PRE_SAMPLES(void *a);
+bool app_write_REG_CAPTURE_POST_SAMPLES(void *a);
+bool app_write_REG_BURST_SAMPLES(void *a);
+bool app_write_REG_BURST_TRIGGER(void *a);
+bool app_write_REG_BURST_INTERVAL(void *a);
+bool app_write_REG_DATA_ENCODING(void *a);
+bool app_write_REG_ANALOG_DELTA(void *a);
 
 
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
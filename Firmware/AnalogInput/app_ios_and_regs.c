@@ -92,6 +92,14 @@ uint8_t app_regs_type[] = {
 	TYPE_I16,
 	TYPE_I16,
 	TYPE_I16,
+	TYPE_I16,
+	TYPE_I16,
+	TYPE_I16,
+	TYPE_I16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
@@ -104,14 +112,25 @@ uint8_t app_regs_type[] = {
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
+	TYPE_U8,
 	TYPE_U16,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U8,
 	TYPE_U16,
-	TYPE_U16,
-	TYPE_U16,
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
 	TYPE_U8
 };
 
@@ -174,6 +193,25 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	2,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
 	1
 };
 
@@ -216,10 +254,10 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_DO1_TH_VALUE),
 	(uint8_t*)(&app_regs.REG_DO2_TH_VALUE),
 	(uint8_t*)(&app_regs.REG_DO3_TH_VALUE),
-	(uint8_t*)(&app_regs.REG_RESERVED17),
-	(uint8_t*)(&app_regs.REG_RESERVED18),
-	(uint8_t*)(&app_regs.REG_RESERVED19),
-	(uint8_t*)(&app_regs.REG_RESERVED20),
+	(uint8_t*)(&app_regs.REG_DO0_TH_LOW_VALUE),
+	(uint8_t*)(&app_regs.REG_DO1_TH_LOW_VALUE),
+	(uint8_t*)(&app_regs.REG_DO2_TH_LOW_VALUE),
+	(uint8_t*)(&app_regs.REG_DO3_TH_LOW_VALUE),
 	(uint8_t*)(&app_regs.REG_DO0_TH_UP_SAMPLES),
 	(uint8_t*)(&app_regs.REG_DO1_TH_UP_SAMPLES),
 	(uint8_t*)(&app_regs.REG_DO2_TH_UP_SAMPLES),
@@ -236,5 +274,24 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_RESERVED26),
 	(uint8_t*)(&app_regs.REG_RESERVED27),
 	(uint8_t*)(&app_regs.REG_RESERVED28),
-	(uint8_t*)(&app_regs.REG_RESERVED29)
+	(uint8_t*)(&app_regs.REG_RESERVED29),
+	(uint8_t*)(&app_regs.REG_SAMPLING_PERIOD),
+	(uint8_t*)(&app_regs.REG_BATCH_SIZE),
+	(uint8_t*)(&app_regs.REG_RING_OVERFLOWS),
+	(uint8_t*)(&app_regs.REG_RING_HIGH_WATER),
+	(uint8_t*)(app_regs.REG_CONVERSION_INTERVAL),
+	(uint8_t*)(&app_regs.REG_OVERSAMPLING_RATIO),
+	(uint8_t*)(&app_regs.REG_DECIMATION_FACTOR),
+	(uint8_t*)(&app_regs.REG_DECIMATION_FILTER),
+	(uint8_t*)(&app_regs.REG_THRESHOLDS_SOURCE),
+	(uint8_t*)(&app_regs.REG_ENABLED_CHANNELS),
+	(uint8_t*)(&app_regs.REG_ACQUISITION_MODE),
+	(uint8_t*)(&app_regs.REG_CAPTURE_TRIGGER),
+	(uint8_t*)(&app_regs.REG_CAPTURE_PRE_SAMPLES),
+	(uint8_t*)(&app_regs.REG_CAPTURE_POST_SAMPLES),
+	(uint8_t*)(&app_regs.REG_BURST_SAMPLES),
+	(uint8_t*)(&app_regs.REG_BURST_TRIGGER),
+	(uint8_t*)(&app_regs.REG_BURST_INTERVAL),
+	(uint8_t*)(&app_regs.REG_DATA_ENCODING),
+	(uint8_t*)(app_regs.REG_ANALOG_DELTA)
 };
\ No newline at end of file
@@ -160,10 +160,10 @@ typedef struct
 	int16_t REG_DO1_TH_VALUE;
 	int16_t REG_DO2_TH_VALUE;
 	int16_t REG_DO3_TH_VALUE;
-	uint8_t REG_RESERVED17;
-	uint8_t REG_RESERVED18;
-	uint8_t REG_RESERVED19;
-	uint8_t REG_RESERVED20;
+	int16_t REG_DO0_TH_LOW_VALUE;
+	int16_t REG_DO1_TH_LOW_VALUE;
+	int16_t REG_DO2_TH_LOW_VALUE;
+	int16_t REG_DO3_TH_LOW_VALUE;
 	uint16_t REG_DO0_TH_UP_SAMPLES;
 	uint16_t REG_DO1_TH_UP_SAMPLES;
 	uint16_t REG_DO2_TH_UP_SAMPLES;
@@ -181,6 +181,25 @@ typedef struct
 	uint8_t REG_RESERVED27;
 	uint8_t REG_RESERVED28;
 	uint8_t REG_RESERVED29;
+	uint16_t REG_SAMPLING_PERIOD;
+	uint8_t REG_BATCH_SIZE;
+	uint32_t REG_RING_OVERFLOWS;
+	uint8_t REG_RING_HIGH_WATER;
+	uint16_t REG_CONVERSION_INTERVAL[2];
+	uint8_t REG_OVERSAMPLING_RATIO;
+	uint8_t REG_DECIMATION_FACTOR;
+	uint8_t REG_DECIMATION_FILTER;
+	uint8_t REG_THRESHOLDS_SOURCE;
+	uint8_t REG_ENABLED_CHANNELS;
+	uint8_t REG_ACQUISITION_MODE;
+	uint8_t REG_CAPTURE_TRIGGER;
+	uint8_t REG_CAPTURE_PRE_SAMPLES;
+	uint16_t REG_CAPTURE_POST_SAMPLES;
+	uint16_t REG_BURST_SAMPLES;
+	uint8_t REG_BURST_TRIGGER;
+	uint16_t REG_BURST_INTERVAL;
+	uint8_t REG_DATA_ENCODING;
+	uint8_t REG_ANALOG_DELTA[1];
 } AppRegs;
 
 /************************************************************************/
@@ -225,10 +244,10 @@ typedef struct
 #define ADD_REG_DO1_TH_VALUE                67 // I16    
 #define ADD_REG_DO2_TH_VALUE                68 // I16    
 #define ADD_REG_DO3_TH_VALUE                69 // I16    
-#define ADD_REG_RESERVED17                  70 // U8     
-#define ADD_REG_RESERVED18                  71 // U8     
-#define ADD_REG_RESERVED19                  72 // U8     
-#define ADD_REG_RESERVED20                  73 // U8     
+#define ADD_REG_DO0_TH_LOW_VALUE            70 // I16    Value below which the digital output is cleared
+#define ADD_REG_DO1_TH_LOW_VALUE            71 // I16    
+#define ADD_REG_DO2_TH_LOW_VALUE            72 // I16    
+#define ADD_REG_DO3_TH_LOW_VALUE            73 // I16    
 #define ADD_REG_DO0_TH_UP_SAMPLES           74 // U16    Number of samples above the configured threshold to set the digital output
 #define ADD_REG_DO1_TH_UP_SAMPLES           75 // U16    
 #define ADD_REG_DO2_TH_UP_SAMPLES           76 // U16    
@@ -246,6 +265,25 @@ typedef struct
 #define ADD_REG_RESERVED27                  88 // U8     
 #define ADD_REG_RESERVED28                  89 // U8     
 #define ADD_REG_RESERVED29                  90 // U8     
+#define ADD_REG_SAMPLING_PERIOD             91 // U16    Sampling period (us) used when REG_SAMPLE_FREQUENCY is GM_SAMPLING_PERIOD [50:16000]
+#define ADD_REG_BATCH_SIZE                  92 // U8     Number of samples packed on each ANALOG_INPUTS event [1:120]
+#define ADD_REG_RING_OVERFLOWS              93 // U32    Number of samples lost because the samples' ring buffer was full. Write to reset
+#define ADD_REG_RING_HIGH_WATER             94 // U8     Maximum number of samples waiting on the samples' ring buffer. Write to reset
+#define ADD_REG_CONVERSION_INTERVAL         95 // U16    Minimum and maximum time between conversion starts (units of 250 ns). Write to reset
+#define ADD_REG_OVERSAMPLING_RATIO          96 // U8     Oversampling ratio of the ADC
+#define ADD_REG_DECIMATION_FACTOR           97 // U8     Number of ADC reads combined on each sample sent [1:255]
+#define ADD_REG_DECIMATION_FILTER           98 // U8     Filter used to decimate the ADC reads
+#define ADD_REG_THRESHOLDS_SOURCE           99 // U8     Selects if the thresholds use the ADC reads or the decimated samples
+#define ADD_REG_ENABLED_CHANNELS            100 // U8     Analog input channels sent on the ANALOG_INPUTS events
+#define ADD_REG_ACQUISITION_MODE            101 // U8     Serialized or pipelined conversions and readouts
+#define ADD_REG_CAPTURE_TRIGGER             102 // U8     Trigger of the capture windows, or continuous streaming
+#define ADD_REG_CAPTURE_PRE_SAMPLES         103 // U8     Samples sent from before the trigger
+#define ADD_REG_CAPTURE_POST_SAMPLES        104 // U16    Samples sent from after the trigger
+#define ADD_REG_BURST_SAMPLES               105 // U16    Samples acquired on each burst
+#define ADD_REG_BURST_TRIGGER               106 // U8     Trigger of the bursts
+#define ADD_REG_BURST_INTERVAL              107 // U16    Mean time between the conversions of the last burst (units of 250 ns)
+#define ADD_REG_DATA_ENCODING               108 // U8     Encoding of the samples sent, on ANALOG_INPUTS or on ANALOG_DELTA
+#define ADD_REG_ANALOG_DELTA                109 // U8     Delta encoded samples, sent instead of ANALOG_INPUTS when REG_DATA_ENCODING is GM_ENCODING_DELTA
 
 /************************************************************************/
 /* PWM Generator registers' memory limits                               */
@@ -255,8 +293,8 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x5A
-#define APP_NBYTES_OF_REG_BANK              78
+#define APP_REGS_ADD_MAX                    0x6D
+#define APP_NBYTES_OF_REG_BANK              111
 
 /************************************************************************/
 /* Registers' bits                                                      */
@@ -279,6 +317,8 @@ typedef struct
 #define MSK_SAMPLE_FREQUENCY               (3<<0)       // 
 #define GM_1KHZ                            0x00         // 
 #define GM_2KHZ                            0x01         // 
+#define GM_SAMPLING_PERIOD                 0x02         // Sample at the period set on register SAMPLING_PERIOD
+#define GM_BURST                           0x03         // Bursts of BURST_SAMPLES samples as fast as the ADC allows
 #define MSK_DI0_SEL                        (3<<0)       // 
 #define GM_DI0_SYNC                        (0<<0)       // Use as a pure digital input
 #define GM_DI0_RISE_START_ACQ              (1<<0)       // Start acquisition when rising edge and stop when falling edge
@@ -308,5 +348,42 @@ typedef struct
 #define GM_ANA2                            (2<<0)       // Analog input channel 2
 #define GM_ANA3                            (3<<0)       // Analog input channel 3
 #define GM_NOT_USED                        (8<<0)       // Threshold not used
+#define MSK_OVERSAMPLING_RATIO             0x07         // 
+#define GM_OS_1X                           0x00         // No oversampling
+#define GM_OS_2X                           0x01         // 
+#define GM_OS_4X                           0x02         // 
+#define GM_OS_8X                           0x03         // 
+#define GM_OS_16X                          0x04         // 
+#define GM_OS_32X                          0x05         // 
+#define GM_OS_64X                          0x06         // 
+#define MSK_DECIMATION_FILTER              0x01         // 
+#define GM_DECIMATION_BOXCAR               0x00         // Average of the reads of each window
+#define GM_DECIMATION_CIC2                 0x01         // Second order cascaded integrator-comb
+#define MSK_THRESHOLDS_SOURCE              0x01         // 
+#define GM_THRESHOLDS_RAW                  0x00         // Thresholds use every ADC read
+#define GM_THRESHOLDS_DECIMATED            0x01         // Thresholds use the decimated samples
+#define MSK_ENABLED_CHANNELS               0x0F         // 
+#define B_CH0                              (1<<0)       // Analog input channel 0
+#define B_CH1                              (1<<1)       // Analog input channel 1
+#define B_CH2                              (1<<2)       // Analog input channel 2
+#define B_CH3                              (1<<3)       // Analog input channel 3
+#define MSK_ACQUISITION_MODE               0x01         // 
+#define GM_ACQUISITION_SERIALIZED          0x00         // Each result is read after its conversion, before the next one starts
+#define GM_ACQUISITION_PIPELINED           0x01         // Each result is read while the next conversion runs
+#define MSK_CAPTURE_TRIGGER                0x03         // 
+#define GM_CAPTURE_OFF                     0x00         // Every sample is sent
+#define GM_CAPTURE_DI0_RISING              0x01         // Windows around the rising edges of DI0
+#define GM_CAPTURE_DI0_FALLING             0x02         // Windows around the falling edges of DI0
+#define GM_CAPTURE_THRESHOLD               0x03         // Windows around the thresholds setting an output
+#define MSK_BURST_TRIGGER                  0x03         // 
+#define GM_BURST_IMMEDIATE                 0x00         // Each burst starts when the previous one is sent
+#define GM_BURST_DI0_RISING                0x01         // Each burst starts on a rising edge of DI0
+#define GM_BURST_DI0_FALLING               0x02         // Each burst starts on a falling edge of DI0
+#define MSK_DATA_ENCODING                  0x01         // 
+#define GM_ENCODING_RAW                    0x00         // Each value is sent as an I16 on ANALOG_INPUTS
+#define GM_ENCODING_DELTA                  0x01         // A keyframe and then the differences, zig-zag encoded on one byte, on ANALOG_DELTA
+#define ANALOG_BATCH_MAX_VALUES            120          // 120 values fill 240 of the 245 bytes of a Harp payload
+#define ANALOG_DELTA_MAX_BYTES             240          // The same 240 bytes for the delta encoded samples
+#define ANALOG_DELTA_ESCAPE                0xFF         // Followed by the I16 value, when the difference doesn't fit on a byte
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
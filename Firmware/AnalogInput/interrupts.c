@@ -1,5 +1,6 @@
 #include "cpu.h"
 #include "hwbp_core_types.h"
+#include "app.h"
 #include "app_ios_and_regs.h"
 #include "app_funcs.h"
 #include "hwbp_core.h"
@@ -9,28 +10,32 @@
 /************************************************************************/
 extern AppRegs app_regs;
 
+/* On Speed Mode only the samples' frames go to the UART, so the other events are not sent */
+extern volatile bool speed_mode;
+
 /************************************************************************/
 /* Interrupts from Timers                                               */
 /************************************************************************/
-// ISR(TCC0_OVF_vect, ISR_NAKED)
-// ISR(TCD0_OVF_vect, ISR_NAKED)
-// ISR(TCE0_OVF_vect, ISR_NAKED)
-// ISR(TCF0_OVF_vect, ISR_NAKED)
-// 
-// ISR(TCC0_CCA_vect, ISR_NAKED)
-// ISR(TCD0_CCA_vect, ISR_NAKED)
-// ISR(TCE0_CCA_vect, ISR_NAKED)
-// ISR(TCF0_CCA_vect, ISR_NAKED)
-// 
-// ISR(TCD1_OVF_vect, ISR_NAKED)
-// 
-// ISR(TCD1_CCA_vect, ISR_NAKED)
+/* The handlers below call functions and use the stack, so none of them can be ISR_NAKED */
+
+/* Sampling timer update, when the conversion is started on CONVSTA and CONVSTB */
+/* Only enabled when the trigger must be replicated on a digital output */
+ISR(TCC0_OVF_vect)
+{
+	switch (app_regs.REG_TRIGGER_DESTINY)
+	{
+		case GM_TRIG_TO_DO0: set_DO0; break;
+		case GM_TRIG_TO_DO1: set_DO1; break;
+		case GM_TRIG_TO_DO2: set_DO2; break;
+		case GM_TRIG_TO_DO3: set_DO3; break;
+	}
+}
 
 /************************************************************************/ 
 /* DI0                                                                  */
 /************************************************************************/
 bool previous_DIO = false;
-ISR(PORTB_INT0_vect, ISR_NAKED)
+ISR(PORTB_INT0_vect)
 {
 	if (read_DI0)
 	{
@@ -38,19 +43,26 @@ ISR(PORTB_INT0_vect, ISR_NAKED)
 		{
 			previous_DIO = true;
 			
+			if (app_regs.REG_CAPTURE_TRIGGER == GM_CAPTURE_DI0_RISING)
+				capture_trigger(GM_CAPTURE_DI0_RISING);
+			
 			switch (app_regs.REG_DI0_CONF)
 			{
 				case GM_DI0_SYNC:
 					app_regs.REG_DI0 |= B_DI0;
-					core_func_send_event(ADD_REG_DI0, true);
+					if (!speed_mode)
+						core_func_send_event(ADD_REG_DI0, true);
 					break;				
 				
 				case GM_DI0_RISE_START_ACQ:
+					prepare_acquisition();
 					app_regs.REG_START = 1;
+					update_sampling_timer();
 					break;								
 				
 				case GM_DI0_FALL_START_ACQ:
 					app_regs.REG_START = 0;
+					update_sampling_timer();
 					break;
 				
 				case GM_DI0_RISE_CATCH_SAMPLE:
@@ -65,6 +77,10 @@ ISR(PORTB_INT0_vect, ISR_NAKED)
 					}
 					break;
 			}
+			
+			/* After the switch, so an edge that starts the acquisition also starts its first burst */
+			if (app_regs.REG_BURST_TRIGGER == GM_BURST_DI0_RISING)
+				burst_trigger(GM_BURST_DI0_RISING);
 		}
 	}
 	else
@@ -73,36 +89,160 @@ ISR(PORTB_INT0_vect, ISR_NAKED)
 		{
 			previous_DIO = false;
 			
+			if (app_regs.REG_CAPTURE_TRIGGER == GM_CAPTURE_DI0_FALLING)
+				capture_trigger(GM_CAPTURE_DI0_FALLING);
+			
 			switch (app_regs.REG_DI0_CONF)
 			{
 				case GM_DI0_SYNC:
 				app_regs.REG_DI0 &= ~B_DI0;
-				core_func_send_event(ADD_REG_DI0, true);
+				if (!speed_mode)
+					core_func_send_event(ADD_REG_DI0, true);
 				break;
 				
 				case GM_DI0_RISE_START_ACQ:
 					app_regs.REG_START = 0;
+					update_sampling_timer();
 					break;
 				
 				case GM_DI0_FALL_START_ACQ:
+					prepare_acquisition();
 					app_regs.REG_START = 1;
+					update_sampling_timer();
 					break;
 			}
+			
+			if (app_regs.REG_BURST_TRIGGER == GM_BURST_DI0_FALLING)
+				burst_trigger(GM_BURST_DI0_FALLING);
 		}
 	}	
-	
-	reti();
 }
 
 /************************************************************************/ 
 /* BUSY                                                                 */
 /************************************************************************/
-void process_thresholds(void);
+#define ADC_DMA_BUFFER_SIZE 8
+
+uint8_t adc_dma_buffer[ADC_DMA_BUFFER_SIZE];
+uint8_t adc_dma_dummy = 0;
+
+/* Bytes read from the ADC, up to the last channel enabled on REG_ENABLED_CHANNELS */
+uint8_t adc_read_bytes = ADC_DMA_BUFFER_SIZE;
+
+bool previous_capture_valid = false;
+uint16_t previous_capture;
+
+/* Set by the ADC readout interrupt */
+extern volatile uint8_t burst_state;
+extern volatile uint16_t burst_count;
+extern uint32_t burst_elapsed;
+
+/* Pipelined mode, set by update_acquisition_mode() */
+/* The result of a conversion is read when BUSY rises for the next one, while it runs */
+bool adc_pipelined = false;
+volatile bool adc_result_pending = false;
+
+/* Timestamp of the last conversion that ended, and of the one being read */
+/* The main loop moves the user timestamp to send the batches, so these are kept apart */
+uint32_t adc_converted_seconds;
+uint16_t adc_converted_micros;
+uint32_t adc_sample_seconds;
+uint16_t adc_sample_micros;
+
+static inline void start_readout(void)
+{
+	adc_sample_seconds = adc_converted_seconds;
+	adc_sample_micros = adc_converted_micros;
+	
+	set_CS_ADC;
+	
+	/* Arm the DMA and clock the first byte */
+	/* The DMA reads the remaining bytes in the background and DMA_CH0_vect finishes the sample */
+	/* TCC1 restarts with the first byte, so each of its overflows comes after the byte on the wire is complete */
+	DMA_CH0_TRFCNT = adc_read_bytes;
+	DMA_CH1_TRFCNT = adc_read_bytes - 1;
+	DMA_CH0_CTRLA = DMA_CH_ENABLE_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_1BYTE_gc;
+	DMA_CH1_CTRLA = DMA_CH_ENABLE_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_1BYTE_gc;
+	
+	TCC1_CNT = 0;
+	TCC1_CTRLA = TC_CLKSEL_DIV1_gc;
+	SPIC_DATA = 0;
+}
+
+/* Updates the statistics of the time between conversion starts */
+static inline void update_conversion_interval(uint16_t capture)
+{
+	if (previous_capture_valid)
+	{
+		uint16_t interval = capture - previous_capture;
+		
+		if (interval < app_regs.REG_CONVERSION_INTERVAL[0])
+			app_regs.REG_CONVERSION_INTERVAL[0] = interval;
+		if (interval > app_regs.REG_CONVERSION_INTERVAL[1])
+			app_regs.REG_CONVERSION_INTERVAL[1] = interval;
+	}
+	
+	previous_capture = capture;
+	previous_capture_valid = true;
+}
 
-ISR(PORTD_INT0_vect, ISR_NAKED)
+ISR(PORTD_INT0_vect)
 {
+	/* Inside a burst only the first conversion is timestamped, the others are placed from the captured starts */
+	if (burst_state == BURST_ACQUIRING && burst_count)
+	{
+		if (!read_BUSY)
+		{
+			clr_CONVSTA;
+			clr_CONVSTB;
+			
+			uint16_t capture = TCD0_CCA;
+			burst_elapsed += (uint16_t)(capture - previous_capture);
+			update_conversion_interval(capture);
+			
+			start_readout();
+		}
+		return;
+	}
+	
 	if (!read_BUSY)
 	{
+		/* The timestamp is taken now and the time elapsed since the captured conversion start is discounted */
+		/* This covers the conversions started by the core callbacks, by TCC0 and by DI0 */
+		/* The core registers are read directly, the user timestamp belongs to the main loop */
+		/* The seconds are read again in case the microseconds rolled over in between */
+		uint16_t now = TCD0_CNT;
+		
+		do
+		{
+			adc_converted_seconds = core_func_read_R_TIMESTAMP_SECOND();
+			adc_converted_micros = core_func_read_R_TIMESTAMP_MICRO();
+		} while (adc_converted_seconds != core_func_read_R_TIMESTAMP_SECOND());
+		
+		if (TCD0_INTFLAGS & TC0_CCAIF_bm)
+		{
+			uint16_t capture = TCD0_CCA;
+			uint16_t elapsed = ((uint16_t)(now - capture) + CAPTURE_TIMER_COUNTS_PER_HARP_TICK / 2) / CAPTURE_TIMER_COUNTS_PER_HARP_TICK;
+			
+			if (adc_converted_micros < elapsed)
+			{
+				if (adc_converted_seconds)
+				{
+					adc_converted_micros += 31250;
+					adc_converted_seconds--;
+				}
+				else
+				{
+					/* Right after booting there is no previous second to borrow from */
+					elapsed = adc_converted_micros;
+				}
+			}
+			
+			adc_converted_micros -= elapsed;
+			
+			update_conversion_interval(capture);
+		}
+		
 		clr_CONVSTA;
 		clr_CONVSTB;
 		
@@ -114,189 +254,500 @@ ISR(PORTD_INT0_vect, ISR_NAKED)
 			case GM_TRIG_TO_DO3: clr_DO3; break;
 		}
 		
-		set_CS_ADC;
+		if (adc_pipelined)
+			adc_result_pending = true;
+		else
+			start_readout();
+	}
+	else if (adc_result_pending)
+	{
+		/* Pipelined: the next conversion has started, so the previous result is read while it runs */
+		adc_result_pending = false;
+		start_readout();
+	}
+}
+
+/************************************************************************/ 
+/* Decimation                                                           */
+/************************************************************************/
+/* Boxcar sums the reads of each window and divides the sum by the factor */
+/* CIC is a second order cascaded integrator-comb and its gain is the factor squared */
+/* For 16 bits reads and factors up to 255 both fit in 32 bits, so the integrators are allowed to wrap */
+/* The first CIC output after a reset sums a window of reads against zeroed combs, at about half the */
+/* level, so it is dropped: after it, each output covers the 2 * factor - 1 reads of its response */
+volatile bool decimation_reset = true;
+
+uint8_t decimation_count;
+uint8_t decimation_settling;
+uint8_t decimation_factor;
+uint8_t decimation_filter;
+uint32_t decimation_integrator1[4];
+uint32_t decimation_integrator2[4];
+uint32_t decimation_comb1[4];
+uint32_t decimation_comb2[4];
+
+/* Decimated sample and the timestamp of its first read */
+int16_t decimated[4];
+uint32_t decimated_seconds;
+uint16_t decimated_micros;
+
+/* Returns true when a new decimated sample is available */
+static bool decimate(int16_t *analog)
+{
+	if (decimation_reset)
+	{
+		decimation_reset = false;
+		decimation_count = 0;
+		decimation_factor = app_regs.REG_DECIMATION_FACTOR;
+		decimation_filter = app_regs.REG_DECIMATION_FILTER;
+		decimation_settling = (decimation_filter == GM_DECIMATION_CIC2) ? 1 : 0;
 		
 		for (uint8_t i = 0; i < 4; i++)
 		{
-			SPIC_DATA = 0;
-			loop_until_bit_is_set(SPIC_STATUS, SPI_IF_bp);         
-			*(((uint8_t*)(&app_regs.REG_ANALOG_INPUTS[0])) + i*2 + 1) = SPIC_DATA;
-         
-			SPIC_DATA = 0;
-			loop_until_bit_is_set(SPIC_STATUS, SPI_IF_bp);
-			*(((uint8_t*)(&app_regs.REG_ANALOG_INPUTS[0])) + i*2 + 0) = SPIC_DATA;
+			decimation_integrator1[i] = 0;
+			decimation_integrator2[i] = 0;
+			decimation_comb1[i] = 0;
+			decimation_comb2[i] = 0;
 		}
+	}
+	
+	if (decimation_count == 0)
+	{
+		decimated_seconds = adc_sample_seconds;
+		decimated_micros = adc_sample_micros;
+	}
+	
+	if (decimation_factor == 1)
+	{
+		for (uint8_t i = 0; i < 4; i++)
+		{
+			decimated[i] = analog[i];
+		}
+		return true;
+	}
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		decimation_integrator1[i] += (int32_t)analog[i];
 		
-		clr_CS_ADC;
-		
-		core_func_send_event(ADD_REG_ANALOG_INPUTS, false);
-		process_thresholds();
+		if (decimation_filter == GM_DECIMATION_CIC2)
+			decimation_integrator2[i] += decimation_integrator1[i];
 	}
 	
-	reti();
-}
-
-/************************************************************************/
-/* Process Thresholds                                                   */
-/************************************************************************/
-uint16_t ch0_up_counter = 0;
-uint16_t ch1_up_counter = 0;
-uint16_t ch2_up_counter = 0;
-uint16_t ch3_up_counter = 0;
-uint16_t ch0_down_counter = 0;
-uint16_t ch1_down_counter = 0;
-uint16_t ch2_down_counter = 0;
-uint16_t ch3_down_counter = 0;
-
-#define NEW_DOUT_NO_CHANGE 0
-#define NEW_DOUT_TO_HIGH 1
-#define NEW_DOUT_TO_LOW 2
-
-/* This functions needs 52 us when using the 4 thresholds */
-void process_thresholds(void)
-{	
-	bool send_event = false;
+	if (++decimation_count < decimation_factor)
+		return false;
 	
-	/* Clear changed flags and update register to current values */
-	app_regs.REG_DO_WRITE = PORTA_IN & 0x0F;	
+	decimation_count = 0;
 	
-	/* Output channel 0 */
-	if ((app_regs.REG_DO0_CH != GM_NOT_USED) && (app_regs.REG_DO0_CONF != GM_DO0_TGL_EACH_SEC))
+	for (uint8_t i = 0; i < 4; i++)
 	{
-		if (app_regs.REG_ANALOG_INPUTS[app_regs.REG_DO0_CH] >= app_regs.REG_DO0_TH_VALUE)
+		if (decimation_filter == GM_DECIMATION_CIC2)
 		{
-			if (++ch0_up_counter == app_regs.REG_DO0_TH_UP_SAMPLES + 1)
-			{
-				send_event = true;
-				app_regs.REG_DO_WRITE |= (B_DO0_CHANGED | B_DO0);
-				set_DO0;
-			}
+			uint32_t comb1 = decimation_integrator2[i] - decimation_comb1[i];
+			uint32_t comb2 = comb1 - decimation_comb2[i];
+			decimation_comb1[i] = decimation_integrator2[i];
+			decimation_comb2[i] = comb1;
 			
-			if (ch0_up_counter > app_regs.REG_DO0_TH_UP_SAMPLES)
-				ch0_up_counter = app_regs.REG_DO0_TH_UP_SAMPLES + 1;
-			
-			ch0_down_counter = 0;
+			decimated[i] = (int32_t)comb2 / ((uint16_t)decimation_factor * decimation_factor);
 		}
 		else
 		{
-			if (++ch0_down_counter == app_regs.REG_DO0_TH_DOWN_SAMPLES + 1)
-			{
-				send_event = true;
-				app_regs.REG_DO_WRITE |= B_DO0_CHANGED;
-				app_regs.REG_DO_WRITE &= ~B_DO0;
-				clr_DO0;
-			}
-			
-			if (ch0_down_counter > app_regs.REG_DO0_TH_DOWN_SAMPLES)
-				ch0_down_counter = app_regs.REG_DO0_TH_DOWN_SAMPLES + 1;
-			
-			ch0_up_counter = 0;
+			decimated[i] = (int32_t)decimation_integrator1[i] / decimation_factor;
+			decimation_integrator1[i] = 0;
 		}
 	}
 	
-	/* Output channel 1 */
-	if (app_regs.REG_DO1_CH != GM_NOT_USED)
+	if (decimation_settling)
 	{
-		if (app_regs.REG_ANALOG_INPUTS[app_regs.REG_DO1_CH] >= app_regs.REG_DO1_TH_VALUE)
-		{
-			if (++ch1_up_counter == app_regs.REG_DO1_TH_UP_SAMPLES + 1)
+		decimation_settling--;
+		return false;
+	}
+	
+	return true;
+}
+
+/************************************************************************/ 
+/* ADC readout complete                                                 */
+/************************************************************************/
+uint8_t process_thresholds(int16_t *analog);
+
+/* Single producer, single consumer ring of samples */
+/* Only this interrupt moves the head and only the main loop moves the tail, so no lock is needed */
+sample_t sample_ring[SAMPLE_RING_SIZE];
+volatile uint8_t sample_ring_head = 0;
+volatile uint8_t sample_ring_tail = 0;
+
+/************************************************************************/ 
+/* Capture windows                                                      */
+/************************************************************************/
+/* While armed, the samples go to the history instead of the ring */
+/* A trigger hands the last REG_CAPTURE_PRE_SAMPLES of the history to the main loop */
+/* and lets the next REG_CAPTURE_POST_SAMPLES through the ring */
+/* The history is only written while armed and only read by the main loop while not */
+sample_t capture_history[CAPTURE_HISTORY_SIZE];
+uint8_t capture_history_head;
+uint8_t capture_history_count;
+uint16_t capture_post_left;
+volatile uint8_t capture_state = CAPTURE_ARMED;
+volatile bool capture_reset = true;
+
+/* Samples from before the trigger, waiting for the main loop */
+uint8_t capture_pre_first;
+volatile uint8_t capture_pre_count = 0;
+
+static inline void check_capture_reset(void)
+{
+	if (capture_reset)
+	{
+		capture_reset = false;
+		capture_history_head = 0;
+		capture_history_count = 0;
+	}
+}
+
+void capture_trigger(uint8_t source)
+{
+	if (app_regs.REG_CAPTURE_TRIGGER != source || capture_state != CAPTURE_ARMED || !app_regs.REG_START)
+		return;
+	
+	check_capture_reset();
+	
+	uint8_t pre = app_regs.REG_CAPTURE_PRE_SAMPLES;
+	if (pre > capture_history_count)
+		pre = capture_history_count;
+	
+	capture_pre_first = (capture_history_head - pre) & (CAPTURE_HISTORY_SIZE - 1);
+	capture_pre_count = pre;
+	capture_post_left = app_regs.REG_CAPTURE_POST_SAMPLES;
+	capture_state = capture_post_left ? CAPTURE_POST : CAPTURE_SENDING;
+	
+	/* Marks the window on the stream, the samples from before the trigger follow */
+	if (!speed_mode)
+		core_func_send_event(ADD_REG_CAPTURE_TRIGGER, true);
+}
+
+/* Returns true if the sample goes to the ring */
+static bool capture_sample(void)
+{
+	switch (capture_state)
+	{
+		case CAPTURE_ARMED:
+			check_capture_reset();
+			
+			sample_t *sample = &capture_history[capture_history_head];
+			for (uint8_t i = 0; i < 4; i++)
 			{
-				send_event = true;
-				app_regs.REG_DO_WRITE |= (B_DO1_CHANGED | B_DO1);
-				set_DO1;
+				sample->analog[i] = decimated[i];
 			}
+			sample->seconds = decimated_seconds;
+			sample->micros = decimated_micros;
 			
-			if (ch1_up_counter > app_regs.REG_DO1_TH_UP_SAMPLES)
-				ch1_up_counter = app_regs.REG_DO1_TH_UP_SAMPLES + 1;
-			
-			ch1_down_counter = 0;
+			capture_history_head = (capture_history_head + 1) & (CAPTURE_HISTORY_SIZE - 1);
+			if (capture_history_count < CAPTURE_HISTORY_SIZE)
+				capture_history_count++;
+			return false;
+		
+		case CAPTURE_POST:
+			if (--capture_post_left == 0)
+				capture_state = CAPTURE_SENDING;
+			return true;
+		
+		default:
+			/* The previous window is still being sent */
+			return false;
+	}
+}
+
+/************************************************************************/ 
+/* Bursts                                                               */
+/************************************************************************/
+/* The conversions run back to back: each one is started as soon as the previous one is read */
+/* Only the enabled channels are kept, without decimation and without going through the thresholds */
+/* The values are only written while acquiring and only read by the main loop while uploading */
+volatile uint8_t burst_state = BURST_IDLE;
+int16_t *const burst_values = (int16_t*)capture_history;
+uint8_t burst_channels;
+uint16_t burst_samples;
+volatile uint16_t burst_count;
+uint16_t burst_n_values;
+
+/* Timestamp of the first conversion and the time from its start to the start of the last one (units of 250 ns) */
+uint32_t burst_seconds;
+uint16_t burst_micros;
+uint32_t burst_elapsed;
+
+void burst_trigger(uint8_t source)
+{
+	if (app_regs.REG_BURST_TRIGGER != source || burst_state != BURST_ARMED || !app_regs.REG_START)
+		return;
+	
+	burst_channels = app_regs.REG_ENABLED_CHANNELS;
+	burst_samples = app_regs.REG_BURST_SAMPLES;
+	
+	/* Registers restored from the EEPROM were not checked against each other */
+	if ((uint32_t)burst_samples * enabled_channels_count(burst_channels) > BURST_MAX_VALUES)
+		burst_samples = BURST_MAX_VALUES / enabled_channels_count(burst_channels);
+	
+	burst_count = 0;
+	burst_n_values = 0;
+	burst_elapsed = 0;
+	
+	/* The time since the previous burst is not a conversion interval */
+	previous_capture_valid = false;
+	
+	burst_state = BURST_ACQUIRING;
+	
+	set_CONVSTA;
+	set_CONVSTB;
+	
+	/* Only the first conversion of each burst is replicated on the trigger output */
+	switch (app_regs.REG_TRIGGER_DESTINY)
+	{
+		case GM_TRIG_TO_DO0: set_DO0; break;
+		case GM_TRIG_TO_DO1: set_DO1; break;
+		case GM_TRIG_TO_DO2: set_DO2; break;
+		case GM_TRIG_TO_DO3: set_DO3; break;
+	}
+}
+
+static inline void burst_sample(void)
+{
+	if (burst_count == 0)
+	{
+		burst_seconds = adc_sample_seconds;
+		burst_micros = adc_sample_micros;
+	}
+	
+	int16_t *value = &burst_values[burst_n_values];
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (burst_channels & (1 << i))
+			*value++ = (int16_t)(((uint16_t)adc_dma_buffer[i*2 + 0] << 8) | adc_dma_buffer[i*2 + 1]);
+	}
+	
+	burst_n_values = value - burst_values;
+	
+	/* Stopping in the middle of a burst drops it */
+	if (!app_regs.REG_START)
+	{
+		burst_state = BURST_IDLE;
+		return;
+	}
+	
+	if (++burst_count == burst_samples)
+	{
+		burst_state = BURST_UPLOADING;
+		return;
+	}
+	
+	set_CONVSTA;
+	set_CONVSTB;
+}
+
+ISR(DMA_CH0_vect)
+{
+	DMA_CH0_CTRLB |= DMA_CH_TRNIF_bm;
+	TCC1_CTRLA = TC_CLKSEL_OFF_gc;
+	
+	clr_CS_ADC;
+	
+	if (burst_state == BURST_ACQUIRING)
+	{
+		burst_sample();
+		return;
+	}
+	
+	/* Channels after the last enabled one were not read and keep their previous value */
+	for (uint8_t i = 0; i < adc_read_bytes / 2; i++)
+	{
+		*(((uint8_t*)(&app_regs.REG_ANALOG_INPUTS[0])) + i*2 + 1) = adc_dma_buffer[i*2 + 0];
+		*(((uint8_t*)(&app_regs.REG_ANALOG_INPUTS[0])) + i*2 + 0) = adc_dma_buffer[i*2 + 1];
+	}
+	
+	bool new_sample = decimate(app_regs.REG_ANALOG_INPUTS);
+	bool send_sample = new_sample;
+	uint8_t capture = app_regs.REG_CAPTURE_TRIGGER;
+	
+	if (new_sample && capture != GM_CAPTURE_OFF)
+		send_sample = capture_sample();
+	
+	if (send_sample)
+	{
+		uint8_t next_head = (sample_ring_head + 1) & (SAMPLE_RING_SIZE - 1);
+		
+		if (next_head == sample_ring_tail)
+		{
+			/* The main loop is not keeping up, so the sample is dropped and accounted */
+			app_regs.REG_RING_OVERFLOWS++;
 		}
 		else
 		{
-			if (++ch1_down_counter == app_regs.REG_DO1_TH_DOWN_SAMPLES + 1)
+			sample_t *sample = &sample_ring[sample_ring_head];
+			
+			for (uint8_t i = 0; i < 4; i++)
 			{
-				send_event = true;
-				app_regs.REG_DO_WRITE |= B_DO1_CHANGED;
-				app_regs.REG_DO_WRITE &= ~B_DO1;
-				clr_DO1;
+				sample->analog[i] = decimated[i];
 			}
+			sample->seconds = decimated_seconds;
+			sample->micros = decimated_micros;
 			
-			if (ch1_down_counter > app_regs.REG_DO1_TH_DOWN_SAMPLES)
-				ch1_down_counter = app_regs.REG_DO1_TH_UP_SAMPLES + 1;
+			sample_ring_head = next_head;
 			
-			ch1_up_counter = 0;
+			uint8_t level = (next_head - sample_ring_tail) & (SAMPLE_RING_SIZE - 1);
+			if (level > app_regs.REG_RING_HIGH_WATER)
+				app_regs.REG_RING_HIGH_WATER = level;
 		}
 	}
 	
-	/* Output channel 2 */
-	if (app_regs.REG_DO2_CH != GM_NOT_USED)
+	uint8_t thresholds_set = 0;
+	
+	if (app_regs.REG_THRESHOLDS_SOURCE == GM_THRESHOLDS_DECIMATED)
+	{
+		if (new_sample)
+			thresholds_set = process_thresholds(decimated);
+	}
+	else
+	{
+		thresholds_set = process_thresholds(app_regs.REG_ANALOG_INPUTS);
+	}
+	
+	/* Only an output set by the thresholds opens a capture window, not one set by the host or a pulse */
+	if (capture == GM_CAPTURE_THRESHOLD && thresholds_set)
+		capture_trigger(GM_CAPTURE_THRESHOLD);
+}
+
+/************************************************************************/
+/* Process Thresholds                                                   */
+/************************************************************************/
+typedef struct
+{
+	uint8_t channel;
+	uint8_t pin;
+	int16_t value;
+	int16_t low;
+	uint16_t up_samples;
+	uint16_t down_samples;
+	uint16_t up_counter;
+	uint16_t down_counter;
+} threshold_t;
+
+/* One entry per digital output, indexed by the output number */
+threshold_t thresholds[4];
+
+/* Changes of the outputs waiting for the main loop, a change is dropped if the ring is full */
+/* Only this interrupt moves the head and only the main loop moves the tail, as on the samples' ring */
+do_event_t do_event_ring[DO_EVENT_RING_SIZE];
+volatile uint8_t do_event_ring_head = 0;
+volatile uint8_t do_event_ring_tail = 0;
+
+/* The entries of the digital outputs driven by their thresholds, so the unused ones cost nothing */
+threshold_t *thresholds_active[4];
+uint8_t thresholds_count = 0;
+
+/* Copies the thresholds' registers to the table used by process_thresholds() */
+void update_thresholds(void)
+{
+	uint8_t *channel = &app_regs.REG_DO0_CH;
+	int16_t *value = &app_regs.REG_DO0_TH_VALUE;
+	int16_t *low = &app_regs.REG_DO0_TH_LOW_VALUE;
+	uint16_t *up_samples = &app_regs.REG_DO0_TH_UP_SAMPLES;
+	uint16_t *down_samples = &app_regs.REG_DO0_TH_DOWN_SAMPLES;
+	uint8_t count = 0;
+	
+	for (uint8_t i = 0; i < 4; i++)
 	{
-		if (app_regs.REG_ANALOG_INPUTS[app_regs.REG_DO2_CH] >= app_regs.REG_DO2_TH_VALUE)
+		thresholds[i].channel = channel[i];
+		thresholds[i].pin = 1 << i;
+		thresholds[i].value = value[i];
+		thresholds[i].low = (low[i] > value[i]) ? value[i] : low[i];
+		thresholds[i].up_samples = up_samples[i];
+		thresholds[i].down_samples = down_samples[i];
+		
+		/* DO0 is owned by the acquisition when it toggles each second */
+		if (channel[i] == GM_NOT_USED || (i == 0 && app_regs.REG_DO0_CONF == GM_DO0_TGL_EACH_SEC))
+			continue;
+		
+		thresholds_active[count++] = &thresholds[i];
+	}
+	
+	thresholds_count = count;
+}
+
+/* A low output is set after more than up_samples consecutive samples at or above the value, */
+/* and a high output is cleared after more than down_samples consecutive samples below the low value */
+/* Only the count towards the other state runs, so samples back from the band can't repeat a change */
+/* Returns the outputs set by this sample */
+uint8_t process_thresholds(int16_t *analog)
+{
+	uint8_t set_mask = 0;
+	uint8_t clr_mask = 0;
+	uint8_t outputs = PORTA_IN & 0x0F;
+	threshold_t **active = thresholds_active;
+	threshold_t **end = thresholds_active + thresholds_count;
+	
+	/* Clear changed flags and update register to current values */
+	app_regs.REG_DO_WRITE = outputs;
+	
+	for (; active < end; active++)
+	{
+		threshold_t *th = *active;
+		int16_t sample = analog[th->channel];
+		
+		if (outputs & th->pin)
 		{
-			if (++ch2_up_counter == app_regs.REG_DO2_TH_UP_SAMPLES + 1)
+			th->up_counter = 0;
+			
+			if (sample >= th->low)
 			{
-				send_event = true;
-				app_regs.REG_DO_WRITE |= (B_DO2_CHANGED | B_DO2);
-				set_DO2;
+				th->down_counter = 0;
+			}
+			else if (th->down_counter++ == th->down_samples)
+			{
+				th->down_counter = 0;
+				clr_mask |= th->pin;
 			}
-			
-			if (ch2_up_counter > app_regs.REG_DO2_TH_UP_SAMPLES)
-				ch2_up_counter = app_regs.REG_DO2_TH_UP_SAMPLES + 1;
-			
-			ch2_down_counter = 0;
 		}
 		else
 		{
-			if (++ch2_down_counter == app_regs.REG_DO2_TH_DOWN_SAMPLES + 1)
+			th->down_counter = 0;
+			
+			if (sample < th->value)
 			{
-				send_event = true;
-				app_regs.REG_DO_WRITE |= B_DO2_CHANGED;
-				app_regs.REG_DO_WRITE &= ~B_DO2;
-				clr_DO2;
+				th->up_counter = 0;
+			}
+			else if (th->up_counter++ == th->up_samples)
+			{
+				th->up_counter = 0;
+				set_mask |= th->pin;
 			}
-			
-			if (ch2_down_counter > app_regs.REG_DO2_TH_DOWN_SAMPLES)
-				ch2_down_counter = app_regs.REG_DO2_TH_DOWN_SAMPLES + 1;
-			
-			ch2_up_counter = 0;
 		}
 	}
 	
-	/* Output channel 3 */
-	if (app_regs.REG_DO3_CH != GM_NOT_USED)
+	if (set_mask | clr_mask)
 	{
-		if (app_regs.REG_ANALOG_INPUTS[app_regs.REG_DO3_CH] >= app_regs.REG_DO3_TH_VALUE)
+		set_io_mask(PORTA, set_mask);
+		clear_io_mask(PORTA, clr_mask);
+		
+		/* The changed flags are the outputs' bits shifted to the upper nibble */
+		app_regs.REG_DO_WRITE |= set_mask;
+		app_regs.REG_DO_WRITE &= ~clr_mask;
+		app_regs.REG_DO_WRITE |= (set_mask | clr_mask) << 4;
+		
+		/* Stamped with the conversion that crossed and sent by the main loop, that owns the user timestamp */
+		if (!speed_mode)
 		{
-			if (++ch3_up_counter == app_regs.REG_DO3_TH_UP_SAMPLES + 1)
-			{
-				send_event = true;
-				app_regs.REG_DO_WRITE |= (B_DO3_CHANGED | B_DO3);
-				set_DO3;
-			}
-			if (ch3_up_counter > app_regs.REG_DO3_TH_UP_SAMPLES)
-				ch3_up_counter = app_regs.REG_DO3_TH_UP_SAMPLES + 1;
+			uint8_t next_head = (do_event_ring_head + 1) & (DO_EVENT_RING_SIZE - 1);
 			
-			ch3_down_counter = 0;
-		}
-		else
-		{
-			if (++ch3_down_counter == app_regs.REG_DO3_TH_DOWN_SAMPLES + 1)
+			if (next_head != do_event_ring_tail)
 			{
-				send_event = true;
-				app_regs.REG_DO_WRITE |= B_DO3_CHANGED;
-				app_regs.REG_DO_WRITE &= ~B_DO3;
-				clr_DO3;
+				do_event_ring[do_event_ring_head].value = app_regs.REG_DO_WRITE;
+				do_event_ring[do_event_ring_head].seconds = adc_sample_seconds;
+				do_event_ring[do_event_ring_head].micros = adc_sample_micros;
+				do_event_ring_head = next_head;
 			}
-			
-			if (ch3_down_counter > app_regs.REG_DO3_TH_DOWN_SAMPLES)
-				ch3_down_counter = app_regs.REG_DO3_TH_DOWN_SAMPLES + 1;
-			
-			ch3_up_counter = 0;
 		}
 	}
 	
-	if (send_event)
-	{
-		core_func_send_event(ADD_REG_DO_WRITE, false);
-	}
+	return set_mask;
 }
\ No newline at end of file
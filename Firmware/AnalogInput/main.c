@@ -12,6 +12,9 @@ int main(void)
 	hwbp_app_enable_interrupts;
 	
 	/* Infinite loop */
-	while(1);
-		//__asm volatile("sleep");
+	while(1)
+	{
+		/* Send the samples acquired by the interrupts */
+		send_acquired_samples();
+	}
 }
\ No newline at end of file
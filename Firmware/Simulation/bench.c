@@ -0,0 +1,563 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "hwbp_core_regs.h"
+#include "app.h"
+#include "app_ios_and_regs.h"
+
+/************************************************************************/
+/* Benchmark of the firmware's hot paths                                */
+/************************************************************************/
+/* The firmware is linked from objects built with -fsanitize-coverage=trace-pc,
+ * which calls __sanitizer_cov_trace_pc() on every basic block it runs. Each
+ * path is called in batches and reported as the basic blocks per call of
+ * the batch with the fewest. The count follows the code each path runs, so
+ * it is the same on every run and machine. It is built without
+ * optimization to follow the source rather than the compiler, and it is
+ * not an AVR cycle count.
+ */
+extern AppRegs app_regs;
+extern uint8_t adc_dma_buffer[];
+extern sample_t sample_ring[];
+extern volatile uint8_t sample_ring_head;
+extern volatile uint8_t sample_ring_tail;
+extern volatile uint8_t burst_state;
+extern volatile uint16_t burst_count;
+extern uint16_t burst_n_values;
+
+uint8_t process_thresholds(int16_t *analog);
+void process_thresholds_unrolled(int16_t *analog);
+
+/* Each call writes up to 4 port strobes, so a batch fits in SIM_PORT_WRITES */
+#define BATCH_CALLS 512
+#define BATCH_REPEATS 4
+#define MAX_CASES 256
+#define DEFAULT_TOLERANCE 0.0
+
+enum
+{
+	PATH_BUSY,
+	PATH_DMA,
+	PATH_THRESHOLDS,
+	PATH_THRESHOLDS_UNROLLED,
+	PATH_DI0,
+	PATH_T_1MS,
+	PATH_T_500US,
+	PATH_TCC0_OVF,
+	PATH_MAIN_LOOP
+};
+
+typedef struct
+{
+	char name[48];
+	uint8_t path;
+	uint8_t thresholds;
+	bool hysteresis;
+	uint8_t threshold_source;
+	uint8_t trigger;
+	uint8_t decimation_factor;
+	uint8_t decimation_filter;
+	uint8_t enabled_channels;
+	uint8_t sample_frequency;
+	uint8_t di0_conf;
+	uint8_t batch_size;
+	uint8_t acquisition_mode;
+	uint8_t capture_trigger;
+	uint8_t data_encoding;
+	bool speed_mode;
+	double blocks;
+} bench_case_t;
+
+static bench_case_t cases[MAX_CASES];
+static uint16_t n_cases = 0;
+
+static bench_case_t *add_case(uint8_t path)
+{
+	bench_case_t *c = &cases[n_cases++];
+
+	memset(c, 0, sizeof(*c));
+	c->path = path;
+	c->threshold_source = GM_THRESHOLDS_RAW;
+	c->trigger = GM_TRIG_TO_NONE;
+	c->decimation_factor = 1;
+	c->decimation_filter = GM_DECIMATION_BOXCAR;
+	c->enabled_channels = 0x0F;
+	c->sample_frequency = GM_1KHZ;
+	c->di0_conf = GM_DI0_SYNC;
+	c->batch_size = 1;
+	c->acquisition_mode = GM_ACQUISITION_SERIALIZED;
+	c->capture_trigger = GM_CAPTURE_OFF;
+	c->data_encoding = GM_ENCODING_RAW;
+	return c;
+}
+
+/* Every threshold and trigger configuration on each path that runs them */
+static void build_cases(void)
+{
+	static const char *triggers[] = {"none", "do0", "do1", "do2", "do3"};
+	static const char *di0_confs[] = {"sync", "rise_start", "fall_start", "catch"};
+	static const char *frequencies[] = {"1khz", "2khz", "period"};
+	bench_case_t *c;
+
+	for (uint8_t t = GM_TRIG_TO_NONE; t <= GM_TRIG_TO_DO3; t++)
+	{
+		c = add_case(PATH_BUSY);
+		c->trigger = t;
+		snprintf(c->name, sizeof(c->name), "busy/trigger_%s", triggers[t]);
+	}
+
+	/* Both edges of BUSY, the end of a conversion and the start of the next */
+	c = add_case(PATH_BUSY);
+	c->acquisition_mode = GM_ACQUISITION_PIPELINED;
+	snprintf(c->name, sizeof(c->name), "busy/pipelined");
+
+	/* The conversions after the first of a burst, which only start the readout */
+	c = add_case(PATH_BUSY);
+	c->sample_frequency = GM_BURST;
+	snprintf(c->name, sizeof(c->name), "busy/burst");
+
+	for (uint8_t n = 0; n <= 4; n++)
+	{
+		for (uint8_t hysteresis = 0; hysteresis < (n ? 2 : 1); hysteresis++)
+		{
+			c = add_case(PATH_THRESHOLDS);
+			c->thresholds = n;
+			c->hysteresis = hysteresis;
+			snprintf(c->name, sizeof(c->name), "process_thresholds/%u%s", n, hysteresis ? "/hysteresis" : "");
+		}
+		
+		/* The engine replaced by the table, from bench_reference.c */
+		c = add_case(PATH_THRESHOLDS_UNROLLED);
+		c->thresholds = n;
+		snprintf(c->name, sizeof(c->name), "process_thresholds/%u/unrolled", n);
+	}
+
+	for (uint8_t n = 0; n <= 4; n++)
+	{
+		for (uint8_t source = GM_THRESHOLDS_RAW; source <= GM_THRESHOLDS_DECIMATED; source++)
+		{
+			c = add_case(PATH_DMA);
+			c->thresholds = n;
+			c->threshold_source = source;
+			snprintf(c->name, sizeof(c->name), "dma/thresholds_%u/%s", n, source ? "decimated" : "raw");
+		}
+	}
+
+	for (uint8_t factor = 4; factor <= 16; factor *= 4)
+	{
+		for (uint8_t filter = GM_DECIMATION_BOXCAR; filter <= GM_DECIMATION_CIC2; filter++)
+		{
+			c = add_case(PATH_DMA);
+			c->decimation_factor = factor;
+			c->decimation_filter = filter;
+			snprintf(c->name, sizeof(c->name), "dma/decimation_%u/%s", factor, filter ? "cic2" : "boxcar");
+		}
+	}
+
+	c = add_case(PATH_DMA);
+	c->enabled_channels = 0x01;
+	snprintf(c->name, sizeof(c->name), "dma/channels_1");
+
+	/* Armed and never triggered, so every sample goes to the history */
+	c = add_case(PATH_DMA);
+	c->capture_trigger = GM_CAPTURE_DI0_RISING;
+	snprintf(c->name, sizeof(c->name), "dma/capture_armed");
+
+	c = add_case(PATH_DMA);
+	c->sample_frequency = GM_BURST;
+	snprintf(c->name, sizeof(c->name), "dma/burst");
+
+	for (uint8_t conf = GM_DI0_SYNC; conf <= GM_DI0_RISE_CATCH_SAMPLE; conf++)
+	{
+		for (uint8_t t = GM_TRIG_TO_NONE; t <= (conf == GM_DI0_RISE_CATCH_SAMPLE ? GM_TRIG_TO_DO3 : GM_TRIG_TO_NONE); t++)
+		{
+			c = add_case(PATH_DI0);
+			c->di0_conf = conf;
+			c->trigger = t;
+			c->sample_frequency = (conf == GM_DI0_SYNC || conf == GM_DI0_RISE_CATCH_SAMPLE) ? GM_1KHZ : GM_SAMPLING_PERIOD;
+			snprintf(c->name, sizeof(c->name), "di0/%s/trigger_%s", di0_confs[conf], triggers[t]);
+		}
+	}
+
+	for (uint8_t f = GM_1KHZ; f <= GM_SAMPLING_PERIOD; f++)
+	{
+		for (uint8_t t = GM_TRIG_TO_NONE; t <= GM_TRIG_TO_DO3; t++)
+		{
+			c = add_case(PATH_T_1MS);
+			c->sample_frequency = f;
+			c->trigger = t;
+			snprintf(c->name, sizeof(c->name), "t_1ms/%s/trigger_%s", frequencies[f], triggers[t]);
+
+			c = add_case(PATH_T_500US);
+			c->sample_frequency = f;
+			c->trigger = t;
+			snprintf(c->name, sizeof(c->name), "t_500us/%s/trigger_%s", frequencies[f], triggers[t]);
+		}
+	}
+
+	for (uint8_t t = GM_TRIG_TO_DO0; t <= GM_TRIG_TO_DO3; t++)
+	{
+		c = add_case(PATH_TCC0_OVF);
+		c->sample_frequency = GM_SAMPLING_PERIOD;
+		c->trigger = t;
+		snprintf(c->name, sizeof(c->name), "tcc0_ovf/trigger_%s", triggers[t]);
+	}
+
+	for (uint8_t size = 1; size <= 16; size *= 4)
+	{
+		for (uint8_t channels = 1; channels <= 4; channels += 3)
+		{
+			c = add_case(PATH_MAIN_LOOP);
+			c->batch_size = size;
+			c->enabled_channels = (1 << channels) - 1;
+			snprintf(c->name, sizeof(c->name), "main_loop/batch_%u/channels_%u", size, channels);
+
+			c = add_case(PATH_MAIN_LOOP);
+			c->batch_size = size;
+			c->enabled_channels = (1 << channels) - 1;
+			c->data_encoding = GM_ENCODING_DELTA;
+			snprintf(c->name, sizeof(c->name), "main_loop/batch_%u/channels_%u/delta", size, channels);
+		}
+	}
+
+	/* Each sample is written to the UART on its own, BatchSize doesn't apply */
+	for (uint8_t channels = 1; channels <= 4; channels += 3)
+	{
+		c = add_case(PATH_MAIN_LOOP);
+		c->enabled_channels = (1 << channels) - 1;
+		c->speed_mode = true;
+		snprintf(c->name, sizeof(c->name), "main_loop/channels_%u/speed", channels);
+	}
+}
+
+/************************************************************************/
+/* Configuration                                                        */
+/************************************************************************/
+static void write_u8(uint8_t add, uint8_t value)
+{
+	double v = value;
+	sim_core_write(add, &v, 1);
+}
+
+static void write_i16(uint8_t add, int16_t value)
+{
+	double v = value;
+	sim_core_write(add, &v, 1);
+}
+
+static void configure(bench_case_t *c)
+{
+	sim_harp_set_mode(GM_OP_MODE_ACTIVE);
+	core_callback_reset_registers();
+	core_callback_registers_were_reinitialized();
+	sim_hw_sync();
+
+	/* Pipelined readouts need a conversion longer than the readout */
+	write_u8(ADD_REG_OVERSAMPLING_RATIO, c->acquisition_mode == GM_ACQUISITION_PIPELINED ? GM_OS_8X : GM_OS_1X);
+	write_u8(ADD_REG_ACQUISITION_MODE, c->acquisition_mode);
+	write_u8(ADD_REG_SAMPLE_FREQUENCY, c->sample_frequency);
+	write_u8(ADD_REG_TRIGGER_DESTINY, c->trigger);
+	write_u8(ADD_REG_DECIMATION_FACTOR, c->decimation_factor);
+	write_u8(ADD_REG_DECIMATION_FILTER, c->decimation_filter);
+	write_u8(ADD_REG_THRESHOLDS_SOURCE, c->threshold_source);
+	write_u8(ADD_REG_ENABLED_CHANNELS, c->enabled_channels);
+	write_u8(ADD_REG_BATCH_SIZE, c->batch_size);
+	write_u8(ADD_REG_CAPTURE_TRIGGER, c->capture_trigger);
+	write_u8(ADD_REG_DATA_ENCODING, c->data_encoding);
+
+	/* Every used output changes on each sample, which is the slowest case */
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		write_u8(ADD_REG_DO0_CH + i, i < c->thresholds ? i : GM_NOT_USED);
+		write_i16(ADD_REG_DO0_TH_VALUE + i, c->hysteresis ? 1000 : 0);
+		write_i16(ADD_REG_DO0_TH_LOW_VALUE + i, c->hysteresis ? -1000 : 0);
+		write_u8(ADD_REG_DO0_TH_UP_SAMPLES + i, 0);
+		write_u8(ADD_REG_DO0_TH_DOWN_SAMPLES + i, 0);
+	}
+
+	write_u8(ADD_REG_DI0_CONF, c->di0_conf);
+
+	if (c->speed_mode)
+		sim_harp_set_mode(GM_OP_MODE_SPEED);
+
+	if (c->path != PATH_DI0)
+		write_u8(ADD_REG_START, 1);
+
+	sim_hw_sync();
+}
+
+/************************************************************************/
+/* Measurement                                                          */
+/************************************************************************/
+static uint32_t blocks = 0;
+
+void __sanitizer_cov_trace_pc(void)
+{
+	blocks++;
+}
+
+/* Two ADC reads far apart, so the thresholds change on every sample */
+static const uint8_t adc_high[8] = {0x27, 0x10, 0x27, 0x10, 0x27, 0x10, 0x27, 0x10};
+static const uint8_t adc_low[8] = {0xD8, 0xF0, 0xD8, 0xF0, 0xD8, 0xF0, 0xD8, 0xF0};
+static int16_t analog_high[4] = {10000, 10000, 10000, 10000};
+static int16_t analog_low[4] = {-10000, -10000, -10000, -10000};
+
+static uint32_t calls = 0;
+
+static void call_path(bench_case_t *c)
+{
+	bool high = ++calls & 1;
+
+	/* Stay in the middle of the burst, so each call takes the same path */
+	if (c->sample_frequency == GM_BURST)
+	{
+		burst_state = BURST_ACQUIRING;
+		burst_count = 1;
+		burst_n_values = 0;
+	}
+
+	/* The pins follow the outputs on each call, so the thresholds see the outputs they changed */
+	sim_ports_settle();
+	
+	switch (c->path)
+	{
+		case PATH_BUSY:
+			PORTD.IN &= ~(1 << 1);
+			TCD0_INTFLAGS |= TC0_CCAIF_bm;
+			PORTD_INT0_vect();
+			if (c->acquisition_mode == GM_ACQUISITION_PIPELINED)
+			{
+				PORTD.IN |= (1 << 1);
+				PORTD_INT0_vect();
+			}
+			break;
+
+		case PATH_DMA:
+			/* Keep the ring empty, so each call takes the same path */
+			sample_ring_tail = sample_ring_head;
+			memcpy(adc_dma_buffer, high ? adc_high : adc_low, 8);
+			DMA_CH0_vect();
+			break;
+
+		case PATH_THRESHOLDS:
+			process_thresholds(high ? analog_high : analog_low);
+			break;
+		
+		case PATH_THRESHOLDS_UNROLLED:
+			process_thresholds_unrolled(high ? analog_high : analog_low);
+			break;
+
+		case PATH_DI0:
+			if (high)
+				PORTB.IN |= (1 << 0);
+			else
+				PORTB.IN &= ~(1 << 0);
+			PORTB_INT0_vect();
+			break;
+
+		case PATH_T_1MS:
+			core_callback_t_before_exec();
+			core_callback_t_1ms();
+			core_callback_t_after_exec();
+			break;
+
+		case PATH_T_500US:
+			core_callback_t_before_exec();
+			core_callback_t_500us();
+			core_callback_t_after_exec();
+			break;
+
+		case PATH_TCC0_OVF:
+			TCC0_OVF_vect();
+			break;
+	}
+}
+
+/* Puts the samples of a few whole batches on the ring, outside of the timed section */
+static uint8_t fill_ring(bench_case_t *c)
+{
+	uint8_t n = ((SAMPLE_RING_SIZE - 1) / c->batch_size) * c->batch_size;
+
+	sample_ring_tail = sample_ring_head;
+
+	for (uint8_t i = 0; i < n; i++)
+	{
+		sample_t *sample = &sample_ring[sample_ring_head];
+		memcpy(sample->analog, analog_high, sizeof(sample->analog));
+
+		/* Small steps up and down, so every difference is sent on one byte */
+		if (c->data_encoding == GM_ENCODING_DELTA)
+		{
+			for (uint8_t k = 0; k < 4; k++)
+				sample->analog[k] += (i & 1) ? 50 : -50;
+		}
+
+		sample_ring_head = (sample_ring_head + 1) & (SAMPLE_RING_SIZE - 1);
+	}
+
+	return n;
+}
+
+static double measure(bench_case_t *c)
+{
+	double best = 1e18;
+
+	for (uint16_t r = 0; r < BATCH_REPEATS; r++)
+	{
+		uint32_t start, counted;
+		uint32_t n = BATCH_CALLS;
+
+		if (c->path == PATH_MAIN_LOOP)
+		{
+			n = fill_ring(c);
+			start = blocks;
+			send_acquired_samples();
+			counted = blocks - start;
+		}
+		else
+		{
+			start = blocks;
+			for (uint16_t i = 0; i < BATCH_CALLS; i++)
+				call_path(c);
+			counted = blocks - start;
+		}
+
+		sim_hw_sync();
+
+		if ((double)counted / n < best)
+			best = (double)counted / n;
+	}
+
+	return best;
+}
+
+/************************************************************************/
+/* Baseline                                                             */
+/************************************************************************/
+/* One line per case with its name and basic blocks per call */
+static bool check_baseline(const char *path, double tolerance)
+{
+	char name[64];
+	double baseline;
+	uint16_t regressions = 0;
+	uint16_t checked = 0;
+	FILE *f = fopen(path, "r");
+
+	if (!f)
+	{
+		perror(path);
+		return false;
+	}
+
+	while (fscanf(f, "%63s %lf", name, &baseline) == 2)
+	{
+		for (uint16_t i = 0; i < n_cases; i++)
+		{
+			if (strcmp(cases[i].name, name))
+				continue;
+
+			checked++;
+
+			/* The baseline is rounded to 0.1 */
+			if (cases[i].blocks > baseline * (1 + tolerance / 100) + 0.05)
+			{
+				fprintf(stderr, "slower: %-44s %8.1f blocks, baseline %.1f (+%.0f%%)\n",
+					name, cases[i].blocks, baseline, (cases[i].blocks / baseline - 1) * 100);
+				regressions++;
+			}
+		}
+	}
+
+	fclose(f);
+
+	fprintf(stderr, "%u cases checked against %s with %.0f%% tolerance, %u slower\n", checked, path, tolerance, regressions);
+	return regressions == 0;
+}
+
+static bool write_baseline(const char *path)
+{
+	FILE *f = fopen(path, "w");
+
+	if (!f)
+	{
+		perror(path);
+		return false;
+	}
+
+	for (uint16_t i = 0; i < n_cases; i++)
+		fprintf(f, "%s %.1f\n", cases[i].name, cases[i].blocks);
+
+	fclose(f);
+	return true;
+}
+
+/************************************************************************/
+/* Main                                                                 */
+/************************************************************************/
+static void usage(void)
+{
+	fprintf(stderr, "usage: analog_input_bench [-c <baseline>] [-t <tolerance %%>] [-w <baseline>]\n");
+	fprintf(stderr, "  -c  fail if a case runs more basic blocks than on the baseline\n");
+	fprintf(stderr, "  -t  allowed increase, %.0f%% by default\n", DEFAULT_TOLERANCE);
+	fprintf(stderr, "  -w  write the results as the new baseline\n");
+	exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *check = NULL;
+	const char *write = NULL;
+	double tolerance = DEFAULT_TOLERANCE;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-c") && i + 1 < argc)
+			check = argv[++i];
+		else if (!strcmp(argv[i], "-w") && i + 1 < argc)
+			write = argv[++i];
+		else if (!strcmp(argv[i], "-t") && i + 1 < argc)
+			tolerance = atof(argv[++i]);
+		else
+			usage();
+	}
+
+	sim_hw_init();
+	hwbp_app_initialize();
+
+	build_cases();
+
+	for (uint16_t i = 0; i < n_cases; i++)
+	{
+		configure(&cases[i]);
+		cases[i].blocks = measure(&cases[i]);
+	}
+
+	printf("%-44s %10s\n", "path", "blocks");
+
+	for (uint16_t i = 0; i < n_cases; i++)
+		printf("%-44s %10.1f\n", cases[i].name, cases[i].blocks);
+	
+	/* Each unrolled case follows the table-driven ones with the same thresholds */
+	printf("\n%-44s %10s %10s %8s\n", "thresholds", "table", "unrolled", "ratio");
+	
+	for (uint16_t i = 1; i < n_cases; i++)
+	{
+		if (cases[i].path != PATH_THRESHOLDS_UNROLLED)
+			continue;
+		
+		bench_case_t *table = &cases[i - 1];
+		while (table->thresholds != cases[i].thresholds || table->hysteresis)
+			table--;
+		
+		printf("process_thresholds/%-25u %10.1f %10.1f %7.0f%%\n", cases[i].thresholds, table->blocks, cases[i].blocks,
+			100 * table->blocks / cases[i].blocks);
+	}
+
+	if (write && !write_baseline(write))
+		return 1;
+
+	if (check && !check_baseline(check, tolerance))
+		return 1;
+
+	return 0;
+}
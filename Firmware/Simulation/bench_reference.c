@@ -0,0 +1,175 @@
+#include "cpu.h"
+#include "hwbp_core_types.h"
+#include "app.h"
+#include "app_ios_and_regs.h"
+#include "hwbp_core.h"
+
+/************************************************************************/
+/* Reference thresholds' engine for the benchmark                       */
+/************************************************************************/
+/* The unrolled process_thresholds() the firmware had before the table of
+ * thresholds, unchanged but for its name. It reads the registers on every
+ * sample and has a block per output. The benchmark counts it next to the
+ * table-driven one, built with the same flags. It has no low values, so
+ * it is only run without hysteresis. Its core_func_send_event() is not
+ * counted, since the core is not instrumented, while the table-driven
+ * engine's push to the ring of events is.
+ */
+extern AppRegs app_regs;
+
+static uint16_t ch0_up_counter = 0;
+static uint16_t ch1_up_counter = 0;
+static uint16_t ch2_up_counter = 0;
+static uint16_t ch3_up_counter = 0;
+static uint16_t ch0_down_counter = 0;
+static uint16_t ch1_down_counter = 0;
+static uint16_t ch2_down_counter = 0;
+static uint16_t ch3_down_counter = 0;
+
+void process_thresholds_unrolled(int16_t *analog)
+{
+	bool send_event = false;
+	
+	/* Clear changed flags and update register to current values */
+	app_regs.REG_DO_WRITE = PORTA_IN & 0x0F;
+	
+	/* Output channel 0 */
+	if ((app_regs.REG_DO0_CH != GM_NOT_USED) && (app_regs.REG_DO0_CONF != GM_DO0_TGL_EACH_SEC))
+	{
+		if (analog[app_regs.REG_DO0_CH] >= app_regs.REG_DO0_TH_VALUE)
+		{
+			if (++ch0_up_counter == app_regs.REG_DO0_TH_UP_SAMPLES + 1)
+			{
+				send_event = true;
+				app_regs.REG_DO_WRITE |= (B_DO0_CHANGED | B_DO0);
+				set_DO0;
+			}
+			
+			if (ch0_up_counter > app_regs.REG_DO0_TH_UP_SAMPLES)
+				ch0_up_counter = app_regs.REG_DO0_TH_UP_SAMPLES + 1;
+			
+			ch0_down_counter = 0;
+		}
+		else
+		{
+			if (++ch0_down_counter == app_regs.REG_DO0_TH_DOWN_SAMPLES + 1)
+			{
+				send_event = true;
+				app_regs.REG_DO_WRITE |= B_DO0_CHANGED;
+				app_regs.REG_DO_WRITE &= ~B_DO0;
+				clr_DO0;
+			}
+			
+			if (ch0_down_counter > app_regs.REG_DO0_TH_DOWN_SAMPLES)
+				ch0_down_counter = app_regs.REG_DO0_TH_DOWN_SAMPLES + 1;
+			
+			ch0_up_counter = 0;
+		}
+	}
+	
+	/* Output channel 1 */
+	if (app_regs.REG_DO1_CH != GM_NOT_USED)
+	{
+		if (analog[app_regs.REG_DO1_CH] >= app_regs.REG_DO1_TH_VALUE)
+		{
+			if (++ch1_up_counter == app_regs.REG_DO1_TH_UP_SAMPLES + 1)
+			{
+				send_event = true;
+				app_regs.REG_DO_WRITE |= (B_DO1_CHANGED | B_DO1);
+				set_DO1;
+			}
+			
+			if (ch1_up_counter > app_regs.REG_DO1_TH_UP_SAMPLES)
+				ch1_up_counter = app_regs.REG_DO1_TH_UP_SAMPLES + 1;
+			
+			ch1_down_counter = 0;
+		}
+		else
+		{
+			if (++ch1_down_counter == app_regs.REG_DO1_TH_DOWN_SAMPLES + 1)
+			{
+				send_event = true;
+				app_regs.REG_DO_WRITE |= B_DO1_CHANGED;
+				app_regs.REG_DO_WRITE &= ~B_DO1;
+				clr_DO1;
+			}
+			
+			if (ch1_down_counter > app_regs.REG_DO1_TH_DOWN_SAMPLES)
+				ch1_down_counter = app_regs.REG_DO1_TH_UP_SAMPLES + 1;
+			
+			ch1_up_counter = 0;
+		}
+	}
+	
+	/* Output channel 2 */
+	if (app_regs.REG_DO2_CH != GM_NOT_USED)
+	{
+		if (analog[app_regs.REG_DO2_CH] >= app_regs.REG_DO2_TH_VALUE)
+		{
+			if (++ch2_up_counter == app_regs.REG_DO2_TH_UP_SAMPLES + 1)
+			{
+				send_event = true;
+				app_regs.REG_DO_WRITE |= (B_DO2_CHANGED | B_DO2);
+				set_DO2;
+			}
+			
+			if (ch2_up_counter > app_regs.REG_DO2_TH_UP_SAMPLES)
+				ch2_up_counter = app_regs.REG_DO2_TH_UP_SAMPLES + 1;
+			
+			ch2_down_counter = 0;
+		}
+		else
+		{
+			if (++ch2_down_counter == app_regs.REG_DO2_TH_DOWN_SAMPLES + 1)
+			{
+				send_event = true;
+				app_regs.REG_DO_WRITE |= B_DO2_CHANGED;
+				app_regs.REG_DO_WRITE &= ~B_DO2;
+				clr_DO2;
+			}
+			
+			if (ch2_down_counter > app_regs.REG_DO2_TH_DOWN_SAMPLES)
+				ch2_down_counter = app_regs.REG_DO2_TH_DOWN_SAMPLES + 1;
+			
+			ch2_up_counter = 0;
+		}
+	}
+	
+	/* Output channel 3 */
+	if (app_regs.REG_DO3_CH != GM_NOT_USED)
+	{
+		if (analog[app_regs.REG_DO3_CH] >= app_regs.REG_DO3_TH_VALUE)
+		{
+			if (++ch3_up_counter == app_regs.REG_DO3_TH_UP_SAMPLES + 1)
+			{
+				send_event = true;
+				app_regs.REG_DO_WRITE |= (B_DO3_CHANGED | B_DO3);
+				set_DO3;
+			}
+			if (ch3_up_counter > app_regs.REG_DO3_TH_UP_SAMPLES)
+				ch3_up_counter = app_regs.REG_DO3_TH_UP_SAMPLES + 1;
+			
+			ch3_down_counter = 0;
+		}
+		else
+		{
+			if (++ch3_down_counter == app_regs.REG_DO3_TH_DOWN_SAMPLES + 1)
+			{
+				send_event = true;
+				app_regs.REG_DO_WRITE |= B_DO3_CHANGED;
+				app_regs.REG_DO_WRITE &= ~B_DO3;
+				clr_DO3;
+			}
+			
+			if (ch3_down_counter > app_regs.REG_DO3_TH_DOWN_SAMPLES)
+				ch3_down_counter = app_regs.REG_DO3_TH_DOWN_SAMPLES + 1;
+			
+			ch3_up_counter = 0;
+		}
+	}
+	
+	if (send_event)
+	{
+		core_func_send_event(ADD_REG_DO_WRITE, false);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "harp/delta.hpp"
+
+/************************************************************************/
+/* AnalogDataDelta check                                                */
+/************************************************************************/
+/* Decodes the AnalogDataDelta events of a simulator log with the host
+ * decoder and compares them, read by read, with the AnalogData events of
+ * the same log. scenarios/delta.sim sends the same reads on both, so a
+ * change to the firmware's encoding that the host can't follow fails here.
+ */
+using namespace harp::analog_input;
+
+namespace {
+
+constexpr unsigned address_analog_data = 33;
+
+struct event
+{
+    unsigned address;
+    std::vector<long> payload;
+};
+
+void usage()
+{
+    std::fprintf(stderr, "usage: delta_check <events.csv>\n");
+    std::exit(2);
+}
+
+std::vector<event> read_events(FILE *f)
+{
+    std::vector<event> events;
+    char line[8192];
+
+    while (std::fgets(line, sizeof(line), f))
+    {
+        if (line[0] != 'E')
+            continue;
+
+        /* E,time,address,payload... */
+        char *field = std::strtok(line, ",\n");
+        field = std::strtok(nullptr, ",\n");
+        field = std::strtok(nullptr, ",\n");
+        if (!field)
+            continue;
+
+        event e;
+        e.address = std::strtoul(field, nullptr, 10);
+        while ((field = std::strtok(nullptr, ",\n")))
+            e.payload.push_back(std::strtol(field, nullptr, 10));
+
+        if (e.address == address_analog_data || e.address == address_analog_data_delta)
+            events.push_back(std::move(e));
+    }
+
+    return events;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+        usage();
+
+    FILE *f = std::fopen(argv[1], "r");
+    if (!f)
+    {
+        std::perror(argv[1]);
+        return 1;
+    }
+
+    std::vector<event> events = read_events(f);
+    std::fclose(f);
+
+    std::vector<std::int16_t> raw;
+    std::vector<std::int16_t> decoded;
+    std::uint8_t enabled_channels = 0;
+    std::size_t n_delta = 0;
+
+    for (const event &e : events)
+    {
+        if (e.address == address_analog_data)
+        {
+            for (long value : e.payload)
+                raw.push_back(static_cast<std::int16_t>(value));
+            continue;
+        }
+
+        std::vector<std::uint8_t> payload(e.payload.begin(), e.payload.end());
+        enabled_channels = payload.empty() ? 0 : payload[0];
+
+        unsigned n_enabled = 0;
+        for (unsigned c = 0; c < 4; c++)
+            n_enabled += (enabled_channels >> c) & 1;
+
+        std::size_t max_reads = delta_max_reads(payload.size(), n_enabled);
+        std::vector<std::int16_t> channels(n_enabled * max_reads);
+        std::vector<std::int16_t *> dst(n_enabled);
+        for (unsigned k = 0; k < n_enabled; k++)
+            dst[k] = channels.data() + k * max_reads;
+
+        std::size_t reads = delta_decode(payload.data(), payload.size(), enabled_channels, dst.data());
+        if (!reads)
+        {
+            std::fprintf(stderr, "%s: AnalogDataDelta event %zu doesn't decode\n", argv[1], n_delta);
+            return 1;
+        }
+
+        /* Interleaved like the AnalogData payload */
+        for (std::size_t i = 0; i < reads; i++)
+        {
+            for (unsigned k = 0; k < n_enabled; k++)
+                decoded.push_back(dst[k][i]);
+        }
+
+        n_delta++;
+    }
+
+    if (!n_delta)
+    {
+        std::fprintf(stderr, "%s: no AnalogDataDelta events\n", argv[1]);
+        return 1;
+    }
+
+    if (raw.size() != decoded.size())
+    {
+        std::fprintf(stderr, "%s: %zu values on AnalogData, %zu decoded from AnalogDataDelta\n", argv[1], raw.size(),
+            decoded.size());
+        return 1;
+    }
+
+    for (std::size_t i = 0; i < raw.size(); i++)
+    {
+        if (raw[i] != decoded[i])
+        {
+            std::fprintf(stderr, "%s: value %zu is %d on AnalogData and %d decoded from AnalogDataDelta\n", argv[1], i,
+                raw[i], decoded[i]);
+            return 1;
+        }
+    }
+
+    std::printf("%s: %zu values of %zu AnalogDataDelta events decode as on AnalogData (channels 0x%02X)\n", argv[1],
+        decoded.size(), n_delta, enabled_channels);
+    return 0;
+}
@@ -0,0 +1,282 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "sim.h"
+
+/************************************************************************/
+/* Device emulator on a pseudo-terminal                                 */
+/************************************************************************/
+/* The firmware runs on the host build, paced by the wall clock, and talks
+ * Harp on a pty like the board does on its serial port. Hosts open the
+ * pty's slave (or the link given with -l) as if it was the device.
+ *
+ * The simulated time runs at -x times the wall clock. Combined with
+ * SamplingPeriod this gives rates the board's link can't carry.
+ */
+#define DEFAULT_SPEED 1.0
+
+/* The pty is polled at least once every this much wall clock time */
+#define MAX_STEP_US 1000
+
+/* Messages waiting for the host to read them, the newest are dropped when full */
+#define TX_QUEUE_SIZE (8 * 1024 * 1024)
+
+static uint8_t *tx_queue;
+static size_t tx_start = 0;
+static size_t tx_count = 0;
+static uint64_t tx_dropped = 0;
+static uint64_t tx_bytes = 0;
+
+static volatile sig_atomic_t running = 1;
+
+static void stop(int signal)
+{
+	running = 0;
+}
+
+static void link_tx(const uint8_t *message, uint16_t length)
+{
+	if (tx_start + tx_count + length > TX_QUEUE_SIZE)
+	{
+		memmove(tx_queue, tx_queue + tx_start, tx_count);
+		tx_start = 0;
+	}
+
+	if (tx_count + length > TX_QUEUE_SIZE)
+	{
+		tx_dropped++;
+		return;
+	}
+
+	memcpy(tx_queue + tx_start + tx_count, message, length);
+	tx_count += length;
+}
+
+static void flush_tx(int fd)
+{
+	while (tx_count)
+	{
+		ssize_t n = write(fd, tx_queue + tx_start, tx_count);
+
+		if (n <= 0)
+			return;
+
+		tx_start += n;
+		tx_count -= n;
+		tx_bytes += n;
+	}
+
+	tx_start = 0;
+}
+
+static void receive(int fd)
+{
+	uint8_t data[512];
+	ssize_t n;
+
+	while ((n = read(fd, data, sizeof(data))) > 0)
+		sim_harp_receive(data, n);
+}
+
+/************************************************************************/
+/* Pseudo-terminal                                                      */
+/************************************************************************/
+static int open_pty(char *name, size_t size, int *slave)
+{
+	struct termios tio;
+	int master = posix_openpt(O_RDWR | O_NOCTTY);
+
+	if (master < 0 || grantpt(master) || unlockpt(master) || ptsname_r(master, name, size))
+		return -1;
+
+	/* Keeping the slave open avoids errors on the master while no host is connected */
+	*slave = open(name, O_RDWR | O_NOCTTY);
+	if (*slave < 0)
+		return -1;
+
+	/* Binary data, so no echo and no line processing */
+	tcgetattr(*slave, &tio);
+	cfmakeraw(&tio);
+	tcsetattr(*slave, TCSANOW, &tio);
+
+	fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+	return master;
+}
+
+static double now_s(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/************************************************************************/
+/* Main                                                                 */
+/************************************************************************/
+static void usage(void)
+{
+	fprintf(stderr, "usage: analog_input_emulator [-q] [-l <link>] [-x <speed>] [<scenario>]\n");
+	fprintf(stderr, "  -q  don't print the status each second\n");
+	fprintf(stderr, "  -l  create a symbolic link to the pty, e.g. /tmp/ttyAnalogInput\n");
+	fprintf(stderr, "  -x  simulated seconds per second, %.0f by default\n", DEFAULT_SPEED);
+	fprintf(stderr, "The scenario runs before the device goes online, usually to set the signals\n");
+	exit(2);
+}
+
+/* Used when no scenario sets the signals */
+static void default_signals(void)
+{
+	sim_wave_t wave = {SIM_WAVE_SINE, 0, 20000, 10, 0};
+
+	sim_set_wave(0, &wave);
+	wave.shape = SIM_WAVE_SQUARE;
+	wave.frequency = 1;
+	sim_set_wave(1, &wave);
+	wave.shape = SIM_WAVE_RAMP;
+	sim_set_wave(2, &wave);
+	wave.shape = SIM_WAVE_NOISE;
+	wave.amplitude = 1000;
+	sim_set_wave(3, &wave);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *link_name = NULL;
+	const char *scenario = NULL;
+	double speed = DEFAULT_SPEED;
+	bool quiet = false;
+	char name[64];
+	int slave;
+	int i;
+
+	for (i = 1; i < argc && argv[i][0] == '-' && argv[i][1]; i++)
+	{
+		if (!strcmp(argv[i], "-q"))
+			quiet = true;
+		else if (!strcmp(argv[i], "-l") && i + 1 < argc)
+			link_name = argv[++i];
+		else if (!strcmp(argv[i], "-x") && i + 1 < argc)
+			speed = atof(argv[++i]);
+		else
+			usage();
+	}
+
+	if (i < argc - 1 || speed <= 0)
+		usage();
+	if (i == argc - 1)
+		scenario = argv[i];
+
+	tx_queue = malloc(TX_QUEUE_SIZE);
+	if (!tx_queue)
+		return 1;
+
+	sim_hw_init();
+	hwbp_app_initialize();
+	default_signals();
+
+	if (scenario)
+	{
+		FILE *f = strcmp(scenario, "-") ? fopen(scenario, "r") : stdin;
+		if (!f)
+		{
+			perror(scenario);
+			return 1;
+		}
+		sim_script_run(f, scenario);
+		if (f != stdin)
+			fclose(f);
+	}
+
+	int master = open_pty(name, sizeof(name), &slave);
+	if (master < 0)
+	{
+		perror("pty");
+		return 1;
+	}
+
+	if (link_name)
+	{
+		unlink(link_name);
+		if (symlink(name, link_name))
+		{
+			perror(link_name);
+			return 1;
+		}
+	}
+
+	printf("%s\n", link_name ? link_name : name);
+	fflush(stdout);
+
+	signal(SIGINT, stop);
+	signal(SIGTERM, stop);
+
+	/* Only replies and events from now on go to the host */
+	sim_harp_open(link_tx);
+
+	uint64_t sim_start = sim_now;
+	double start = now_s();
+	double next_status = start + 1;
+	uint32_t last_events = 0;
+	uint64_t last_bytes = 0;
+
+	uint64_t step = (uint64_t)(MAX_STEP_US * speed) * SIM_CYCLES_PER_US;
+	bool behind = false;
+
+	while (running)
+	{
+		/* Only waits when the simulation is on time */
+		struct pollfd pfd = {master, POLLIN | (tx_count ? POLLOUT : 0), 0};
+		poll(&pfd, 1, behind ? 0 : 1);
+
+		receive(master);
+
+		double now = now_s();
+		uint64_t target = sim_start + (uint64_t)((now - start) * speed * SIM_CYCLES_PER_SECOND);
+
+		/* When the host can't keep up with the speed, the simulation falls behind the wall clock */
+		behind = target > sim_now + step;
+		if (behind)
+			target = sim_now + step;
+
+		sim_run_until(target);
+		flush_tx(master);
+
+		if (!quiet && now >= next_status)
+		{
+			double lag = (now - start) * speed - (double)(sim_now - sim_start) / SIM_CYCLES_PER_SECOND;
+
+			fprintf(stderr, "t %.1f s  events/s %u  bytes/s %llu  queued %zu  dropped %llu  behind %.3f s\n",
+				(double)sim_now / SIM_CYCLES_PER_SECOND,
+				sim_harp_stats.events - last_events,
+				(unsigned long long)(tx_bytes - last_bytes),
+				tx_count,
+				(unsigned long long)tx_dropped,
+				lag);
+
+			last_events = sim_harp_stats.events;
+			last_bytes = tx_bytes;
+			next_status += 1;
+		}
+	}
+
+	if (link_name)
+		unlink(link_name);
+
+	sim_core_print_summary(stderr);
+	fprintf(stderr, "commands            %u (%u errors)\n", sim_harp_stats.commands, sim_harp_stats.errors);
+	fprintf(stderr, "replies             %u\n", sim_harp_stats.replies);
+	fprintf(stderr, "harp events         %u (%llu dropped)\n", sim_harp_stats.events, (unsigned long long)tx_dropped);
+	fprintf(stderr, "bytes discarded     %u\n", sim_harp_stats.dropped_bytes);
+
+	close(slave);
+	close(master);
+	free(tx_queue);
+	return 0;
+}
@@ -0,0 +1,11 @@
+#ifndef _SIM_AVR_INTERRUPT_H_
+#define _SIM_AVR_INTERRUPT_H_
+
+/* Each vector becomes a plain function that the simulation calls when the interrupt fires */
+#define ISR(vector, ...) void vector(void)
+#define ISR_NAKED
+#define reti()
+#define sei()
+#define cli()
+
+#endif /* _SIM_AVR_INTERRUPT_H_ */
@@ -0,0 +1,211 @@
+#ifndef _SIM_AVR_IO_H_
+#define _SIM_AVR_IO_H_
+#include <stdint.h>
+
+/* The host has a single address space, so the tables in flash are plain constants */
+#define __flash
+
+/************************************************************************/
+/* Mock of the ATxmega128A4U peripherals used by the firmware           */
+/************************************************************************/
+/* Registers are plain variables that the simulation reads and updates  */
+/* around each call to the firmware. Only the bits the firmware uses    */
+/* are defined and they keep the values of the device header.           */
+
+/************************************************************************/
+/* PORT                                                                 */
+/************************************************************************/
+/* OUTSET, OUTCLR and OUTTGL are strobes, so several writes on the same */
+/* call must not overwrite each other. Each write goes to its own slot  */
+/* and sim_ports_settle() applies them to OUT in the order they were    */
+/* written.                                                             */
+#define SIM_PORT_WRITES 4096
+#define SIM_PORT_NO_WRITE 0xFFFF
+
+typedef struct
+{
+	volatile uint8_t DIR;
+	volatile uint8_t OUT;
+	volatile uint8_t IN;
+	volatile uint8_t INTCTRL;
+	volatile uint8_t INT0MASK;
+	volatile uint8_t INT1MASK;
+	volatile uint8_t INTFLAGS;
+	volatile uint8_t PIN0CTRL;
+	volatile uint8_t PIN1CTRL;
+	volatile uint8_t PIN2CTRL;
+	volatile uint8_t PIN3CTRL;
+	volatile uint8_t PIN4CTRL;
+	volatile uint8_t PIN5CTRL;
+	volatile uint8_t PIN6CTRL;
+	volatile uint8_t PIN7CTRL;
+	volatile uint16_t OUTSET_WRITES[SIM_PORT_WRITES];
+	volatile uint16_t OUTCLR_WRITES[SIM_PORT_WRITES];
+	volatile uint16_t OUTTGL_WRITES[SIM_PORT_WRITES];
+} PORT_t;
+
+extern uint16_t sim_port_writes;
+
+#define OUTSET OUTSET_WRITES[sim_port_writes++ & (SIM_PORT_WRITES - 1)]
+#define OUTCLR OUTCLR_WRITES[sim_port_writes++ & (SIM_PORT_WRITES - 1)]
+#define OUTTGL OUTTGL_WRITES[sim_port_writes++ & (SIM_PORT_WRITES - 1)]
+
+extern PORT_t PORTA, PORTB, PORTC, PORTD, PORTE;
+
+#define PORTA_IN PORTA.IN
+#define PORTA_OUT PORTA.OUT
+#define PORTC_PIN0CTRL PORTC.PIN0CTRL
+
+#define PORT_ISC_gm 0x07
+#define PORT_ISC_BOTHEDGES_gc 0x00
+#define PORT_ISC_RISING_gc 0x01
+#define PORT_ISC_FALLING_gc 0x02
+
+/************************************************************************/
+/* Timer/Counter                                                        */
+/************************************************************************/
+typedef struct
+{
+	volatile uint8_t CTRLA;
+	volatile uint8_t CTRLB;
+	volatile uint16_t CNT;
+	volatile uint16_t PER;
+} TC0_t;
+
+typedef TC0_t TC1_t;
+
+extern volatile uint8_t TCC0_CTRLA;
+extern volatile uint8_t TCC0_CTRLB;
+extern volatile uint8_t TCC0_CTRLFSET;
+extern volatile uint8_t TCC0_INTCTRLA;
+extern volatile uint16_t TCC0_PER;
+extern volatile uint16_t TCC0_PERBUF;
+extern volatile uint16_t TCC0_CCA;
+extern volatile uint16_t TCC0_CCB;
+
+extern volatile uint8_t TCC1_CTRLA;
+extern volatile uint16_t TCC1_CNT;
+extern volatile uint16_t TCC1_PER;
+
+extern volatile uint8_t TCD0_CTRLA;
+extern volatile uint8_t TCD0_CTRLB;
+extern volatile uint8_t TCD0_CTRLD;
+extern volatile uint8_t TCD0_INTFLAGS;
+extern volatile uint16_t TCD0_CNT;
+extern volatile uint16_t TCD0_PER;
+extern volatile uint16_t TCD0_CCA;
+
+#define TC_CLKSEL_gm 0x0F
+#define TC_CLKSEL_OFF_gc 0x00
+#define TC_CLKSEL_DIV1_gc 0x01
+#define TC_CLKSEL_DIV8_gc 0x04
+
+#define TC_WGMODE_gm 0x07
+#define TC_WGMODE_NORMAL_gc 0x00
+#define TC_WGMODE_SS_gc 0x03
+
+#define TC0_CCAEN_bm 0x10
+#define TC0_CCBEN_bm 0x20
+
+#define TC_CMD_gm 0x0C
+#define TC_CMD_RESTART_gc 0x08
+
+#define TC_OVFINTLVL_gm 0x03
+#define TC_OVFINTLVL_OFF_gc 0x00
+#define TC_OVFINTLVL_LO_gc 0x01
+
+#define TC_EVACT_gm 0xE0
+#define TC_EVACT_CAPT_gc 0x20
+#define TC_EVSEL_gm 0x0F
+#define TC_EVSEL_CH7_gc 0x0F
+
+#define TC0_OVFIF_bm 0x01
+#define TC0_CCAIF_bm 0x10
+
+/************************************************************************/
+/* Event system                                                         */
+/************************************************************************/
+extern volatile uint8_t EVSYS_CH7MUX;
+
+#define EVSYS_CHMUX_PORTC_PIN0_gc 0x60
+
+/************************************************************************/
+/* SPI                                                                  */
+/************************************************************************/
+extern volatile uint8_t SPIC_CTRL;
+extern volatile uint8_t SPIC_DATA;
+
+#define SPI_CLK2X_bm 0x80
+#define SPI_ENABLE_bm 0x40
+#define SPI_MASTER_bm 0x10
+#define SPI_MODE_0_gc 0x00
+#define SPI_PRESCALER_DIV16_gc 0x01
+
+/************************************************************************/
+/* DMA                                                                  */
+/************************************************************************/
+extern volatile uint8_t DMA_CTRL;
+
+extern volatile uint8_t DMA_CH0_CTRLA;
+extern volatile uint8_t DMA_CH0_CTRLB;
+extern volatile uint8_t DMA_CH0_ADDRCTRL;
+extern volatile uint8_t DMA_CH0_TRIGSRC;
+extern volatile uint16_t DMA_CH0_TRFCNT;
+extern volatile uint8_t DMA_CH0_SRCADDR0;
+extern volatile uint8_t DMA_CH0_SRCADDR1;
+extern volatile uint8_t DMA_CH0_SRCADDR2;
+extern volatile uint8_t DMA_CH0_DESTADDR0;
+extern volatile uint8_t DMA_CH0_DESTADDR1;
+extern volatile uint8_t DMA_CH0_DESTADDR2;
+
+extern volatile uint8_t DMA_CH1_CTRLA;
+extern volatile uint8_t DMA_CH1_CTRLB;
+extern volatile uint8_t DMA_CH1_ADDRCTRL;
+extern volatile uint8_t DMA_CH1_TRIGSRC;
+extern volatile uint16_t DMA_CH1_TRFCNT;
+extern volatile uint8_t DMA_CH1_SRCADDR0;
+extern volatile uint8_t DMA_CH1_SRCADDR1;
+extern volatile uint8_t DMA_CH1_SRCADDR2;
+extern volatile uint8_t DMA_CH1_DESTADDR0;
+extern volatile uint8_t DMA_CH1_DESTADDR1;
+extern volatile uint8_t DMA_CH1_DESTADDR2;
+
+#define DMA_ENABLE_bm 0x80
+#define DMA_PRIMODE_CH0123_gc 0x03
+
+#define DMA_CH_ENABLE_bm 0x80
+#define DMA_CH_SINGLE_bm 0x04
+#define DMA_CH_BURSTLEN_1BYTE_gc 0x00
+#define DMA_CH_TRNIF_bm 0x10
+#define DMA_CH_TRNINTLVL_gm 0x03
+#define DMA_CH_TRNINTLVL_LO_gc 0x01
+
+#define DMA_CH_SRCRELOAD_NONE_gc 0x00
+#define DMA_CH_SRCDIR_FIXED_gc 0x00
+#define DMA_CH_DESTRELOAD_NONE_gc 0x00
+#define DMA_CH_DESTRELOAD_TRANSACTION_gc 0x0C
+#define DMA_CH_DESTDIR_FIXED_gc 0x00
+#define DMA_CH_DESTDIR_INC_gc 0x01
+
+#define DMA_CH_TRIGSRC_TCC1_OVF_gc 0x46
+#define DMA_CH_TRIGSRC_SPIC_gc 0x4A
+
+/************************************************************************/
+/* Interrupt controller                                                 */
+/************************************************************************/
+extern volatile uint8_t PMIC_CTRL;
+
+#define PMIC_LOLVLEN_bm 0x01
+#define PMIC_MEDLVLEN_bm 0x02
+#define PMIC_HILVLEN_bm 0x04
+#define PMIC_RREN_bm 0x80
+
+/************************************************************************/
+/* ADC (only used by the prototypes on cpu.h)                           */
+/************************************************************************/
+typedef struct
+{
+	volatile uint8_t CTRLA;
+} ADC_t;
+
+#endif /* _SIM_AVR_IO_H_ */
@@ -0,0 +1,8 @@
+#ifndef _SIM_UTIL_DELAY_H_
+#define _SIM_UTIL_DELAY_H_
+
+/* Busy waits only happen while initializing, so they take no simulated time */
+#define _delay_ms(ms)
+#define _delay_us(us)
+
+#endif /* _SIM_UTIL_DELAY_H_ */
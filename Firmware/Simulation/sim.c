@@ -0,0 +1,66 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+/************************************************************************/
+/* Main                                                                 */
+/************************************************************************/
+static void usage(void)
+{
+	fprintf(stderr, "usage: analog_input_sim [-q] [-o <events.csv>] <scenario>\n");
+	fprintf(stderr, "  -q  don't log the events, only print the summary\n");
+	fprintf(stderr, "  -o  log the events to a file instead of stdout\n");
+	exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *output = NULL;
+	bool quiet = false;
+	int i;
+
+	for (i = 1; i < argc && argv[i][0] == '-' && argv[i][1]; i++)
+	{
+		if (!strcmp(argv[i], "-q"))
+			quiet = true;
+		else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+			output = argv[++i];
+		else
+			usage();
+	}
+
+	if (i != argc - 1)
+		usage();
+
+	const char *scenario_name = argv[i];
+	FILE *f = strcmp(scenario_name, "-") ? fopen(scenario_name, "r") : stdin;
+	if (!f)
+	{
+		perror(scenario_name);
+		return 1;
+	}
+
+	if (!quiet)
+	{
+		sim_log = output ? fopen(output, "w") : stdout;
+		if (!sim_log)
+		{
+			perror(output);
+			return 1;
+		}
+	}
+
+	sim_hw_init();
+	hwbp_app_initialize();
+
+	sim_script_run(f, scenario_name);
+
+	sim_core_print_summary(stderr);
+
+	if (sim_log && sim_log != stdout)
+		fclose(sim_log);
+	if (f != stdin)
+		fclose(f);
+
+	return 0;
+}
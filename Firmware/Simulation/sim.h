@@ -0,0 +1,136 @@
+#ifndef _SIM_H_
+#define _SIM_H_
+#include <stdio.h>
+#include <avr/io.h>
+#include "hwbp_core.h"
+
+/************************************************************************/
+/* Simulated time                                                       */
+/************************************************************************/
+/* Time is counted in cycles of the 32 MHz CPU clock */
+#define SIM_CYCLES_PER_US 32ULL
+#define SIM_CYCLES_PER_SECOND 32000000ULL
+
+/* The Harp timestamp has a resolution of 32 us */
+#define SIM_CYCLES_PER_HARP_TICK (32 * SIM_CYCLES_PER_US)
+
+extern uint64_t sim_now;
+
+/************************************************************************/
+/* Firmware entry points                                                */
+/************************************************************************/
+void TCC0_OVF_vect(void);
+void PORTB_INT0_vect(void);
+void PORTD_INT0_vect(void);
+void DMA_CH0_vect(void);
+
+void hwbp_app_initialize(void);
+void send_acquired_samples(void);
+
+/************************************************************************/
+/* Hardware model (sim_hw.c)                                            */
+/************************************************************************/
+#define SIM_WAVE_CONST 0
+#define SIM_WAVE_SINE 1
+#define SIM_WAVE_SQUARE 2
+#define SIM_WAVE_RAMP 3
+#define SIM_WAVE_NOISE 4
+
+typedef struct
+{
+	uint8_t shape;
+	double offset;
+	double amplitude;
+	double frequency;
+	uint32_t seed;
+} sim_wave_t;
+
+typedef struct
+{
+	uint32_t conversions;
+	uint32_t missed_conversions;
+	uint32_t corrupted_reads;
+	uint32_t busy_interrupts;
+	uint32_t dma_interrupts;
+	uint32_t timer_interrupts;
+	uint32_t di0_interrupts;
+	uint32_t core_ticks;
+	uint32_t main_loop_runs;
+} sim_stats_t;
+
+extern sim_stats_t sim_stats;
+
+void sim_ports_init(void);
+void sim_ports_settle(void);
+
+void sim_hw_init(void);
+/* Applies what the firmware wrote to the peripherals, must be called after each entry point */
+void sim_hw_sync(void);
+/* Runs the hardware, the core timer and the main loop until the time t */
+void sim_run_until(uint64_t t);
+/* The main loop doesn't run until the time t, to simulate a busy or slow loop */
+void sim_stall_main_loop(uint64_t t);
+
+void sim_set_di0(bool level);
+void sim_set_wave(uint8_t channel, const sim_wave_t *wave);
+
+/************************************************************************/
+/* Core stub (sim_core.c)                                               */
+/************************************************************************/
+extern FILE *sim_log;
+
+/* Periodic callbacks of the core, called every 500 us */
+void sim_core_tick(void);
+
+/* Writes an application register the same way a Harp Write command does */
+bool sim_core_write(uint8_t add, const double *values, uint16_t n_values);
+/* Sets an application register as if restored from the EEPROM and runs core_callback_registers_were_reinitialized */
+bool sim_core_restore(uint8_t add, const double *values, uint16_t n_values);
+/* Reads an application register and logs its content */
+bool sim_core_read(uint8_t add);
+
+void sim_core_print_summary(FILE *f);
+
+/* Harp timestamp of the current simulated time */
+void sim_core_timestamp(uint32_t *seconds, uint16_t *useconds);
+/* Moves the timestamp to the given second, as a write to R_TIMESTAMP_SECOND does */
+void sim_core_set_timestamp_second(uint32_t seconds);
+
+/************************************************************************/
+/* Scenarios (sim_script.c)                                             */
+/************************************************************************/
+/* Runs the commands of a scenario, exits on the first error */
+void sim_script_run(FILE *f, const char *name);
+
+/************************************************************************/
+/* Harp link (sim_harp.c)                                               */
+/************************************************************************/
+/* Called with each complete message the device sends */
+typedef void (*sim_harp_tx_t)(const uint8_t *message, uint16_t length);
+
+typedef struct
+{
+	uint32_t commands;
+	uint32_t replies;
+	uint32_t events;
+	uint32_t errors;
+	uint32_t dropped_bytes;
+	uint32_t oversized;
+} sim_harp_stats_t;
+
+extern sim_harp_stats_t sim_harp_stats;
+
+/* Until this is called the device has no link and the Harp functions do nothing */
+void sim_harp_open(sim_harp_tx_t tx);
+/* Parses the bytes received from the host and replies to each complete command */
+void sim_harp_receive(const uint8_t *data, size_t n);
+/* Changes the operation mode, as a write to OperationControl does */
+void sim_harp_set_mode(uint8_t mode);
+
+/* Called by the core stub */
+void sim_harp_start(uint16_t who_am_i, uint8_t hwH, uint8_t hwL, uint8_t fwH, uint8_t fwL, uint8_t assembly, const uint8_t *device_name);
+void sim_harp_event(uint8_t add, uint32_t seconds, uint16_t micros);
+void sim_harp_new_second(void);
+void sim_harp_xmit(const uint8_t *data, uint8_t n);
+
+#endif /* _SIM_H_ */
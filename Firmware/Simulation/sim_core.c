@@ -0,0 +1,336 @@
+#include <string.h>
+#include "sim.h"
+#include "hwbp_core_types.h"
+#include "hwbp_core_com.h"
+#include "app.h"
+#include "app_ios_and_regs.h"
+
+/************************************************************************/
+/* Application registers                                                */
+/************************************************************************/
+extern AppRegs app_regs;
+extern uint8_t app_regs_type[];
+extern uint16_t app_regs_n_elements[];
+extern uint8_t *app_regs_pointer[];
+
+FILE *sim_log = NULL;
+
+/* Events sent by the firmware and their payload bytes, per application register */
+static uint32_t events_sent[APP_REGS_ADD_MAX - APP_REGS_ADD_MIN + 1];
+static uint32_t events_bytes[APP_REGS_ADD_MAX - APP_REGS_ADD_MIN + 1];
+
+/* Frames written to the UART on Speed Mode and their bytes */
+static uint32_t speed_frames;
+static uint32_t speed_bytes;
+
+/************************************************************************/
+/* Log                                                                  */
+/************************************************************************/
+/* Each line is: kind, time in seconds, address and the register's content */
+/* E is an event sent by the firmware and W or R the reply to a command     */
+/* S is a Speed Mode frame, with its sequence number instead of an address  */
+static void log_register(char kind, uint32_t seconds, uint32_t micros, uint8_t add, const char *status)
+{
+	if (!sim_log)
+		return;
+
+	uint8_t index = add - APP_REGS_ADD_MIN;
+	uint8_t type = app_regs_type[index];
+	uint8_t *content = app_regs_pointer[index];
+
+	fprintf(sim_log, "%c,%u.%06u,%u", kind, seconds, micros, add);
+
+	if (status)
+		fprintf(sim_log, ",%s", status);
+
+	for (uint16_t i = 0; i < app_regs_n_elements[index]; i++)
+	{
+		uint8_t *element = content + i * (type & MSK_TYPE_LEN);
+
+		switch (type)
+		{
+			case TYPE_U8: fprintf(sim_log, ",%u", *element); break;
+			case TYPE_I8: fprintf(sim_log, ",%d", *(int8_t*)element); break;
+			case TYPE_U16: fprintf(sim_log, ",%u", *(uint16_t*)element); break;
+			case TYPE_I16: fprintf(sim_log, ",%d", *(int16_t*)element); break;
+			case TYPE_U32: fprintf(sim_log, ",%u", *(uint32_t*)element); break;
+			case TYPE_I32: fprintf(sim_log, ",%d", *(int32_t*)element); break;
+			case TYPE_FLOAT: fprintf(sim_log, ",%g", *(float*)element); break;
+		}
+	}
+
+	fputc('\n', sim_log);
+}
+
+static void log_now(char kind, uint8_t add, const char *status)
+{
+	uint64_t us = sim_now / SIM_CYCLES_PER_US;
+	log_register(kind, us / 1000000, us % 1000000, add, status);
+}
+
+/************************************************************************/
+/* Timestamp                                                            */
+/************************************************************************/
+static uint32_t user_seconds;
+static uint16_t user_micros;
+
+/* Added to the simulated seconds when the host writes R_TIMESTAMP_SECOND */
+static uint32_t timestamp_offset = 0;
+
+static void read_core_timestamp(uint32_t *seconds, uint16_t *useconds)
+{
+	*seconds = sim_now / SIM_CYCLES_PER_SECOND + timestamp_offset;
+	*useconds = (sim_now % SIM_CYCLES_PER_SECOND) / SIM_CYCLES_PER_HARP_TICK;
+}
+
+void sim_core_timestamp(uint32_t *seconds, uint16_t *useconds)
+{
+	read_core_timestamp(seconds, useconds);
+}
+
+void sim_core_set_timestamp_second(uint32_t seconds)
+{
+	timestamp_offset = seconds - (uint32_t)(sim_now / SIM_CYCLES_PER_SECOND);
+}
+
+void core_func_mark_user_timestamp(void)
+{
+	read_core_timestamp(&user_seconds, &user_micros);
+}
+
+void core_func_read_user_timestamp(uint32_t *seconds, uint16_t *useconds)
+{
+	*seconds = user_seconds;
+	*useconds = user_micros;
+}
+
+void core_func_update_user_timestamp(uint32_t seconds, uint16_t useconds)
+{
+	user_seconds = seconds;
+	user_micros = useconds;
+}
+
+uint32_t core_func_read_R_TIMESTAMP_SECOND(void)
+{
+	return sim_now / SIM_CYCLES_PER_SECOND + timestamp_offset;
+}
+
+uint16_t core_func_read_R_TIMESTAMP_MICRO(void)
+{
+	return (sim_now % SIM_CYCLES_PER_SECOND) / SIM_CYCLES_PER_HARP_TICK;
+}
+
+/************************************************************************/
+/* Events                                                               */
+/************************************************************************/
+void core_func_send_event(uint8_t add, bool use_core_timestamp)
+{
+	uint32_t seconds;
+	uint16_t micros;
+
+	if (use_core_timestamp)
+		read_core_timestamp(&seconds, &micros);
+	else
+		core_func_read_user_timestamp(&seconds, &micros);
+
+	if (add >= APP_REGS_ADD_MIN && add <= APP_REGS_ADD_MAX)
+	{
+		events_sent[add - APP_REGS_ADD_MIN]++;
+		events_bytes[add - APP_REGS_ADD_MIN] += app_regs_n_elements[add - APP_REGS_ADD_MIN] * (app_regs_type[add - APP_REGS_ADD_MIN] & MSK_TYPE_LEN);
+		log_register('E', seconds, (uint32_t)micros * 32, add, NULL);
+		sim_harp_event(add, seconds, micros);
+	}
+}
+
+/************************************************************************/
+/* Speed Mode                                                           */
+/************************************************************************/
+void hwbp_uart_xmit(const uint8_t *dataIn0, uint8_t siz)
+{
+	speed_frames++;
+	speed_bytes += siz;
+
+	if (sim_log && siz >= 3 && dataIn0[0] == SPEED_FRAME_SYNC)
+	{
+		uint64_t us = sim_now / SIM_CYCLES_PER_US;
+		uint8_t checksum = 0;
+
+		for (uint8_t i = 0; i < siz - 1; i++)
+			checksum += dataIn0[i];
+
+		/* The checksum is checked here and not logged, a frame with a wrong one is marked */
+		fprintf(sim_log, "S,%u.%06u,%u", (uint32_t)(us / 1000000), (uint32_t)(us % 1000000), dataIn0[1]);
+
+		if (checksum != dataIn0[siz - 1])
+			fprintf(sim_log, ",bad checksum");
+
+		for (uint8_t i = 2; i + 1 < siz - 1; i += 2)
+			fprintf(sim_log, ",%d", (int16_t)(dataIn0[i] | (dataIn0[i + 1] << 8)));
+
+		fputc('\n', sim_log);
+	}
+
+	sim_harp_xmit(dataIn0, siz);
+}
+
+/************************************************************************/
+/* Core start and periodic callbacks                                    */
+/************************************************************************/
+void core_func_start_core (
+    const uint16_t who_am_i,
+    const uint8_t hwH,
+    const uint8_t hwL,
+    const uint8_t fwH,
+    const uint8_t fwL,
+    const uint8_t assembly,
+    uint8_t *pointer_to_app_regs,
+    const uint16_t app_mem_size_to_save,
+    const uint8_t num_of_app_registers,
+    const uint8_t *device_name,
+	const bool	device_is_able_to_repeat_clock,
+	const bool	device_is_able_to_generate_clock,
+	const uint8_t default_timestamp_offset
+	)
+{
+	sim_harp_start(who_am_i, hwH, hwL, fwH, fwL, assembly, device_name);
+
+	/* There is no EEPROM, so the registers always start with their default values */
+	core_callback_define_clock_default();
+	core_callback_initialize_hardware();
+	sim_hw_sync();
+	core_callback_reset_registers();
+	core_callback_registers_were_reinitialized();
+	sim_hw_sync();
+
+	/* The device starts in Active Mode with all the interrupt levels enabled */
+	core_callback_device_to_active();
+	PMIC_CTRL |= PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm;
+	sim_hw_sync();
+}
+
+void sim_core_tick(void)
+{
+	static uint32_t ticks = 0;
+
+	if (ticks && (ticks % 2000) == 0)
+	{
+		core_callback_t_new_second();
+		sim_harp_new_second();
+	}
+
+	core_callback_t_before_exec();
+
+	if (ticks & 1)
+		core_callback_t_500us();
+	else
+		core_callback_t_1ms();
+
+	core_callback_t_after_exec();
+
+	ticks++;
+}
+
+/************************************************************************/
+/* Commands                                                             */
+/************************************************************************/
+/* Packs the values with the register's type, returns false if they don't fit */
+static bool pack_values(uint8_t type, uint8_t *content, uint16_t max_bytes, const double *values, uint16_t n_values)
+{
+	uint8_t size = type & MSK_TYPE_LEN;
+
+	if (n_values * size > max_bytes)
+		return false;
+
+	for (uint16_t i = 0; i < n_values; i++)
+	{
+		uint8_t *element = content + i * size;
+
+		switch (type)
+		{
+			case TYPE_U8: *element = (uint8_t)values[i]; break;
+			case TYPE_I8: *(int8_t*)element = (int8_t)values[i]; break;
+			case TYPE_U16: *(uint16_t*)element = (uint16_t)values[i]; break;
+			case TYPE_I16: *(int16_t*)element = (int16_t)values[i]; break;
+			case TYPE_U32: *(uint32_t*)element = (uint32_t)values[i]; break;
+			case TYPE_I32: *(int32_t*)element = (int32_t)values[i]; break;
+			case TYPE_FLOAT: *(float*)element = (float)values[i]; break;
+		}
+	}
+
+	return true;
+}
+
+bool sim_core_write(uint8_t add, const double *values, uint16_t n_values)
+{
+	uint8_t content[MAX_PACKET_SIZE];
+
+	if (add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX)
+		return false;
+
+	uint8_t type = app_regs_type[add - APP_REGS_ADD_MIN];
+
+	if (!pack_values(type, content, sizeof(content), values, n_values))
+		return false;
+
+	bool ok = core_write_app_register(add, type, content, n_values);
+	sim_hw_sync();
+
+	log_now('W', add, ok ? "ok" : "error");
+	return ok;
+}
+
+bool sim_core_restore(uint8_t add, const double *values, uint16_t n_values)
+{
+	if (add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX)
+		return false;
+
+	uint8_t type = app_regs_type[add - APP_REGS_ADD_MIN];
+
+	if (n_values != app_regs_n_elements[add - APP_REGS_ADD_MIN])
+		return false;
+
+	/* The core copies the EEPROM content without the write handlers and then lets the application check it */
+	if (!pack_values(type, app_regs_pointer[add - APP_REGS_ADD_MIN], n_values * (type & MSK_TYPE_LEN), values, n_values))
+		return false;
+
+	core_callback_registers_were_reinitialized();
+	sim_hw_sync();
+
+	log_now('W', add, "restored");
+	return true;
+}
+
+bool sim_core_read(uint8_t add)
+{
+	if (add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX)
+		return false;
+
+	bool ok = core_read_app_register(add, app_regs_type[add - APP_REGS_ADD_MIN]);
+	sim_hw_sync();
+
+	log_now('R', add, ok ? "ok" : "error");
+	return ok;
+}
+
+void sim_core_print_summary(FILE *f)
+{
+	fprintf(f, "simulated time      %.6f s\n", (double)sim_now / SIM_CYCLES_PER_SECOND);
+	fprintf(f, "conversions         %u (%u ignored while busy)\n", sim_stats.conversions, sim_stats.missed_conversions);
+	fprintf(f, "corrupted reads     %u (readouts across the end of a conversion)\n", sim_stats.corrupted_reads);
+	fprintf(f, "BUSY interrupts     %u\n", sim_stats.busy_interrupts);
+	fprintf(f, "DMA interrupts      %u\n", sim_stats.dma_interrupts);
+	fprintf(f, "TCC0 interrupts     %u\n", sim_stats.timer_interrupts);
+	fprintf(f, "DI0 interrupts      %u\n", sim_stats.di0_interrupts);
+	fprintf(f, "core ticks          %u\n", sim_stats.core_ticks);
+	fprintf(f, "ring overflows      %u\n", app_regs.REG_RING_OVERFLOWS);
+	fprintf(f, "ring high water     %u\n", app_regs.REG_RING_HIGH_WATER);
+
+	for (uint8_t i = 0; i < sizeof(events_sent) / sizeof(events_sent[0]); i++)
+	{
+		if (events_sent[i])
+			fprintf(f, "events on %-3u       %u (%u payload bytes)\n", i + APP_REGS_ADD_MIN, events_sent[i], events_bytes[i]);
+	}
+
+	if (speed_frames)
+		fprintf(f, "speed mode frames   %u (%u bytes)\n", speed_frames, speed_bytes);
+}
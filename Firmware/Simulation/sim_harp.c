@@ -0,0 +1,458 @@
+#include <string.h>
+#include "sim.h"
+#include "hwbp_core_types.h"
+#include "hwbp_core_regs.h"
+#include "app_ios_and_regs.h"
+
+/************************************************************************/
+/* Application registers                                                */
+/************************************************************************/
+extern AppRegs app_regs;
+extern uint8_t app_regs_type[];
+extern uint16_t app_regs_n_elements[];
+extern uint8_t *app_regs_pointer[];
+
+/************************************************************************/
+/* Harp messages                                                        */
+/************************************************************************/
+/* Each message is: type, length, address, port, payload type, timestamp
+ * (when the payload type has HARP_HAS_TIMESTAMP), payload and checksum.
+ * The length counts the bytes after itself and the checksum is the sum
+ * of all the other bytes. The device always sends the timestamp.
+ */
+#define HARP_READ 1
+#define HARP_WRITE 2
+#define HARP_EVENT 3
+#define HARP_ERROR 0x08
+
+#define HARP_HAS_TIMESTAMP 0x10
+#define HARP_PORT_DEVICE 255
+
+/* Header without the timestamp and the checksum */
+#define HARP_HEADER_SIZE 5
+#define HARP_TIMESTAMP_SIZE 6
+
+sim_harp_stats_t sim_harp_stats;
+
+static sim_harp_tx_t tx_func = NULL;
+
+static uint8_t rx[MAX_PACKET_SIZE + 2];
+static uint16_t rx_count = 0;
+
+/************************************************************************/
+/* Common registers                                                     */
+/************************************************************************/
+static struct CommonBank common;
+
+typedef struct
+{
+	uint8_t type;
+	uint8_t n_elements;
+	uint8_t *content;
+} common_reg_t;
+
+static const common_reg_t common_regs[COMMON_BANK_ADD_MAX + 1] =
+{
+	{TYPE_U16, 1, (uint8_t*)&common.R_WHO_AM_I},
+	{TYPE_U8, 1, &common.R_HW_VERSION_H},
+	{TYPE_U8, 1, &common.R_HW_VERSION_L},
+	{TYPE_U8, 1, &common.R_ASSEMBLY_VERSION},
+	{TYPE_U8, 1, &common.R_CORE_VERSION_H},
+	{TYPE_U8, 1, &common.R_CORE_VERSION_L},
+	{TYPE_U8, 1, &common.R_FW_VERSION_H},
+	{TYPE_U8, 1, &common.R_FW_VERSION_L},
+	{TYPE_U32, 1, (uint8_t*)&common.R_TIMESTAMP_SECOND},
+	{TYPE_U16, 1, (uint8_t*)&common.R_TIMESTAMP_MICRO},
+	{TYPE_U8, 1, &common.R_OPERATION_CTRL},
+	{TYPE_U8, 1, &common.R_RESET_DEV},
+	{TYPE_U8, 25, common.R_DEVICE_NAME},
+	{TYPE_U16, 1, (uint8_t*)&common.R_SERIAL_NUMBER},
+	{TYPE_U8, 1, &common.R_CLOCK_CONFIG},
+	{TYPE_U8, 1, &common.R_TIMESTAMP_OFFSET},
+	{TYPE_U8, 16, common.R_UID},
+	{TYPE_U8, 8, common.R_TAG},
+	{TYPE_U16, 1, (uint8_t*)&common.R_HEARTBEAT},
+	{TYPE_U8, 32, common.R_VERSION}
+};
+
+/* The core library linked on the device is libATxmega128A4U-1.15.a */
+#define CORE_VERSION_H 1
+#define CORE_VERSION_L 15
+
+void sim_harp_start(uint16_t who_am_i, uint8_t hwH, uint8_t hwL, uint8_t fwH, uint8_t fwL, uint8_t assembly, const uint8_t *device_name)
+{
+	memset(&common, 0, sizeof(common));
+
+	common.R_WHO_AM_I = who_am_i;
+	common.R_HW_VERSION_H = hwH;
+	common.R_HW_VERSION_L = hwL;
+	common.R_ASSEMBLY_VERSION = assembly;
+	common.R_CORE_VERSION_H = CORE_VERSION_H;
+	common.R_CORE_VERSION_L = CORE_VERSION_L;
+	common.R_FW_VERSION_H = fwH;
+	common.R_FW_VERSION_L = fwL;
+	strncpy((char*)common.R_DEVICE_NAME, (const char*)device_name, sizeof(common.R_DEVICE_NAME) - 1);
+	snprintf((char*)common.R_VERSION, sizeof(common.R_VERSION), "sim %u.%u core %u.%u", fwH, fwL, CORE_VERSION_H, CORE_VERSION_L);
+
+	/* A device boots on Standby Mode and only sends events when Active */
+	common.R_OPERATION_CTRL = GM_OP_MODE_STANDBY | B_OPLEDEN | B_VISUALEN;
+}
+
+void sim_harp_open(sim_harp_tx_t tx)
+{
+	tx_func = tx;
+	rx_count = 0;
+	memset(&sim_harp_stats, 0, sizeof(sim_harp_stats));
+}
+
+static bool is_active(void)
+{
+	return (common.R_OPERATION_CTRL & MSK_OP_MODE) != GM_OP_MODE_STANDBY;
+}
+
+/************************************************************************/
+/* Transmission                                                         */
+/************************************************************************/
+static void send_message(uint8_t message_type, uint8_t add, uint8_t type, const uint8_t *content, uint16_t n_bytes, uint32_t seconds, uint16_t micros)
+{
+	uint8_t message[MAX_PACKET_SIZE + 2];
+	uint16_t length = HARP_HEADER_SIZE + HARP_TIMESTAMP_SIZE + n_bytes + 1;
+	uint8_t checksum = 0;
+
+	if (!tx_func)
+		return;
+
+	if (length > sizeof(message))
+	{
+		sim_harp_stats.oversized++;
+		return;
+	}
+
+	message[0] = message_type;
+	message[1] = length - 2;
+	message[2] = add;
+	message[3] = HARP_PORT_DEVICE;
+	message[4] = type | HARP_HAS_TIMESTAMP;
+	memcpy(message + HARP_HEADER_SIZE, &seconds, 4);
+	memcpy(message + HARP_HEADER_SIZE + 4, &micros, 2);
+	memcpy(message + HARP_HEADER_SIZE + HARP_TIMESTAMP_SIZE, content, n_bytes);
+
+	for (uint16_t i = 0; i < length - 1; i++)
+		checksum += message[i];
+	message[length - 1] = checksum;
+
+	if (message_type == HARP_EVENT)
+		sim_harp_stats.events++;
+	else
+		sim_harp_stats.replies++;
+
+	tx_func(message, length);
+}
+
+/* Sends the content of a register, either common or from the application */
+static void send_register(uint8_t message_type, uint8_t add)
+{
+	uint32_t seconds;
+	uint16_t micros;
+
+	sim_core_timestamp(&seconds, &micros);
+
+	if (add <= COMMON_BANK_ADD_MAX)
+	{
+		const common_reg_t *reg = &common_regs[add];
+
+		if (add == ADD_R_TIMESTAMP_SECOND || add == ADD_R_TIMESTAMP_MICRO)
+		{
+			common.R_TIMESTAMP_SECOND = seconds;
+			common.R_TIMESTAMP_MICRO = micros;
+		}
+
+		send_message(message_type, add, reg->type, reg->content, reg->n_elements * (reg->type & MSK_TYPE_LEN), seconds, micros);
+	}
+	else
+	{
+		uint8_t index = add - APP_REGS_ADD_MIN;
+		uint8_t type = app_regs_type[index];
+
+		send_message(message_type, add, type, app_regs_pointer[index], app_regs_n_elements[index] * (type & MSK_TYPE_LEN), seconds, micros);
+	}
+}
+
+static void reply(uint8_t message_type, uint8_t add, bool ok)
+{
+	if (common.R_OPERATION_CTRL & B_MUTE_RPL)
+		return;
+
+	if (!ok)
+		sim_harp_stats.errors++;
+
+	send_register(message_type | (ok ? 0 : HARP_ERROR), add);
+}
+
+/* Errors on registers that don't exist have an empty payload */
+static void reply_unknown(uint8_t message_type, uint8_t add, uint8_t type)
+{
+	uint32_t seconds;
+	uint16_t micros;
+
+	sim_harp_stats.errors++;
+
+	if (common.R_OPERATION_CTRL & B_MUTE_RPL)
+		return;
+
+	sim_core_timestamp(&seconds, &micros);
+	send_message(message_type | HARP_ERROR, add, type, NULL, 0, seconds, micros);
+}
+
+void sim_harp_event(uint8_t add, uint32_t seconds, uint16_t micros)
+{
+	if (!tx_func || !is_active())
+		return;
+
+	uint8_t index = add - APP_REGS_ADD_MIN;
+	uint8_t type = app_regs_type[index];
+
+	send_message(HARP_EVENT, add, type, app_regs_pointer[index], app_regs_n_elements[index] * (type & MSK_TYPE_LEN), seconds, micros);
+}
+
+/* The heartbeat is sent on every mode and tells if the device is active */
+void sim_harp_new_second(void)
+{
+	if (!tx_func)
+		return;
+
+	if ((common.R_OPERATION_CTRL & B_ALIVE_EN) && is_active())
+		send_register(HARP_EVENT, ADD_R_TIMESTAMP_SECOND);
+
+	if (common.R_OPERATION_CTRL & B_HEARTBEAT_EN)
+	{
+		common.R_HEARTBEAT = is_active() ? B_IS_ACTIVE : 0;
+		send_register(HARP_EVENT, ADD_R_HEARTBEAT);
+	}
+}
+
+/************************************************************************/
+/* Common registers' commands                                           */
+/************************************************************************/
+static void dump(void)
+{
+	for (uint8_t add = 0; add <= COMMON_BANK_ADD_MAX; add++)
+		send_register(HARP_READ, add);
+
+	for (uint16_t add = APP_REGS_ADD_MIN; add <= APP_REGS_ADD_MAX; add++)
+		send_register(HARP_READ, add);
+}
+
+static void write_operation_ctrl(uint8_t value)
+{
+	uint8_t mode = common.R_OPERATION_CTRL & MSK_OP_MODE;
+	uint8_t new_mode = value & MSK_OP_MODE;
+
+	/* The dump is a command, the bit always reads as zero */
+	common.R_OPERATION_CTRL = value & ~B_DUMP;
+
+	if (new_mode != mode)
+	{
+		switch (new_mode)
+		{
+			case GM_OP_MODE_STANDBY: core_callback_device_to_standby(); break;
+			case GM_OP_MODE_ACTIVE: core_callback_device_to_active(); break;
+			case GM_OP_MODE_SPEED: core_callback_device_to_speed(); break;
+		}
+		sim_hw_sync();
+	}
+}
+
+void sim_harp_set_mode(uint8_t mode)
+{
+	write_operation_ctrl((common.R_OPERATION_CTRL & ~MSK_OP_MODE) | (mode & MSK_OP_MODE));
+}
+
+/************************************************************************/
+/* Speed Mode                                                           */
+/************************************************************************/
+/* The application writes its frames to the link without the Harp message */
+void sim_harp_xmit(const uint8_t *data, uint8_t n)
+{
+	if (tx_func)
+		tx_func(data, n);
+}
+
+bool core_bool_speed_mode_is_in_use(void)
+{
+	return (common.R_OPERATION_CTRL & MSK_OP_MODE) == GM_OP_MODE_SPEED;
+}
+
+void core_func_leave_speed_mode_and_go_to_standby_mode(void)
+{
+	sim_harp_set_mode(GM_OP_MODE_STANDBY);
+}
+
+static bool write_common_register(uint8_t add, uint8_t *content, uint16_t n_elements)
+{
+	switch (add)
+	{
+		case ADD_R_TIMESTAMP_SECOND:
+		{
+			uint32_t seconds;
+			memcpy(&seconds, content, 4);
+			sim_core_set_timestamp_second(seconds);
+			return true;
+		}
+
+		case ADD_R_OPERATION_CTRL:
+			write_operation_ctrl(content[0]);
+			return true;
+
+		case ADD_R_RESET_DEV:
+			/* There is no EEPROM, so any reset goes back to the default values */
+			if (content[0] & (B_RST_DEF | B_RST_EE | B_BOOT_DEF | B_BOOT_EE))
+			{
+				core_callback_reset_registers();
+				core_callback_registers_were_reinitialized();
+				sim_hw_sync();
+			}
+			return true;
+
+		case ADD_R_DEVICE_NAME:
+			memcpy(common.R_DEVICE_NAME, content, n_elements);
+			common.R_DEVICE_NAME[sizeof(common.R_DEVICE_NAME) - 1] = 0;
+			return true;
+
+		case ADD_R_SERIAL_NUMBER:
+			memcpy(&common.R_SERIAL_NUMBER, content, 2);
+			return true;
+
+		case ADD_R_CONFIG:
+			common.R_CLOCK_CONFIG = content[0];
+			return true;
+
+		case ADD_R_TIMESTAMP_OFFSET:
+			common.R_TIMESTAMP_OFFSET = content[0];
+			return true;
+
+		case ADD_R_TAG:
+			memcpy(common.R_TAG, content, n_elements);
+			return true;
+	}
+
+	/* Read only */
+	return false;
+}
+
+/************************************************************************/
+/* Reception                                                            */
+/************************************************************************/
+static void process_message(uint8_t *message, uint16_t length)
+{
+	uint8_t message_type = message[0] & ~HARP_ERROR;
+	uint8_t add = message[2];
+	uint8_t type = message[4] & ~HARP_HAS_TIMESTAMP;
+	uint16_t header = HARP_HEADER_SIZE + ((message[4] & HARP_HAS_TIMESTAMP) ? HARP_TIMESTAMP_SIZE : 0);
+	uint8_t *content = message + header;
+	uint16_t n_bytes = length - header - 1;
+	uint8_t size = type & MSK_TYPE_LEN;
+
+	sim_harp_stats.commands++;
+
+	bool common_add = add <= COMMON_BANK_ADD_MAX;
+	bool app_add = add >= APP_REGS_ADD_MIN && add <= APP_REGS_ADD_MAX;
+
+	if (!common_add && !app_add)
+	{
+		reply_unknown(message_type, add, type);
+		return;
+	}
+
+	uint8_t reg_type = common_add ? common_regs[add].type : app_regs_type[add - APP_REGS_ADD_MIN];
+
+	if (message_type == HARP_READ)
+	{
+		if (type != reg_type)
+		{
+			reply(HARP_READ, add, false);
+			return;
+		}
+
+		if (app_add)
+		{
+			core_read_app_register(add, type);
+			sim_hw_sync();
+		}
+
+		reply(HARP_READ, add, true);
+	}
+	else if (message_type == HARP_WRITE)
+	{
+		uint16_t n_elements = size ? n_bytes / size : 0;
+
+		if (type != reg_type || !n_elements || n_elements * size != n_bytes)
+		{
+			reply(HARP_WRITE, add, false);
+			return;
+		}
+
+		if (common_add)
+		{
+			/* The name and the tag may be shorter than the register */
+			bool partial = add == ADD_R_DEVICE_NAME || add == ADD_R_TAG;
+			bool ok = partial ? n_elements <= common_regs[add].n_elements : n_elements == common_regs[add].n_elements;
+
+			ok = ok && write_common_register(add, content, n_elements);
+			reply(HARP_WRITE, add, ok);
+
+			/* The dump follows the reply */
+			if (ok && add == ADD_R_OPERATION_CTRL && (content[0] & B_DUMP))
+				dump();
+			return;
+		}
+
+		bool ok = core_write_app_register(add, type, content, n_elements);
+		sim_hw_sync();
+		reply(HARP_WRITE, add, ok);
+	}
+	else
+	{
+		reply_unknown(message_type, add, type);
+	}
+}
+
+void sim_harp_receive(const uint8_t *data, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+	{
+		rx[rx_count++] = data[i];
+
+		/* Resynchronizes one byte at a time until a valid message is found */
+		while (rx_count >= 2)
+		{
+			uint16_t length = rx[1] + 2;
+			bool valid = length >= HARP_HEADER_SIZE + 1;
+
+			if (valid && rx_count < length)
+				break;
+
+			if (valid)
+			{
+				uint8_t checksum = 0;
+
+				for (uint16_t j = 0; j < length - 1; j++)
+					checksum += rx[j];
+
+				valid = checksum == rx[length - 1];
+			}
+
+			if (!valid)
+			{
+				sim_harp_stats.dropped_bytes++;
+				memmove(rx, rx + 1, --rx_count);
+				continue;
+			}
+
+			process_message(rx, length);
+
+			rx_count -= length;
+			memmove(rx, rx + length, rx_count);
+		}
+	}
+}
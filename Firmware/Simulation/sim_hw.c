@@ -0,0 +1,595 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "cpu.h"
+
+/************************************************************************/
+/* Peripheral registers                                                 */
+/************************************************************************/
+PORT_t PORTA, PORTB, PORTC, PORTD, PORTE;
+uint16_t sim_port_writes = 0;
+
+volatile uint8_t TCC0_CTRLA, TCC0_CTRLB, TCC0_CTRLFSET, TCC0_INTCTRLA;
+volatile uint16_t TCC0_PER, TCC0_PERBUF, TCC0_CCA, TCC0_CCB;
+
+volatile uint8_t TCD0_CTRLA, TCD0_CTRLB, TCD0_CTRLD, TCD0_INTFLAGS;
+volatile uint16_t TCD0_CNT, TCD0_PER, TCD0_CCA;
+volatile uint8_t TCC1_CTRLA;
+volatile uint16_t TCC1_CNT, TCC1_PER;
+
+volatile uint8_t EVSYS_CH7MUX;
+
+volatile uint8_t SPIC_CTRL, SPIC_DATA;
+
+volatile uint8_t DMA_CTRL;
+volatile uint8_t DMA_CH0_CTRLA, DMA_CH0_CTRLB, DMA_CH0_ADDRCTRL, DMA_CH0_TRIGSRC;
+volatile uint16_t DMA_CH0_TRFCNT;
+volatile uint8_t DMA_CH0_SRCADDR0, DMA_CH0_SRCADDR1, DMA_CH0_SRCADDR2;
+volatile uint8_t DMA_CH0_DESTADDR0, DMA_CH0_DESTADDR1, DMA_CH0_DESTADDR2;
+volatile uint8_t DMA_CH1_CTRLA, DMA_CH1_CTRLB, DMA_CH1_ADDRCTRL, DMA_CH1_TRIGSRC;
+volatile uint16_t DMA_CH1_TRFCNT;
+volatile uint8_t DMA_CH1_SRCADDR0, DMA_CH1_SRCADDR1, DMA_CH1_SRCADDR2;
+volatile uint8_t DMA_CH1_DESTADDR0, DMA_CH1_DESTADDR1, DMA_CH1_DESTADDR2;
+
+volatile uint8_t PMIC_CTRL;
+
+uint64_t sim_now = 0;
+sim_stats_t sim_stats;
+
+/************************************************************************/
+/* Ports                                                                */
+/************************************************************************/
+#define SIM_N_PORTS 5
+
+static PORT_t *const ports[SIM_N_PORTS] = {&PORTA, &PORTB, &PORTC, &PORTD, &PORTE};
+
+/* Levels driven from outside on the pins configured as inputs */
+static uint8_t input_levels[SIM_N_PORTS];
+
+static uint16_t settled_writes = 0;
+
+static uint8_t port_index(PORT_t *port)
+{
+	for (uint8_t i = 0; i < SIM_N_PORTS; i++)
+	{
+		if (ports[i] == port)
+			return i;
+	}
+
+	return 0;
+}
+
+void sim_ports_init(void)
+{
+	for (uint8_t i = 0; i < SIM_N_PORTS; i++)
+	{
+		memset((void*)ports[i]->OUTSET_WRITES, 0xFF, sizeof(ports[i]->OUTSET_WRITES));
+		memset((void*)ports[i]->OUTCLR_WRITES, 0xFF, sizeof(ports[i]->OUTCLR_WRITES));
+		memset((void*)ports[i]->OUTTGL_WRITES, 0xFF, sizeof(ports[i]->OUTTGL_WRITES));
+	}
+
+	settled_writes = sim_port_writes;
+}
+
+/* Up to SIM_PORT_WRITES strobes can be written between two calls */
+void sim_ports_settle(void)
+{
+	while (settled_writes != sim_port_writes)
+	{
+		uint16_t i = settled_writes++ & (SIM_PORT_WRITES - 1);
+
+		for (uint8_t p = 0; p < SIM_N_PORTS; p++)
+		{
+			PORT_t *port = ports[p];
+
+			if (port->OUTSET_WRITES[i] != SIM_PORT_NO_WRITE)
+			{
+				port->OUT |= port->OUTSET_WRITES[i];
+				port->OUTSET_WRITES[i] = SIM_PORT_NO_WRITE;
+			}
+			if (port->OUTCLR_WRITES[i] != SIM_PORT_NO_WRITE)
+			{
+				port->OUT &= ~port->OUTCLR_WRITES[i];
+				port->OUTCLR_WRITES[i] = SIM_PORT_NO_WRITE;
+			}
+			if (port->OUTTGL_WRITES[i] != SIM_PORT_NO_WRITE)
+			{
+				port->OUT ^= port->OUTTGL_WRITES[i];
+				port->OUTTGL_WRITES[i] = SIM_PORT_NO_WRITE;
+			}
+		}
+	}
+
+	for (uint8_t p = 0; p < SIM_N_PORTS; p++)
+	{
+		ports[p]->IN = (ports[p]->OUT & ports[p]->DIR) | (input_levels[p] & ~ports[p]->DIR);
+	}
+}
+
+/************************************************************************/
+/* IO functions from cpu.h                                              */
+/************************************************************************/
+void io_pin2in(PORT_t* port, uint8_t pin, uint8_t pull, uint8_t sense)
+{
+	port->DIR &= ~(1 << pin);
+	(&port->PIN0CTRL)[pin] = pull | sense;
+
+	/* Nothing is connected when starting, so the pull-ups set the level */
+	if (pull == PULL_IO_UP)
+		input_levels[port_index(port)] |= (1 << pin);
+
+	sim_ports_settle();
+}
+
+void io_pin2out(PORT_t* port, uint8_t pin, uint8_t out, bool input_en)
+{
+	port->DIR |= (1 << pin);
+	(&port->PIN0CTRL)[pin] = out;
+
+	sim_ports_settle();
+}
+
+void io_set_int(PORT_t* port, uint8_t int_level, uint8_t int_n, uint8_t mask, bool reset_mask)
+{
+	if (int_n == 0)
+	{
+		port->INTCTRL = (port->INTCTRL & ~0x03) | int_level;
+		port->INT0MASK = reset_mask ? mask : (port->INT0MASK | mask);
+	}
+	else
+	{
+		port->INTCTRL = (port->INTCTRL & ~0x0C) | (int_level << 2);
+		port->INT1MASK = reset_mask ? mask : (port->INT1MASK | mask);
+	}
+}
+
+/************************************************************************/
+/* Interrupts                                                           */
+/************************************************************************/
+static bool level_enabled(uint8_t level)
+{
+	switch (level)
+	{
+		case INT_LEVEL_LOW: return PMIC_CTRL & PMIC_LOLVLEN_bm;
+		case INT_LEVEL_MED: return PMIC_CTRL & PMIC_MEDLVLEN_bm;
+		case INT_LEVEL_HIGH: return PMIC_CTRL & PMIC_HILVLEN_bm;
+	}
+
+	return false;
+}
+
+static void update_counters(void);
+
+static void port_interrupt(PORT_t *port)
+{
+	update_counters();
+
+	if (port == &PORTB)
+	{
+		sim_stats.di0_interrupts++;
+		PORTB_INT0_vect();
+	}
+	else if (port == &PORTD)
+	{
+		sim_stats.busy_interrupts++;
+		PORTD_INT0_vect();
+	}
+
+	sim_hw_sync();
+}
+
+static void set_input(PORT_t *port, uint8_t pin, bool level)
+{
+	uint8_t p = port_index(port);
+	uint8_t mask = 1 << pin;
+	uint8_t before = port->IN & mask;
+
+	if (level)
+		input_levels[p] |= mask;
+	else
+		input_levels[p] &= ~mask;
+
+	sim_ports_settle();
+
+	uint8_t after = port->IN & mask;
+
+	if (before == after || !(port->INT0MASK & mask))
+		return;
+
+	uint8_t sense = (&port->PIN0CTRL)[pin] & PORT_ISC_gm;
+
+	if (sense == PORT_ISC_BOTHEDGES_gc ||
+		(sense == PORT_ISC_RISING_gc && after) ||
+		(sense == PORT_ISC_FALLING_gc && !after))
+	{
+		if (level_enabled(port->INTCTRL & 0x03))
+			port_interrupt(port);
+	}
+}
+
+void sim_set_di0(bool level)
+{
+	set_input(&PORTB, 0, level);
+}
+
+/************************************************************************/
+/* Timers                                                               */
+/************************************************************************/
+static const uint16_t clock_divider[] = {0, 1, 2, 4, 8, 64, 256, 1024};
+
+static uint16_t timer_divider(uint8_t ctrla)
+{
+	return ((ctrla & TC_CLKSEL_gm) < 8) ? clock_divider[ctrla & TC_CLKSEL_gm] : 0;
+}
+
+static bool tcc0_running = false;
+static uint64_t tcc0_next_update;
+static uint16_t tcc0_perbuf_written = 0;
+static bool tcc0_perbuf_valid = false;
+
+static bool tcd0_running = false;
+static uint64_t tcd0_start;
+
+static uint16_t tcd0_count(void)
+{
+	return (uint16_t)((sim_now - tcd0_start) / timer_divider(TCD0_CTRLA));
+}
+
+static void update_counters(void)
+{
+	if (tcd0_running)
+		TCD0_CNT = tcd0_count();
+}
+
+static void sync_timers(void)
+{
+	uint16_t divider = timer_divider(TCC0_CTRLA);
+
+	if ((TCC0_CTRLFSET & TC_CMD_gm) == TC_CMD_RESTART_gc)
+	{
+		TCC0_CTRLFSET = 0;
+		tcc0_next_update = sim_now + (uint64_t)(TCC0_PER + 1) * divider;
+	}
+
+	if (divider && !tcc0_running)
+	{
+		tcc0_running = true;
+		tcc0_next_update = sim_now + (uint64_t)(TCC0_PER + 1) * divider;
+	}
+	else if (!divider)
+	{
+		tcc0_running = false;
+	}
+
+	/* The buffer is only copied to PER on the next update */
+	if (TCC0_PERBUF != tcc0_perbuf_written)
+	{
+		tcc0_perbuf_written = TCC0_PERBUF;
+		tcc0_perbuf_valid = true;
+	}
+
+	if (timer_divider(TCD0_CTRLA) && !tcd0_running)
+	{
+		tcd0_running = true;
+		tcd0_start = sim_now;
+	}
+	else if (!timer_divider(TCD0_CTRLA))
+	{
+		tcd0_running = false;
+	}
+}
+
+/************************************************************************/
+/* AD7606                                                               */
+/************************************************************************/
+/* Maximum conversion time for each oversampling ratio, in CPU cycles */
+/* The oversampling ratio is read from the OS0, OS1 and OS2 pins      */
+static const uint32_t conversion_cycles[] = {
+	4150 * SIM_CYCLES_PER_US / 1000,
+	9100 * SIM_CYCLES_PER_US / 1000,
+	18800 * SIM_CYCLES_PER_US / 1000,
+	39000 * SIM_CYCLES_PER_US / 1000,
+	78000 * SIM_CYCLES_PER_US / 1000,
+	158000 * SIM_CYCLES_PER_US / 1000,
+	315000 * SIM_CYCLES_PER_US / 1000,
+	4150 * SIM_CYCLES_PER_US / 1000
+};
+
+static sim_wave_t waves[4];
+static uint32_t noise_state[4];
+
+static bool converting = false;
+static uint64_t conversion_end;
+static int16_t converted[4];
+static int16_t output[4];
+static bool dma_busy = false;
+static bool previous_convsta = false;
+
+void sim_set_wave(uint8_t channel, const sim_wave_t *wave)
+{
+	waves[channel] = *wave;
+	noise_state[channel] = wave->seed ? wave->seed : channel + 1;
+}
+
+static int16_t wave_value(uint8_t channel)
+{
+	sim_wave_t *wave = &waves[channel];
+	double t = (double)sim_now / SIM_CYCLES_PER_SECOND;
+	double phase = wave->frequency * t - floor(wave->frequency * t);
+	double value = wave->offset;
+
+	switch (wave->shape)
+	{
+		case SIM_WAVE_SINE:
+			value += wave->amplitude * sin(2 * M_PI * phase);
+			break;
+
+		case SIM_WAVE_SQUARE:
+			value += (phase < 0.5) ? wave->amplitude : -wave->amplitude;
+			break;
+
+		case SIM_WAVE_RAMP:
+			value += wave->amplitude * (2 * phase - 1);
+			break;
+
+		case SIM_WAVE_NOISE:
+			/* xorshift32, so the runs are repeatable */
+			noise_state[channel] ^= noise_state[channel] << 13;
+			noise_state[channel] ^= noise_state[channel] >> 17;
+			noise_state[channel] ^= noise_state[channel] << 5;
+			value += wave->amplitude * ((double)noise_state[channel] / 2147483648.0 - 1);
+			break;
+	}
+
+	value = round(value);
+
+	if (value > INT16_MAX)
+		return INT16_MAX;
+	if (value < INT16_MIN)
+		return INT16_MIN;
+	return (int16_t)value;
+}
+
+static void start_conversion(void)
+{
+	sim_stats.conversions++;
+
+	/* TCD0 captures the rising edge of CONVSTA through the event channel 7 */
+	if (tcd0_running &&
+		EVSYS_CH7MUX == EVSYS_CHMUX_PORTC_PIN0_gc &&
+		(TCD0_CTRLB & TC0_CCAEN_bm) &&
+		(TCD0_CTRLD & TC_EVACT_gm) == TC_EVACT_CAPT_gc &&
+		(TCD0_CTRLD & TC_EVSEL_gm) == TC_EVSEL_CH7_gc)
+	{
+		TCD0_CCA = tcd0_count();
+		TCD0_INTFLAGS |= TC0_CCAIF_bm;
+	}
+
+	/* The ADC ignores a new conversion start while converting or in reset */
+	if (converting || (PORTD.OUT & (1 << 0)))
+	{
+		sim_stats.missed_conversions++;
+		return;
+	}
+
+	/* The inputs are held when the conversion starts */
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		converted[i] = wave_value(i);
+	}
+
+	converting = true;
+	conversion_end = sim_now + conversion_cycles[(PORTD.OUT >> 2) & 0x07];
+
+	set_input(&PORTD, 1, true);
+}
+
+static void end_conversion(void)
+{
+	converting = false;
+
+	/* The output registers are updated at the end of the conversion */
+	/* A readout across the update mixes two conversions */
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		output[i] = converted[i];
+	}
+
+	if (dma_busy)
+		sim_stats.corrupted_reads++;
+
+	/* The falling edge of BUSY fires PORTD_INT0_vect */
+	set_input(&PORTD, 1, false);
+}
+
+/************************************************************************/
+/* SPI and DMA                                                          */
+/************************************************************************/
+extern uint8_t adc_dma_buffer[];
+
+static uint64_t dma_end;
+
+/* Cycles to shift a byte */
+static uint32_t spi_byte_cycles(void)
+{
+	static const uint8_t spi_divider[] = {4, 16, 64, 128};
+	uint32_t divider = spi_divider[SPIC_CTRL & 0x03];
+
+	if (SPIC_CTRL & SPI_CLK2X_bm)
+		divider /= 2;
+
+	return divider * 8;
+}
+
+/* Cycles between the bytes clocked by DMA CH1, on the TCC1 overflow */
+static uint32_t dma_pacing_cycles(void)
+{
+	return (DMA_CH1_TRIGSRC == DMA_CH_TRIGSRC_TCC1_OVF_gc) ? (uint32_t)(TCC1_PER + 1) * timer_divider(TCC1_CTRLA) : 0;
+}
+
+static void sync_dma(void)
+{
+	if (!dma_busy &&
+		(DMA_CTRL & DMA_ENABLE_bm) &&
+		(SPIC_CTRL & SPI_ENABLE_bm) &&
+		(DMA_CH0_CTRLA & DMA_CH_ENABLE_bm))
+	{
+		uint32_t pacing = dma_pacing_cycles();
+
+		/* A byte written before the previous one is shifted out is lost and the readout never ends */
+		if (pacing <= spi_byte_cycles())
+		{
+			fprintf(stderr, "DMA CH1 is not paced by TCC1 or its period is shorter than a byte on the SPI\n");
+			exit(1);
+		}
+
+		/* The last byte is read by CH0 a few cycles after it is shifted */
+		dma_busy = true;
+		dma_end = sim_now + (uint64_t)(DMA_CH0_TRFCNT - 1) * pacing + spi_byte_cycles() + 8;
+	}
+}
+
+static void end_dma(void)
+{
+	/* The ADC shifts the channels out with the most significant byte first */
+	/* Nothing drives MISO if the chip select is not asserted */
+	bool selected = !(PORTC.OUT & (1 << 4));
+
+	for (uint16_t i = 0; i < DMA_CH0_TRFCNT; i++)
+	{
+		uint16_t value = (uint16_t)output[i / 2];
+		adc_dma_buffer[i] = selected ? ((i & 1) ? (value & 0xFF) : (value >> 8)) : 0xFF;
+	}
+
+	dma_busy = false;
+	DMA_CH0_TRFCNT = 0;
+	DMA_CH1_TRFCNT = 0;
+	DMA_CH0_CTRLA &= ~DMA_CH_ENABLE_bm;
+	DMA_CH1_CTRLA &= ~DMA_CH_ENABLE_bm;
+	DMA_CH0_CTRLB |= DMA_CH_TRNIF_bm;
+
+	if (level_enabled(DMA_CH0_CTRLB & DMA_CH_TRNINTLVL_gm))
+	{
+		update_counters();
+		sim_stats.dma_interrupts++;
+		DMA_CH0_vect();
+	}
+
+	/* The flag is cleared by writing one to it */
+	DMA_CH0_CTRLB &= ~DMA_CH_TRNIF_bm;
+
+	sim_hw_sync();
+}
+
+/************************************************************************/
+/* Synchronization and main loop                                        */
+/************************************************************************/
+void sim_hw_init(void)
+{
+	sim_ports_init();
+	memset(&sim_stats, 0, sizeof(sim_stats));
+}
+
+void sim_hw_sync(void)
+{
+	sim_ports_settle();
+	sync_timers();
+	sync_dma();
+
+	/* CONVSTA is driven by the port unless TCC0 owns the pin */
+	if (!(tcc0_running && (TCC0_CTRLB & TC0_CCAEN_bm)))
+	{
+		bool convsta = PORTC.OUT & (1 << 0);
+
+		if (convsta && !previous_convsta)
+			start_conversion();
+
+		previous_convsta = convsta;
+	}
+}
+
+static void update_tcc0(void)
+{
+	uint16_t divider = timer_divider(TCC0_CTRLA);
+
+	if (tcc0_perbuf_valid)
+	{
+		tcc0_perbuf_valid = false;
+		TCC0_PER = TCC0_PERBUF;
+	}
+
+	tcc0_next_update += (uint64_t)(TCC0_PER + 1) * divider;
+
+	/* Single slope PWM sets the CCA output on each update */
+	if (TCC0_CTRLB & TC0_CCAEN_bm)
+		start_conversion();
+
+	if (level_enabled(TCC0_INTCTRLA & TC_OVFINTLVL_gm))
+	{
+		update_counters();
+		sim_stats.timer_interrupts++;
+		TCC0_OVF_vect();
+		sim_hw_sync();
+	}
+}
+
+static uint64_t next_core_tick = 0;
+static uint64_t main_loop_stalled_until = 0;
+
+void sim_stall_main_loop(uint64_t t)
+{
+	main_loop_stalled_until = t;
+}
+
+static void run_main_loop(void)
+{
+	if (sim_now < main_loop_stalled_until)
+		return;
+
+	sim_stats.main_loop_runs++;
+	send_acquired_samples();
+	sim_hw_sync();
+}
+
+void sim_run_until(uint64_t t)
+{
+	while (true)
+	{
+		uint64_t next = next_core_tick;
+
+		if (converting && conversion_end < next)
+			next = conversion_end;
+		if (dma_busy && dma_end < next)
+			next = dma_end;
+		if (tcc0_running && tcc0_next_update < next)
+			next = tcc0_next_update;
+		if (main_loop_stalled_until > sim_now && main_loop_stalled_until < next)
+			next = main_loop_stalled_until;
+
+		if (next > t)
+			break;
+
+		sim_now = next;
+		update_counters();
+
+		if (converting && conversion_end == sim_now)
+			end_conversion();
+		if (dma_busy && dma_end == sim_now)
+			end_dma();
+		if (tcc0_running && tcc0_next_update == sim_now)
+			update_tcc0();
+		if (next_core_tick == sim_now)
+		{
+			next_core_tick += 500 * SIM_CYCLES_PER_US;
+			sim_stats.core_ticks++;
+			sim_core_tick();
+			sim_hw_sync();
+		}
+
+		run_main_loop();
+	}
+
+	sim_now = t;
+	update_counters();
+}
@@ -0,0 +1,175 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+/************************************************************************/
+/* Scenario                                                             */
+/************************************************************************/
+/* One command per line, '#' starts a comment. Time only moves with 'run'.
+ *
+ *   write <address> <value> [<value> ...]   Write an application register
+ *   restore <address> <value> [<value> ...]  Set a register as restored from the EEPROM, then reinitialize
+ *   read <address>                           Read an application register
+ *   run <microseconds>                       Advance the simulated time
+ *   di0 <0|1>                                Drive the DI0 input
+ *   mode <standby|active|speed>              Write the mode to OperationControl
+ *   stall <microseconds>                     Hold the main loop from now on
+ *   signal <channel> const <offset>
+ *   signal <channel> sine <offset> <amplitude> <frequency>
+ *   signal <channel> square <offset> <amplitude> <frequency>
+ *   signal <channel> ramp <offset> <amplitude> <frequency>
+ *   signal <channel> noise <offset> <amplitude> [<seed>]
+ *
+ * Signals are in ADC codes and frequencies in Hz.
+ */
+#define MAX_LINE 1024
+#define MAX_VALUES 128
+
+static int line_number;
+static const char *scenario_name;
+
+static void fail(const char *message)
+{
+	fprintf(stderr, "%s:%d: %s\n", scenario_name, line_number, message);
+	exit(1);
+}
+
+static double parse_number(const char *token)
+{
+	char *end;
+	double value;
+
+	if (!token)
+		fail("missing argument");
+
+	value = strtod(token, &end);
+
+	if (*end != '\0')
+		fail("invalid number");
+
+	return value;
+}
+
+static void parse_signal(void)
+{
+	static const char *shapes[] = {"const", "sine", "square", "ramp", "noise"};
+	sim_wave_t wave;
+	double channel = parse_number(strtok(NULL, " \t"));
+	const char *shape = strtok(NULL, " \t");
+
+	memset(&wave, 0, sizeof(wave));
+
+	if (channel < 0 || channel > 3)
+		fail("channel must be between 0 and 3");
+
+	if (!shape)
+		fail("missing shape");
+
+	for (wave.shape = 0; wave.shape < sizeof(shapes) / sizeof(shapes[0]); wave.shape++)
+	{
+		if (!strcmp(shape, shapes[wave.shape]))
+			break;
+	}
+
+	if (wave.shape == sizeof(shapes) / sizeof(shapes[0]))
+		fail("unknown shape");
+
+	wave.offset = parse_number(strtok(NULL, " \t"));
+
+	if (wave.shape != SIM_WAVE_CONST)
+		wave.amplitude = parse_number(strtok(NULL, " \t"));
+
+	if (wave.shape == SIM_WAVE_NOISE)
+	{
+		const char *seed = strtok(NULL, " \t");
+		wave.seed = seed ? (uint32_t)parse_number(seed) : 0;
+	}
+	else if (wave.shape != SIM_WAVE_CONST)
+	{
+		wave.frequency = parse_number(strtok(NULL, " \t"));
+	}
+
+	sim_set_wave((uint8_t)channel, &wave);
+}
+
+void sim_script_run(FILE *f, const char *name)
+{
+	char line[MAX_LINE];
+
+	scenario_name = name;
+	line_number = 0;
+
+	while (fgets(line, sizeof(line), f))
+	{
+		line_number++;
+
+		line[strcspn(line, "#\r\n")] = '\0';
+
+		char *command = strtok(line, " \t");
+		if (!command)
+			continue;
+
+		if (!strcmp(command, "write") || !strcmp(command, "restore"))
+		{
+			double values[MAX_VALUES];
+			uint16_t n_values = 0;
+			uint8_t add = (uint8_t)parse_number(strtok(NULL, " \t"));
+			char *token;
+
+			while ((token = strtok(NULL, " \t")) && n_values < MAX_VALUES)
+				values[n_values++] = parse_number(token);
+
+			if (!n_values)
+				fail("missing value");
+
+			if (command[0] == 'w')
+				sim_core_write(add, values, n_values);
+			else if (!sim_core_restore(add, values, n_values))
+				fail("invalid register or number of values");
+		}
+		else if (!strcmp(command, "read"))
+		{
+			sim_core_read((uint8_t)parse_number(strtok(NULL, " \t")));
+		}
+		else if (!strcmp(command, "run"))
+		{
+			sim_run_until(sim_now + (uint64_t)(parse_number(strtok(NULL, " \t")) * SIM_CYCLES_PER_US));
+		}
+		else if (!strcmp(command, "di0"))
+		{
+			sim_set_di0(parse_number(strtok(NULL, " \t")) != 0);
+		}
+		else if (!strcmp(command, "mode"))
+		{
+			static const char *modes[] = {"standby", "active", NULL, "speed"};
+			const char *mode = strtok(NULL, " \t");
+			uint8_t m;
+
+			if (!mode)
+				fail("missing mode");
+
+			for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+			{
+				if (modes[m] && !strcmp(mode, modes[m]))
+					break;
+			}
+
+			if (m == sizeof(modes) / sizeof(modes[0]))
+				fail("unknown mode");
+
+			sim_harp_set_mode(m);
+		}
+		else if (!strcmp(command, "stall"))
+		{
+			sim_stall_main_loop(sim_now + (uint64_t)(parse_number(strtok(NULL, " \t")) * SIM_CYCLES_PER_US));
+		}
+		else if (!strcmp(command, "signal"))
+		{
+			parse_signal();
+		}
+		else
+		{
+			fail("unknown command");
+		}
+	}
+}
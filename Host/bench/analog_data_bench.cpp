@@ -0,0 +1,244 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "harp/analog_data.hpp"
+#include "harp/parser.hpp"
+#include "harp/speed.hpp"
+#include "synthetic_stream.hpp"
+
+/************************************************************************/
+/* Benchmark of the AnalogData parser                                   */
+/************************************************************************/
+/* Synthetic streams are fed to stream_parser in chunks, like reads from a
+ * serial port, and decoded with each SIMD level the machine supports. The
+ * decoded reads are checked, one by one, against the generated ones.
+ *
+ * The de-interleaving kernel is also timed on its own, since most of the
+ * time of a whole stream goes to the parser.
+ */
+using namespace harp;
+using analog_input::analog_data_decoder;
+using analog_input::speed_decoder;
+using bench::stream;
+using bench::stream_case;
+
+namespace {
+
+constexpr int repeats = 5;
+/* Samples de-interleaved per kernel measurement */
+constexpr std::size_t kernel_samples = 1 << 22;
+
+struct result
+{
+    double seconds;
+    parse_stats stats;
+};
+
+template <typename Decoder>
+void check(const Decoder &decoder, const stream &s, const stream_case &c, simd_level level)
+{
+    std::string name = std::string(c.name) + "/" + to_string(level);
+    if (!bench::check_reads(decoder, s, name.c_str()))
+        std::exit(1);
+}
+
+/* The frames have no Harp message to parse, so they go straight to the decoder */
+result run_speed(const stream &s, const stream_case &c, std::size_t chunk)
+{
+    speed_decoder::options opts;
+    opts.enabled_channels = c.enabled_channels;
+
+    speed_decoder decoder(opts);
+    parse_stats stats{};
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t pos = 0; pos < s.bytes.size(); pos += chunk)
+        decoder.feed(s.bytes.data() + pos, std::min(chunk, s.bytes.size() - pos));
+    decoder.finish();
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    check(decoder, s, c, simd_level::scalar);
+    stats.skipped_bytes = decoder.dropped_bytes();
+
+    return result{std::chrono::duration<double>(elapsed).count(), stats};
+}
+
+result run(const stream &s, const stream_case &c, simd_level level, std::size_t chunk)
+{
+    if (c.speed)
+        return run_speed(s, c, chunk);
+
+    analog_data_decoder::options opts;
+    opts.enabled_channels = c.enabled_channels;
+    opts.simd = level;
+
+    analog_data_decoder decoder(opts);
+    decoder.reserve(s.reads);
+    stream_parser parser;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t pos = 0; pos < s.bytes.size(); pos += chunk)
+    {
+        std::size_t n = std::min(chunk, s.bytes.size() - pos);
+        std::memcpy(parser.prepare(n), s.bytes.data() + pos, n);
+        parser.commit(n);
+        parser.parse(decoder);
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    check(decoder, s, c, level);
+
+    return result{std::chrono::duration<double>(elapsed).count(), parser.stats()};
+}
+
+/* ns per sample of deinterleave4() on n samples, stride bytes apart */
+double time_kernel(std::size_t stride, std::size_t n, simd_level level)
+{
+    std::vector<std::uint8_t> src(n * stride);
+    std::vector<std::int16_t> channels(4 * n);
+    std::int16_t *dst[4] = {channels.data(), channels.data() + n, channels.data() + 2 * n, channels.data() + 3 * n};
+
+    for (std::size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<std::uint8_t>(i * 7);
+
+    double best = 1e18;
+
+    for (int r = 0; r < repeats; r++)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (std::size_t done = 0; done < kernel_samples; done += n)
+        {
+            deinterleave4(src.data(), stride, n, dst, level);
+#if defined(__GNUC__)
+            /* Keeps the stores of each call */
+            asm volatile("" : : "r"(channels.data()) : "memory");
+#endif
+        }
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (seconds < best)
+            best = seconds;
+    }
+
+    return best * 1e9 / kernel_samples;
+}
+
+void usage()
+{
+    std::fprintf(stderr, "usage: analog_data_bench [-n <frames>] [-c <chunk bytes>]\n");
+    std::exit(2);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    std::size_t frames = 1000000;
+    std::size_t chunk = 4096;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!std::strcmp(argv[i], "-n") && i + 1 < argc)
+            frames = std::strtoul(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "-c") && i + 1 < argc)
+            chunk = std::strtoul(argv[++i], nullptr, 10);
+        else
+            usage();
+    }
+
+    if (!frames || !chunk)
+        usage();
+
+    static const stream_case cases[] = {
+        {"4ch", 0x0F, 1, 0, 0},
+        {"4ch/other_events", 0x0F, 1, 50, 0},
+        {"4ch/corrupted", 0x0F, 1, 0, 10000},
+        {"4ch/batch_16", 0x0F, 16, 0, 0},
+        {"1ch", 0x01, 1, 0, 0},
+        {"2ch/batch_16", 0x03, 16, 0, 0},
+        {"4ch/batch_16/delta", 0x0F, 16, 0, 0, true},
+        {"1ch/batch_16/delta", 0x01, 16, 0, 0, true},
+        {"4ch/speed", 0x0F, 1, 0, 0, false, true},
+        {"4ch/speed/corrupted", 0x0F, 1, 0, 10000, false, true},
+    };
+
+    std::vector<simd_level> levels = {simd_level::scalar};
+    if (detect_simd() >= simd_level::sse2)
+        levels.push_back(simd_level::sse2);
+    if (detect_simd() >= simd_level::avx2)
+        levels.push_back(simd_level::avx2);
+
+    /* The payload of a BatchSize 16 event, and a run of single-read events as the parser hands them out */
+    static const struct
+    {
+        const char *name;
+        std::size_t stride;
+        std::size_t n;
+    } kernels[] = {
+        {"batch_16", 8, 16},
+        {"run_256", header_size + timestamp_size + 8 + 1, 256},
+    };
+
+    std::printf("%-20s %-7s %12s %9s\n", "deinterleave4", "simd", "ns/sample", "speed-up");
+
+    for (const auto &k : kernels)
+    {
+        double scalar = 0;
+
+        for (simd_level level : levels)
+        {
+            double ns = time_kernel(k.stride, k.n, level);
+            if (level == simd_level::scalar)
+                scalar = ns;
+
+            std::printf("%-20s %-7s %12.2f %8.1fx\n", k.name, to_string(level), ns, scalar / ns);
+        }
+    }
+
+    std::printf("\n");
+
+    std::printf("%-20s %-7s %10s %9s %9s %12s\n", "stream", "simd", "Mframes/s", "ns/frame", "MB/s", "2kHz devices");
+
+    for (const auto &c : cases)
+    {
+        stream s = generate(c, frames);
+
+        for (simd_level level : levels)
+        {
+            /* Only AnalogData with the 4 channels goes through the SIMD kernel */
+            if ((c.speed || c.delta || c.enabled_channels != analog_input::all_channels) && level != simd_level::scalar)
+                break;
+
+            result best = run(s, c, level, chunk);
+            for (int r = 1; r < repeats; r++)
+            {
+                result next = run(s, c, level, chunk);
+                if (next.seconds < best.seconds)
+                    best = next;
+            }
+
+            /* AnalogData events at 2 kHz, whatever BatchSize they carry */
+            double frames_per_s = s.frames / best.seconds;
+            double devices = s.reads / best.seconds / 2000;
+
+            std::printf("%-20s %-7s %10.2f %9.1f %9.0f %12.0f\n", c.name, to_string(level), frames_per_s / 1e6,
+                1e9 / frames_per_s, s.bytes.size() / best.seconds / 1e6, devices);
+
+            if (best.stats.checksum_errors || best.stats.skipped_bytes)
+                std::printf("%-20s %-7s %llu checksum errors, %llu bytes skipped\n", "", "",
+                    static_cast<unsigned long long>(best.stats.checksum_errors),
+                    static_cast<unsigned long long>(best.stats.skipped_bytes));
+        }
+    }
+
+    return 0;
+}
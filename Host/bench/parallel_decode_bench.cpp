@@ -0,0 +1,111 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "harp/analog_data.hpp"
+#include "harp/parallel_decode.hpp"
+#include "harp/parser.hpp"
+#include "harp/thread_pool.hpp"
+#include "synthetic_stream.hpp"
+
+/************************************************************************/
+/* Benchmark of the parallel AnalogData decoder                         */
+/************************************************************************/
+/* Decodes a synthetic recording held in memory with 1, 2, 4... threads, up
+ * to the cores of the machine, and prints the GB/s and the speed-up over
+ * one thread. Each result is checked against the generated reads.
+ */
+using namespace harp;
+using analog_input::decoded_analog_data;
+using analog_input::parallel_decode;
+using analog_input::parallel_decode_options;
+
+namespace {
+
+constexpr int repeats = 3;
+
+double run(const bench::stream &s, const bench::stream_case &c, thread_pool &pool, std::size_t part_size)
+{
+    parallel_decode_options opts;
+    opts.decoder.enabled_channels = c.enabled_channels;
+    opts.part_size = part_size;
+
+    auto start = std::chrono::steady_clock::now();
+    decoded_analog_data result = parallel_decode(s.bytes.data(), s.bytes.size(), pool, opts);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::string name = std::string(c.name) + "/" + std::to_string(pool.size()) + " threads";
+    if (!bench::check_reads(result, s, name.c_str()))
+        std::exit(1);
+
+    return seconds;
+}
+
+void usage()
+{
+    std::fprintf(stderr, "usage: parallel_decode_bench [-n <frames>] [-j <max threads>] [-k <part KB>]\n");
+    std::exit(2);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    std::size_t frames = 20000000;
+    unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t part_size = parallel_decode_options().part_size;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!std::strcmp(argv[i], "-n") && i + 1 < argc)
+            frames = std::strtoul(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "-j") && i + 1 < argc)
+            max_threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (!std::strcmp(argv[i], "-k") && i + 1 < argc)
+            part_size = std::strtoul(argv[++i], nullptr, 10) * 1024;
+        else
+            usage();
+    }
+
+    if (!frames || !max_threads || !part_size)
+        usage();
+
+    static const bench::stream_case cases[] = {
+        {"4ch", 0x0F, 1, 0, 0},
+        {"4ch/corrupted", 0x0F, 1, 50, 10000},
+    };
+
+    std::vector<unsigned> thread_counts;
+    for (unsigned n = 1; n < max_threads; n *= 2)
+        thread_counts.push_back(n);
+    thread_counts.push_back(max_threads);
+
+    std::printf("%u hardware threads, %zu KB parts\n", std::thread::hardware_concurrency(), part_size / 1024);
+    std::printf("%-16s %7s %9s %9s %10s\n", "stream", "threads", "GB/s", "speed-up", "efficiency");
+
+    for (const auto &c : cases)
+    {
+        bench::stream s = generate(c, frames);
+        double single = 0;
+
+        for (unsigned threads : thread_counts)
+        {
+            thread_pool pool(threads);
+            double best = run(s, c, pool, part_size);
+            for (int r = 1; r < repeats; r++)
+                best = std::min(best, run(s, c, pool, part_size));
+
+            if (threads == 1)
+                single = best;
+
+            std::printf("%-16s %7u %9.2f %9.2f %9.0f%%\n", c.name, threads, s.bytes.size() / best / 1e9, single / best,
+                100 * single / best / threads);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+#ifndef HARP_BENCH_SYNTHETIC_STREAM_HPP
+#define HARP_BENCH_SYNTHETIC_STREAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "harp/analog_data.hpp"
+#include "harp/delta.hpp"
+#include "harp/message.hpp"
+#include "harp/speed.hpp"
+
+/************************************************************************/
+/* Synthetic AnalogData streams                                         */
+/************************************************************************/
+/* Random AnalogData events, optionally mixed with other events and with
+ * corrupted bytes, and the reads a decoder must find in them.
+ * Delta streams are AnalogDataDelta events of random walks, with a jump
+ * sent escaped now and then. Speed streams are Speed Mode frames of one
+ * read each, where a corrupted frame loses its last bytes instead.
+ */
+namespace harp {
+namespace bench {
+
+constexpr std::uint8_t address_digital_output_state = 45;
+
+struct stream_case
+{
+    const char *name;
+    std::uint8_t enabled_channels;
+    unsigned batch;
+    /* One DigitalOutputState event every this many AnalogData events, 0 for none */
+    unsigned other_every;
+    /* One corrupted byte every this many AnalogData events, 0 for none */
+    unsigned corrupt_every;
+    bool delta = false;
+    bool speed = false;
+};
+
+struct stream
+{
+    std::vector<std::uint8_t> bytes;
+    std::size_t frames = 0;
+    std::size_t reads = 0;
+    /* The reads of each enabled channel, to check the decoder */
+    std::vector<std::int16_t> channels[analog_input::channel_count];
+};
+
+inline stream generate(const stream_case &c, std::size_t frames)
+{
+    stream s;
+    std::mt19937 rng(1);
+    unsigned n_enabled = analog_input::enabled_count(c.enabled_channels);
+    std::vector<std::int16_t> payload(n_enabled * c.batch);
+    std::uint8_t message[max_message_size];
+    std::uint8_t encoded[max_message_size];
+    std::uint64_t ticks = 0;
+    std::int16_t walk[analog_input::channel_count] = {};
+    unsigned enabled[analog_input::channel_count] = {};
+
+    for (unsigned ch = 0, k = 0; ch < analog_input::channel_count; ch++)
+    {
+        if (c.enabled_channels & (1 << ch))
+            enabled[k++] = ch;
+    }
+
+    s.bytes.reserve(frames * (header_size + timestamp_size + payload.size() * 2 + 1) * 11 / 10);
+
+    for (std::size_t f = 0; f < frames; f++)
+    {
+        std::size_t size;
+
+        if (c.speed)
+        {
+            for (auto &value : payload)
+                value = static_cast<std::int16_t>(rng());
+
+            message[0] = analog_input::speed_frame_sync;
+            message[1] = static_cast<std::uint8_t>(f);
+            std::memcpy(message + 2, payload.data(), payload.size() * 2);
+            size = analog_input::speed_frame_size(n_enabled);
+            message[size - 1] = analog_input::speed_frame_checksum(message, size);
+        }
+        else if (c.delta)
+        {
+            for (std::size_t i = 0; i < payload.size(); i++)
+            {
+                std::int16_t &w = walk[i % n_enabled];
+                w = static_cast<std::int16_t>(w + static_cast<int>(rng() % 101) - 50);
+                if (rng() % 64 == 0)
+                    w = static_cast<std::int16_t>(rng());
+                payload[i] = w;
+            }
+
+            std::size_t encoded_size = analog_input::delta_encode(payload.data(), c.batch, c.enabled_channels, encoded);
+            size = write_message(message, msg_type::event, analog_input::address_analog_data_delta, data_type::u8,
+                static_cast<std::uint32_t>(ticks / 31250), static_cast<std::uint16_t>(ticks % 31250), encoded, encoded_size);
+        }
+        else
+        {
+            for (auto &value : payload)
+                value = static_cast<std::int16_t>(rng());
+
+            size = write_message(message, msg_type::event, analog_input::address_analog_data, data_type::s16,
+                static_cast<std::uint32_t>(ticks / 31250), static_cast<std::uint16_t>(ticks % 31250), payload.data(), payload.size() * 2);
+        }
+        ticks += 16 * c.batch;
+
+        bool corrupt = c.corrupt_every && f % c.corrupt_every == c.corrupt_every - 1;
+        if (corrupt && c.speed)
+            size -= 3;
+        else if (corrupt)
+            message[size / 2] ^= 0x5A;
+        else
+        {
+            for (std::size_t i = 0; i < payload.size(); i++)
+                s.channels[enabled[i % n_enabled]].push_back(payload[i]);
+            s.frames++;
+            s.reads += c.batch;
+        }
+
+        s.bytes.insert(s.bytes.end(), message, message + size);
+
+        if (c.other_every && f % c.other_every == 0)
+        {
+            std::uint8_t value = static_cast<std::uint8_t>(f);
+            size = write_message(message, msg_type::event, address_digital_output_state, data_type::u8, 0, 0, &value, 1);
+            s.bytes.insert(s.bytes.end(), message, message + size);
+        }
+    }
+
+    return s;
+}
+
+/* Compares the reads of a decoder, or of anything with size() and
+ * channel(), with the generated ones. Prints the first difference.
+ */
+template <typename Decoded>
+bool check_reads(const Decoded &decoded, const stream &s, const char *name)
+{
+    if (decoded.size() != s.reads)
+    {
+        std::fprintf(stderr, "%s: decoded %zu reads, expected %zu\n", name, decoded.size(), s.reads);
+        return false;
+    }
+
+    for (unsigned c = 0; c < analog_input::channel_count; c++)
+    {
+        const std::int16_t *values = decoded.channel(c);
+
+        if (!values != s.channels[c].empty())
+        {
+            std::fprintf(stderr, "%s: channel %u is %s, expected %s\n", name, c, values ? "decoded" : "missing",
+                values ? "missing" : "decoded");
+            return false;
+        }
+
+        for (std::size_t i = 0; values && i < s.reads; i++)
+        {
+            if (values[i] != s.channels[c][i])
+            {
+                std::fprintf(stderr, "%s: read %zu of channel %u is %d, expected %d\n", name, i, c, values[i],
+                    s.channels[c][i]);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace bench
+} // namespace harp
+
+#endif // HARP_BENCH_SYNTHETIC_STREAM_HPP
@@ -0,0 +1,210 @@
+#ifndef HARP_ANALOG_DATA_HPP
+#define HARP_ANALOG_DATA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "deinterleave.hpp"
+#include "delta.hpp"
+#include "message.hpp"
+#include "parser.hpp"
+
+namespace harp {
+namespace analog_input {
+
+/************************************************************************/
+/* AnalogInput registers                                                */
+/************************************************************************/
+constexpr std::uint8_t address_analog_data = 33;
+constexpr unsigned channel_count = 4;
+constexpr std::uint8_t all_channels = 0x0F;
+
+inline unsigned enabled_count(std::uint8_t enabled_channels)
+{
+    unsigned n = 0;
+    for (unsigned c = 0; c < channel_count; c++)
+        n += (enabled_channels >> c) & 1;
+    return n;
+}
+
+/************************************************************************/
+/* AnalogData decoder                                                   */
+/************************************************************************/
+/* Collects the AnalogData events into one array per channel and one array
+ * of timestamps, in seconds. Pass it to parse() as the run handler: other
+ * registers are ignored.
+ *
+ * Each event has BatchSize reads of the channels on EnabledChannels. The
+ * event is timestamped with its first read and the others are spaced by
+ * the sampling period. Channels that are not enabled stay empty.
+ *
+ * AnalogDataDelta events are decoded to the same arrays. They may carry
+ * fewer reads than BatchSize, when the firmware sends them early so the
+ * next read fits. Those with other channels than enabled_channels, or
+ * truncated, are counted on rejected().
+ */
+class analog_data_decoder
+{
+public:
+    struct options
+    {
+        std::uint8_t enabled_channels = all_channels;
+        /* Time between reads, in seconds, only used when BatchSize is above one */
+        double sampling_period = 0.001;
+        simd_level simd = detect_simd();
+    };
+
+    analog_data_decoder() : analog_data_decoder(options()) {}
+
+    explicit analog_data_decoder(const options &opts)
+        : opts_(opts), n_enabled_(enabled_count(opts.enabled_channels))
+    {
+        for (unsigned c = 0, k = 0; c < channel_count; c++)
+        {
+            if (opts_.enabled_channels & (1 << c))
+                enabled_[k++] = c;
+        }
+    }
+
+    void operator()(const message_run &run)
+    {
+        message first = run.front();
+
+        if (first.type() == msg_type::event && first.address() == address_analog_data_delta &&
+            first.payload_type() == data_type::u8 && n_enabled_)
+        {
+            decode_delta(run);
+            return;
+        }
+
+        if (first.type() != msg_type::event || first.address() != address_analog_data ||
+            first.payload_type() != data_type::s16 || !n_enabled_)
+            return;
+
+        std::size_t value_bytes = 2 * n_enabled_;
+        std::size_t batch = first.payload_size() / value_bytes;
+        if (!batch)
+            return;
+
+        std::size_t n = run.count * batch;
+        grow(size_ + n);
+
+        std::int16_t *dst[channel_count];
+        for (unsigned k = 0; k < n_enabled_; k++)
+            dst[k] = channels_[enabled_[k]].data() + size_;
+
+        std::size_t payload_offset = first.payload() - first.data;
+
+        if (batch == 1)
+        {
+            /* The run is a strided array of samples */
+            deinterleave(run.data + payload_offset, run.stride, run.count, n_enabled_, dst, opts_.simd);
+
+            double *t = timestamps_.data() + size_;
+            for (std::size_t i = 0; i < run.count; i++)
+                t[i] = run[i].timestamp();
+        }
+        else
+        {
+            for (std::size_t i = 0; i < run.count; i++)
+            {
+                message m = run[i];
+                deinterleave(m.payload(), value_bytes, batch, n_enabled_, dst, opts_.simd);
+
+                for (unsigned k = 0; k < n_enabled_; k++)
+                    dst[k] += batch;
+
+                double t0 = m.timestamp();
+                double *t = timestamps_.data() + size_ + i * batch;
+                for (std::size_t j = 0; j < batch; j++)
+                    t[j] = t0 + j * opts_.sampling_period;
+            }
+        }
+
+        size_ += n;
+        messages_ += run.count;
+    }
+
+    /* Reads decoded so far, on every enabled channel */
+    std::size_t size() const { return size_; }
+    std::uint64_t messages() const { return messages_; }
+    std::uint64_t rejected() const { return rejected_; }
+
+    /* Points to size() reads, or nullptr if the channel is not enabled */
+    const std::int16_t *channel(unsigned c) const
+    {
+        return (opts_.enabled_channels & (1 << c)) ? channels_[c].data() : nullptr;
+    }
+
+    const double *timestamps() const { return timestamps_.data(); }
+
+    void reserve(std::size_t reads) { grow(reads); }
+
+    /* Drops the reads, keeping the memory */
+    void clear()
+    {
+        size_ = 0;
+        messages_ = 0;
+        rejected_ = 0;
+    }
+
+private:
+    /* The reads of each event are only known after decoding it, so the arrays grow for the most it can hold */
+    void decode_delta(const message_run &run)
+    {
+        for (std::size_t i = 0; i < run.count; i++)
+        {
+            message m = run[i];
+            grow(size_ + delta_max_reads(m.payload_size(), n_enabled_));
+
+            std::int16_t *dst[channel_count];
+            for (unsigned k = 0; k < n_enabled_; k++)
+                dst[k] = channels_[enabled_[k]].data() + size_;
+
+            std::size_t n = delta_decode(m.payload(), m.payload_size(), opts_.enabled_channels, dst);
+            if (!n)
+            {
+                rejected_++;
+                continue;
+            }
+
+            double t0 = m.timestamp();
+            double *t = timestamps_.data() + size_;
+            for (std::size_t j = 0; j < n; j++)
+                t[j] = t0 + j * opts_.sampling_period;
+
+            size_ += n;
+            messages_++;
+        }
+    }
+
+    /* The arrays keep their size and only size_ of them is used, so appending doesn't zero the memory each time */
+    void grow(std::size_t reads)
+    {
+        if (reads <= timestamps_.size())
+            return;
+
+        std::size_t capacity = timestamps_.size() ? timestamps_.size() : 4096;
+        while (capacity < reads)
+            capacity *= 2;
+
+        timestamps_.resize(capacity);
+        for (unsigned k = 0; k < n_enabled_; k++)
+            channels_[enabled_[k]].resize(capacity);
+    }
+
+    options opts_;
+    unsigned n_enabled_;
+    unsigned enabled_[channel_count] = {};
+    std::vector<std::int16_t> channels_[channel_count];
+    std::vector<double> timestamps_;
+    std::size_t size_ = 0;
+    std::uint64_t messages_ = 0;
+    std::uint64_t rejected_ = 0;
+};
+
+} // namespace analog_input
+} // namespace harp
+
+#endif // HARP_ANALOG_DATA_HPP
@@ -0,0 +1,362 @@
+#ifndef HARP_BLOCK_WRITER_HPP
+#define HARP_BLOCK_WRITER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace harp {
+
+/************************************************************************/
+/* Write latency                                                        */
+/************************************************************************/
+/* Histogram with one bucket per power of two microseconds */
+struct latency_histogram
+{
+    static constexpr int buckets = 32;
+
+    std::uint64_t counts[buckets] = {};
+    std::uint64_t total = 0;
+    double max_us = 0;
+    double sum_us = 0;
+
+    void add(double us)
+    {
+        int b = 0;
+        while (b < buckets - 1 && (1u << b) < us)
+            b++;
+
+        counts[b]++;
+        total++;
+        sum_us += us;
+        max_us = std::max(max_us, us);
+    }
+
+    /* Upper bound of the bucket holding the given fraction of the writes */
+    double percentile_us(double fraction) const
+    {
+        std::uint64_t target = static_cast<std::uint64_t>(total * fraction);
+        std::uint64_t seen = 0;
+
+        for (int b = 0; b < buckets; b++)
+        {
+            seen += counts[b];
+            if (seen > target)
+                return std::min<double>(1u << b, max_us);
+        }
+        return max_us;
+    }
+
+    double mean_us() const { return total ? sum_us / total : 0; }
+};
+
+struct block_writer_stats
+{
+    std::uint64_t bytes_appended = 0;
+    std::uint64_t bytes_written = 0;
+    std::uint64_t writes = 0;
+    std::size_t queued_blocks = 0;
+    std::size_t allocated_blocks = 0;
+    /* Times append() waited for a free block because the memory limit was reached */
+    std::uint64_t stalls = 0;
+    latency_histogram latency;
+};
+
+/************************************************************************/
+/* Block writer                                                         */
+/************************************************************************/
+/* Appends go to a page aligned block per file. Full blocks are queued to a
+ * writer thread, which writes the consecutive blocks of a file with one
+ * pwritev(), with O_DIRECT when the file system allows it.
+ *
+ * append() only copies to memory. When the disk is slow the queue grows,
+ * with new blocks, up to max_memory, so the reads of the device are not
+ * held back. Only past that limit append() waits for the disk.
+ *
+ * open() and append() must be called from a single thread.
+ */
+class block_writer
+{
+public:
+    struct options
+    {
+        /* A multiple of the page size, for O_DIRECT */
+        std::size_t block_size = 1 << 20;
+        std::size_t max_memory = std::size_t(1) << 30;
+        bool direct = true;
+    };
+
+    block_writer() : block_writer(options()) {}
+
+    explicit block_writer(const options &opts) : opts_(opts)
+    {
+        std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        opts_.block_size = std::max(page, (opts_.block_size + page - 1) / page * page);
+        opts_.max_memory = std::max(opts_.max_memory, 2 * opts_.block_size);
+        thread_ = std::thread([this] { write_loop(); });
+    }
+
+    ~block_writer()
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    block_writer(const block_writer &) = delete;
+    block_writer &operator=(const block_writer &) = delete;
+
+    /* Creates or truncates the file and returns its id for append() */
+    int open(const std::string &path)
+    {
+        int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+        int fd = -1;
+        bool direct = false;
+
+        /* Not every file system has O_DIRECT, tmpfs for one */
+        if (opts_.direct)
+        {
+            fd = ::open(path.c_str(), flags | O_DIRECT, 0644);
+            direct = fd >= 0;
+        }
+        if (fd < 0)
+            fd = ::open(path.c_str(), flags, 0644);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), path);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        files_.push_back(file{fd, direct, path, get_block(lock), 0, 0});
+        return static_cast<int>(files_.size() - 1);
+    }
+
+    bool is_direct(int id) const { return files_[id].direct; }
+
+    void append(int id, const std::uint8_t *data, std::size_t size)
+    {
+        file &f = files_[id];
+
+        while (size)
+        {
+            std::size_t n = std::min(size, opts_.block_size - f.used);
+            std::memcpy(f.block + f.used, data, n);
+            f.used += n;
+            data += n;
+            size -= n;
+            appended_ += n;
+
+            if (f.used == opts_.block_size)
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                check_error();
+                queue_.push_back(pending{id, f.block, f.offset});
+                f.offset += opts_.block_size;
+                f.block = get_block(lock);
+                f.used = 0;
+                queued_.notify_one();
+            }
+        }
+    }
+
+    /* Writes what is queued and the partial blocks, then closes the files */
+    void close()
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (closed_)
+                return;
+            closing_ = true;
+            queued_.notify_one();
+        }
+        thread_.join();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        check_error();
+
+        for (auto &f : files_)
+        {
+            /* The tail is not a whole block, so it can't go through O_DIRECT */
+            if (f.used)
+            {
+                if (f.direct)
+                    fcntl(f.fd, F_SETFL, fcntl(f.fd, F_GETFL) & ~O_DIRECT);
+
+                if (pwrite(f.fd, f.block, f.used, f.offset) != static_cast<ssize_t>(f.used))
+                    throw std::system_error(errno, std::generic_category(), f.path);
+                stats_.bytes_written += f.used;
+            }
+
+            ::close(f.fd);
+            free_.push_back(f.block);
+            f.block = nullptr;
+        }
+
+        for (auto block : free_)
+            std::free(block);
+        free_.clear();
+    }
+
+    block_writer_stats stats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        block_writer_stats s = stats_;
+        s.bytes_appended = appended_;
+        s.queued_blocks = queue_.size();
+        s.allocated_blocks = allocated_;
+        return s;
+    }
+
+    std::size_t block_size() const { return opts_.block_size; }
+
+private:
+    struct file
+    {
+        int fd;
+        bool direct;
+        std::string path;
+        std::uint8_t *block;
+        std::size_t used;
+        std::uint64_t offset;
+    };
+
+    struct pending
+    {
+        int id;
+        std::uint8_t *block;
+        std::uint64_t offset;
+    };
+
+    void check_error()
+    {
+        if (error_)
+            throw std::system_error(error_, std::generic_category(), error_path_);
+    }
+
+    std::uint8_t *get_block(std::unique_lock<std::mutex> &lock)
+    {
+        while (free_.empty() && (allocated_ + 1) * opts_.block_size > opts_.max_memory)
+        {
+            stats_.stalls++;
+            released_.wait(lock, [this] { return !free_.empty() || error_; });
+            check_error();
+        }
+        return take_block();
+    }
+
+    std::uint8_t *take_block()
+    {
+        if (!free_.empty())
+        {
+            std::uint8_t *block = free_.back();
+            free_.pop_back();
+            return block;
+        }
+
+        void *block = nullptr;
+        if (posix_memalign(&block, 4096, opts_.block_size))
+            throw std::bad_alloc();
+
+        allocated_++;
+        return static_cast<std::uint8_t *>(block);
+    }
+
+    void write_loop()
+    {
+        std::vector<pending> batch;
+        std::vector<iovec> iov;
+        long iov_max = std::min(sysconf(_SC_IOV_MAX), 256L);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        for (;;)
+        {
+            queued_.wait(lock, [this] { return !queue_.empty() || closing_; });
+            if (queue_.empty())
+                return;
+
+            /* The blocks of a file are queued in order, so the consecutive ones are contiguous on the file */
+            batch.clear();
+            batch.push_back(queue_.front());
+            queue_.pop_front();
+
+            while (!queue_.empty() && static_cast<long>(batch.size()) < iov_max &&
+                queue_.front().id == batch.front().id)
+            {
+                batch.push_back(queue_.front());
+                queue_.pop_front();
+            }
+
+            int fd = files_[batch.front().id].fd;
+            lock.unlock();
+
+            iov.clear();
+            for (auto &p : batch)
+                iov.push_back(iovec{p.block, opts_.block_size});
+
+            auto start = std::chrono::steady_clock::now();
+            ssize_t expected = static_cast<ssize_t>(batch.size() * opts_.block_size);
+            ssize_t written = pwritev(fd, iov.data(), static_cast<int>(iov.size()), batch.front().offset);
+            int err = written == expected ? 0 : (written < 0 ? errno : EIO);
+            double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+            lock.lock();
+
+            if (err)
+            {
+                error_ = err;
+                error_path_ = files_[batch.front().id].path;
+                released_.notify_all();
+                return;
+            }
+
+            stats_.bytes_written += written;
+            stats_.writes++;
+            stats_.latency.add(us);
+
+            for (auto &p : batch)
+                free_.push_back(p.block);
+            released_.notify_all();
+        }
+    }
+
+    options opts_;
+    /* A deque keeps the files in place while open() adds more */
+    std::deque<file> files_;
+    std::atomic<std::uint64_t> appended_{0};
+
+    mutable std::mutex mutex_;
+    std::condition_variable queued_;
+    std::condition_variable released_;
+    std::deque<pending> queue_;
+    std::vector<std::uint8_t *> free_;
+    std::size_t allocated_ = 0;
+    bool closing_ = false;
+    bool closed_ = false;
+    int error_ = 0;
+    std::string error_path_;
+    block_writer_stats stats_;
+    std::thread thread_;
+};
+
+} // namespace harp
+
+#endif // HARP_BLOCK_WRITER_HPP
@@ -0,0 +1,543 @@
+#ifndef HARP_COLUMNAR_HPP
+#define HARP_COLUMNAR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace harp {
+namespace columnar {
+
+/************************************************************************/
+/* File format                                                          */
+/************************************************************************/
+/* AnalogInput reads stored by column, in chunks of up to chunk_reads reads:
+ *
+ *   file_header                       64 bytes, at offset 0
+ *   chunk 0, chunk 1, ...             each one page aligned
+ *   chunk_index[chunks]               at header.index_offset
+ *
+ * A chunk has the timestamp column, in us: the first timestamp as an int64
+ * followed by the difference to the previous read as int8, int16 or int32,
+ * whichever fits the whole chunk. Then one int16 column per enabled
+ * channel, each 64 bytes aligned.
+ *
+ * The index has the time span of each chunk and the min, max, first and
+ * last read of each channel. Queries use it to skip the chunks that can't
+ * hold what they look for. Values are little-endian, as on the host.
+ */
+constexpr char file_magic[8] = {'H', 'A', 'R', 'P', 'C', 'O', 'L', '1'};
+constexpr std::uint32_t file_version = 1;
+constexpr unsigned max_channels = 4;
+constexpr std::size_t chunk_alignment = 4096;
+constexpr std::size_t column_alignment = 64;
+constexpr std::uint32_t default_chunk_reads = 65536;
+
+struct file_header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint8_t enabled_channels;
+    std::uint8_t reserved0[3];
+    std::uint32_t chunk_reads;
+    std::uint32_t chunks;
+    std::uint64_t reads;
+    std::uint64_t index_offset;
+    std::int64_t first_us;
+    std::int64_t last_us;
+    std::uint8_t reserved1[8];
+};
+
+struct chunk_index
+{
+    std::uint64_t offset;
+    std::uint32_t reads;
+    std::uint8_t delta_bytes;
+    std::uint8_t reserved[3];
+    std::int64_t first_us;
+    std::int64_t last_us;
+    std::int16_t min[max_channels];
+    std::int16_t max[max_channels];
+    std::int16_t first[max_channels];
+    std::int16_t last[max_channels];
+};
+
+static_assert(sizeof(file_header) == 64, "file_header layout");
+static_assert(sizeof(chunk_index) == 64, "chunk_index layout");
+
+inline std::size_t align_up(std::size_t value, std::size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+/* Offsets of the columns inside a chunk */
+struct chunk_layout
+{
+    std::size_t deltas;
+    std::size_t channels[max_channels];
+    std::size_t size;
+
+    chunk_layout(std::uint8_t enabled_channels, std::size_t reads, std::size_t delta_bytes)
+    {
+        deltas = sizeof(std::int64_t);
+        std::size_t offset = align_up(deltas + (reads ? reads - 1 : 0) * delta_bytes, column_alignment);
+
+        for (unsigned c = 0; c < max_channels; c++)
+        {
+            channels[c] = offset;
+            if (enabled_channels & (1 << c))
+                offset = align_up(offset + reads * sizeof(std::int16_t), column_alignment);
+        }
+        size = offset;
+    }
+};
+
+/************************************************************************/
+/* Writer                                                               */
+/************************************************************************/
+class writer
+{
+public:
+    writer(const std::string &path, std::uint8_t enabled_channels, std::uint32_t chunk_reads = default_chunk_reads)
+        : path_(path), chunk_reads_(std::max<std::uint32_t>(chunk_reads, 1))
+    {
+        file_ = std::fopen(path.c_str(), "wb");
+        if (!file_)
+            throw std::system_error(errno, std::generic_category(), path);
+
+        std::memset(&header_, 0, sizeof(header_));
+        std::memcpy(header_.magic, file_magic, sizeof(file_magic));
+        header_.version = file_version;
+        header_.enabled_channels = enabled_channels & ((1 << max_channels) - 1);
+        header_.chunk_reads = chunk_reads_;
+
+        time_.reserve(chunk_reads_);
+        for (unsigned c = 0; c < max_channels; c++)
+        {
+            if (header_.enabled_channels & (1 << c))
+                channels_[c].reserve(chunk_reads_);
+        }
+
+        /* The header is written again by close() */
+        write_at(0, &header_, sizeof(header_));
+        offset_ = chunk_alignment;
+    }
+
+    ~writer()
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    writer(const writer &) = delete;
+    writer &operator=(const writer &) = delete;
+
+    /* channels[c] points to n reads of channel c, and may be null when the channel is not enabled */
+    void append(const std::int64_t *time_us, const std::int16_t *const *channels, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            /* A gap too long for the deltas starts a new chunk */
+            if (!time_.empty())
+            {
+                std::int64_t delta = time_us[i] - time_.back();
+                if (delta > std::numeric_limits<std::int32_t>::max() || delta < std::numeric_limits<std::int32_t>::min())
+                    flush_chunk();
+            }
+
+            time_.push_back(time_us[i]);
+            for (unsigned c = 0; c < max_channels; c++)
+            {
+                if (header_.enabled_channels & (1 << c))
+                    channels_[c].push_back(channels[c] ? channels[c][i] : 0);
+            }
+
+            if (time_.size() == chunk_reads_)
+                flush_chunk();
+        }
+    }
+
+    void close()
+    {
+        if (!file_)
+            return;
+
+        flush_chunk();
+
+        header_.chunks = static_cast<std::uint32_t>(index_.size());
+        header_.index_offset = offset_;
+        if (!index_.empty())
+        {
+            header_.first_us = index_.front().first_us;
+            header_.last_us = index_.back().last_us;
+        }
+
+        write_at(offset_, index_.data(), index_.size() * sizeof(chunk_index));
+        write_at(0, &header_, sizeof(header_));
+
+        int failed = std::fclose(file_);
+        file_ = nullptr;
+        if (failed)
+            throw std::system_error(errno, std::generic_category(), path_);
+    }
+
+    std::uint64_t reads() const { return header_.reads + time_.size(); }
+
+private:
+    void write_at(std::uint64_t offset, const void *data, std::size_t size)
+    {
+        if (fseeko(file_, static_cast<off_t>(offset), SEEK_SET) || std::fwrite(data, 1, size, file_) != size)
+            throw std::system_error(errno, std::generic_category(), path_);
+    }
+
+    void flush_chunk()
+    {
+        std::size_t n = time_.size();
+        if (!n)
+            return;
+
+        chunk_index entry;
+        std::memset(&entry, 0, sizeof(entry));
+        entry.offset = offset_;
+        entry.reads = static_cast<std::uint32_t>(n);
+        entry.first_us = time_.front();
+        entry.last_us = time_.back();
+
+        std::int64_t max_delta = 0;
+        for (std::size_t i = 1; i < n; i++)
+            max_delta = std::max(max_delta, std::abs(time_[i] - time_[i - 1]));
+        entry.delta_bytes = max_delta <= std::numeric_limits<std::int8_t>::max() ? 1
+            : max_delta <= std::numeric_limits<std::int16_t>::max() ? 2 : 4;
+
+        chunk_layout layout(header_.enabled_channels, n, entry.delta_bytes);
+        buffer_.assign(layout.size, 0);
+
+        std::memcpy(buffer_.data(), &time_[0], sizeof(std::int64_t));
+        for (std::size_t i = 1; i < n; i++)
+        {
+            std::int32_t delta = static_cast<std::int32_t>(time_[i] - time_[i - 1]);
+            std::uint8_t *p = buffer_.data() + layout.deltas + (i - 1) * entry.delta_bytes;
+
+            if (entry.delta_bytes == 1)
+                *reinterpret_cast<std::int8_t *>(p) = static_cast<std::int8_t>(delta);
+            else if (entry.delta_bytes == 2)
+            {
+                std::int16_t d16 = static_cast<std::int16_t>(delta);
+                std::memcpy(p, &d16, 2);
+            }
+            else
+                std::memcpy(p, &delta, 4);
+        }
+
+        for (unsigned c = 0; c < max_channels; c++)
+        {
+            if (!(header_.enabled_channels & (1 << c)))
+                continue;
+
+            const auto &column = channels_[c];
+            auto minmax = std::minmax_element(column.begin(), column.end());
+            entry.min[c] = *minmax.first;
+            entry.max[c] = *minmax.second;
+            entry.first[c] = column.front();
+            entry.last[c] = column.back();
+
+            std::memcpy(buffer_.data() + layout.channels[c], column.data(), n * sizeof(std::int16_t));
+            channels_[c].clear();
+        }
+
+        write_at(offset_, buffer_.data(), buffer_.size());
+        offset_ = align_up(offset_ + buffer_.size(), chunk_alignment);
+
+        index_.push_back(entry);
+        header_.reads += n;
+        time_.clear();
+    }
+
+    std::string path_;
+    std::FILE *file_ = nullptr;
+    std::uint32_t chunk_reads_;
+    file_header header_;
+    std::uint64_t offset_ = 0;
+    std::vector<std::int64_t> time_;
+    std::vector<std::int16_t> channels_[max_channels];
+    std::vector<std::uint8_t> buffer_;
+    std::vector<chunk_index> index_;
+};
+
+/************************************************************************/
+/* Reader                                                               */
+/************************************************************************/
+/* Maps the whole file, so only the pages of the chunks a query touches are
+ * read from the disk.
+ */
+enum class edge
+{
+    rising,
+    falling,
+    any
+};
+
+struct slice
+{
+    std::size_t chunk;
+    std::size_t begin;
+    std::size_t end;
+};
+
+struct crossing
+{
+    std::size_t chunk;
+    std::size_t read;
+    std::int64_t time_us;
+    std::int16_t before;
+    std::int16_t after;
+};
+
+class reader
+{
+public:
+    explicit reader(const std::string &path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), path);
+
+        struct stat st;
+        if (fstat(fd, &st))
+        {
+            int err = errno;
+            ::close(fd);
+            throw std::system_error(err, std::generic_category(), path);
+        }
+
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ >= sizeof(file_header))
+            data_ = static_cast<const std::uint8_t *>(mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0));
+        ::close(fd);
+
+        if (data_ == MAP_FAILED || !data_)
+        {
+            data_ = nullptr;
+            throw std::runtime_error(path + ": not a columnar file");
+        }
+
+        header_ = reinterpret_cast<const file_header *>(data_);
+        if (std::memcmp(header_->magic, file_magic, sizeof(file_magic)) || header_->version != file_version ||
+            header_->index_offset + header_->chunks * sizeof(chunk_index) > size_)
+        {
+            munmap(const_cast<std::uint8_t *>(data_), size_);
+            data_ = nullptr;
+            throw std::runtime_error(path + ": not a columnar file or incomplete");
+        }
+
+        index_ = reinterpret_cast<const chunk_index *>(data_ + header_->index_offset);
+    }
+
+    ~reader()
+    {
+        if (data_)
+            munmap(const_cast<std::uint8_t *>(data_), size_);
+    }
+
+    reader(const reader &) = delete;
+    reader &operator=(const reader &) = delete;
+
+    const file_header &header() const { return *header_; }
+    std::size_t chunks() const { return header_->chunks; }
+    const chunk_index &index(std::size_t chunk) const { return index_[chunk]; }
+
+    /* Points to the reads of the channel on the chunk, or nullptr if the channel is not enabled */
+    const std::int16_t *channel(std::size_t chunk, unsigned c) const
+    {
+        if (c >= max_channels || !(header_->enabled_channels & (1 << c)))
+            return nullptr;
+
+        chunk_layout layout(header_->enabled_channels, index_[chunk].reads, index_[chunk].delta_bytes);
+        return reinterpret_cast<const std::int16_t *>(data_ + index_[chunk].offset + layout.channels[c]);
+    }
+
+    /* Decodes the timestamps of the chunk, out must have room for its reads */
+    void timestamps(std::size_t chunk, std::int64_t *out) const
+    {
+        const chunk_index &entry = index_[chunk];
+        const std::uint8_t *p = data_ + entry.offset;
+        std::int64_t t;
+
+        std::memcpy(&t, p, sizeof(t));
+        out[0] = t;
+        p += sizeof(t);
+
+        for (std::uint32_t i = 1; i < entry.reads; i++, p += entry.delta_bytes)
+        {
+            if (entry.delta_bytes == 1)
+                t += *reinterpret_cast<const std::int8_t *>(p);
+            else if (entry.delta_bytes == 2)
+            {
+                std::int16_t d;
+                std::memcpy(&d, p, 2);
+                t += d;
+            }
+            else
+            {
+                std::int32_t d;
+                std::memcpy(&d, p, 4);
+                t += d;
+            }
+            out[i] = t;
+        }
+    }
+
+    /* The reads with from_us <= time < to_us, assuming the time doesn't go back inside a chunk.
+     * Only the chunks at the ends of the range have their timestamps decoded.
+     */
+    std::vector<slice> range(std::int64_t from_us, std::int64_t to_us, std::size_t *chunks_decoded = nullptr) const
+    {
+        std::vector<slice> result;
+        std::vector<std::int64_t> time;
+        std::size_t decoded = 0;
+
+        for (std::size_t k = 0; k < chunks(); k++)
+        {
+            const chunk_index &entry = index_[k];
+
+            if (entry.last_us < from_us || entry.first_us >= to_us)
+                continue;
+
+            if (entry.first_us >= from_us && entry.last_us < to_us)
+            {
+                result.push_back(slice{k, 0, entry.reads});
+                continue;
+            }
+
+            time.resize(entry.reads);
+            timestamps(k, time.data());
+            decoded++;
+
+            std::size_t begin = std::lower_bound(time.begin(), time.end(), from_us) - time.begin();
+            std::size_t end = std::lower_bound(time.begin(), time.end(), to_us) - time.begin();
+            if (begin < end)
+                result.push_back(slice{k, begin, end});
+        }
+
+        if (chunks_decoded)
+            *chunks_decoded = decoded;
+        return result;
+    }
+
+    /* First read at or after from_us where the channel crosses the threshold: the previous read
+     * is below and this one at or above it for a rising edge. The index skips the chunks where
+     * all the reads, and the read before them, stay on the same side.
+     */
+    bool find_crossing(unsigned c, std::int16_t threshold, edge direction, std::int64_t from_us, crossing &out,
+        std::size_t *chunks_scanned = nullptr) const
+    {
+        bool rising = direction != edge::falling;
+        bool falling = direction != edge::rising;
+        bool have_previous = false;
+        std::int16_t previous = 0;
+        std::size_t scanned = 0;
+        std::vector<std::int64_t> time;
+        std::size_t time_chunk = chunks();
+        bool found = false;
+
+        if (c >= max_channels || !(header_->enabled_channels & (1 << c)))
+            return false;
+
+        for (std::size_t k = 0; k < chunks() && !found; k++)
+        {
+            const chunk_index &entry = index_[k];
+
+            if (entry.last_us < from_us)
+            {
+                previous = entry.last[c];
+                have_previous = true;
+                continue;
+            }
+
+            std::size_t start = 0;
+            if (entry.first_us < from_us)
+            {
+                time.resize(entry.reads);
+                timestamps(k, time.data());
+                time_chunk = k;
+                start = std::lower_bound(time.begin(), time.end(), from_us) - time.begin();
+            }
+            else if (have_previous)
+            {
+                /* The whole chunk is in the search, so the index tells if it can hold the edge */
+                bool all_high = entry.min[c] >= threshold && previous >= threshold;
+                bool all_low = entry.max[c] < threshold && previous < threshold;
+
+                if (all_high || all_low)
+                {
+                    previous = entry.last[c];
+                    continue;
+                }
+            }
+
+            const std::int16_t *values = channel(k, c);
+            scanned++;
+
+            if (start)
+            {
+                previous = values[start - 1];
+                have_previous = true;
+            }
+
+            for (std::size_t i = start; i < entry.reads; i++)
+            {
+                std::int16_t value = values[i];
+
+                if (have_previous && ((rising && previous < threshold && value >= threshold) ||
+                    (falling && previous >= threshold && value < threshold)))
+                {
+                    if (time_chunk != k)
+                    {
+                        time.resize(entry.reads);
+                        timestamps(k, time.data());
+                    }
+
+                    out = crossing{k, i, time[i], previous, value};
+                    found = true;
+                    break;
+                }
+
+                previous = value;
+                have_previous = true;
+            }
+        }
+
+        if (chunks_scanned)
+            *chunks_scanned = scanned;
+        return found;
+    }
+
+private:
+    const std::uint8_t *data_ = nullptr;
+    std::size_t size_ = 0;
+    const file_header *header_ = nullptr;
+    const chunk_index *index_ = nullptr;
+};
+
+} // namespace columnar
+} // namespace harp
+
+#endif // HARP_COLUMNAR_HPP
@@ -0,0 +1,174 @@
+#ifndef HARP_DEINTERLEAVE_HPP
+#define HARP_DEINTERLEAVE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HARP_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+namespace harp {
+
+/************************************************************************/
+/* De-interleaving of S16 samples                                       */
+/************************************************************************/
+/* Copies n samples of 4 channels into one array per channel. Sample i
+ * starts stride bytes after sample i - 1: stride is 8 for a contiguous
+ * payload and the message size for a run of single sample messages.
+ *
+ * The SSE2 and AVX2 kernels are compiled with target attributes and picked
+ * at run time, so the library doesn't need -mavx2 and still runs on older
+ * machines.
+ */
+enum class simd_level
+{
+    scalar,
+    sse2,
+    avx2
+};
+
+inline const char *to_string(simd_level level)
+{
+    switch (level)
+    {
+        case simd_level::sse2: return "sse2";
+        case simd_level::avx2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+inline simd_level detect_simd()
+{
+#if defined(HARP_X86_DISPATCH)
+    static const simd_level level = __builtin_cpu_supports("avx2") ? simd_level::avx2
+        : __builtin_cpu_supports("sse2") ? simd_level::sse2 : simd_level::scalar;
+    return level;
+#else
+    return simd_level::scalar;
+#endif
+}
+
+namespace detail {
+
+inline std::int16_t load_s16(const std::uint8_t *p)
+{
+    std::int16_t value;
+    std::memcpy(&value, p, 2);
+    return value;
+}
+
+inline void deinterleave4_scalar(const std::uint8_t *src, std::size_t stride, std::size_t n, std::int16_t *const *dst)
+{
+    for (std::size_t i = 0; i < n; i++, src += stride)
+    {
+        dst[0][i] = load_s16(src + 0);
+        dst[1][i] = load_s16(src + 2);
+        dst[2][i] = load_s16(src + 4);
+        dst[3][i] = load_s16(src + 6);
+    }
+}
+
+#if defined(HARP_X86_DISPATCH)
+/* Four samples per iteration: a0 b0 c0 d0 | a1 b1 c1 d1 | ... becomes a0 a1 a2 a3 | b0 ... */
+__attribute__((target("sse2")))
+inline void deinterleave4_sse2(const std::uint8_t *src, std::size_t stride, std::size_t n, std::int16_t *const *dst)
+{
+    std::size_t i = 0;
+
+    for (; i + 4 <= n; i += 4, src += 4 * stride)
+    {
+        __m128i s0 = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src));
+        __m128i s1 = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + stride));
+        __m128i s2 = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + 2 * stride));
+        __m128i s3 = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + 3 * stride));
+
+        __m128i s01 = _mm_unpacklo_epi16(s0, s1);
+        __m128i s23 = _mm_unpacklo_epi16(s2, s3);
+        __m128i ab = _mm_unpacklo_epi32(s01, s23);
+        __m128i cd = _mm_unpackhi_epi32(s01, s23);
+
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst[0] + i), ab);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst[1] + i), _mm_srli_si128(ab, 8));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst[2] + i), cd);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst[3] + i), _mm_srli_si128(cd, 8));
+    }
+
+    std::int16_t *rest[4] = {dst[0] + i, dst[1] + i, dst[2] + i, dst[3] + i};
+    deinterleave4_scalar(src, stride, n - i, rest);
+}
+
+/* Eight samples per iteration, the low lane holds samples 0-3 and the high lane 4-7 */
+__attribute__((target("avx2")))
+inline void deinterleave4_avx2(const std::uint8_t *src, std::size_t stride, std::size_t n, std::int16_t *const *dst)
+{
+    std::size_t i = 0;
+
+    for (; i + 8 <= n; i += 8, src += 8 * stride)
+    {
+        __m256i s[4];
+
+        for (int k = 0; k < 4; k++)
+        {
+            __m128i low = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + k * stride));
+            __m128i high = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + (k + 4) * stride));
+            s[k] = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+        }
+
+        __m256i s01 = _mm256_unpacklo_epi16(s[0], s[1]);
+        __m256i s23 = _mm256_unpacklo_epi16(s[2], s[3]);
+
+        /* Each lane has a quarter of a channel in each 64 bits, put the quarters in order */
+        __m256i ab = _mm256_permute4x64_epi64(_mm256_unpacklo_epi32(s01, s23), 0xD8);
+        __m256i cd = _mm256_permute4x64_epi64(_mm256_unpackhi_epi32(s01, s23), 0xD8);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst[0] + i), _mm256_castsi256_si128(ab));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst[1] + i), _mm256_extracti128_si256(ab, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst[2] + i), _mm256_castsi256_si128(cd));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst[3] + i), _mm256_extracti128_si256(cd, 1));
+    }
+
+    std::int16_t *rest[4] = {dst[0] + i, dst[1] + i, dst[2] + i, dst[3] + i};
+    deinterleave4_sse2(src, stride, n - i, rest);
+}
+#endif
+
+} // namespace detail
+
+inline void deinterleave4(const std::uint8_t *src, std::size_t stride, std::size_t n, std::int16_t *const *dst,
+    simd_level level = detect_simd())
+{
+#if defined(HARP_X86_DISPATCH)
+    if (level == simd_level::avx2)
+        return detail::deinterleave4_avx2(src, stride, n, dst);
+    if (level == simd_level::sse2)
+        return detail::deinterleave4_sse2(src, stride, n, dst);
+#endif
+    detail::deinterleave4_scalar(src, stride, n, dst);
+}
+
+/* Any number of channels. Four channels use the kernels above, the other counts are copied one value at a time */
+inline void deinterleave(const std::uint8_t *src, std::size_t stride, std::size_t n, unsigned channels,
+    std::int16_t *const *dst, simd_level level = detect_simd())
+{
+    if (channels == 4)
+        return deinterleave4(src, stride, n, dst, level);
+
+    if (channels == 1 && stride == 2)
+    {
+        std::memcpy(dst[0], src, n * 2);
+        return;
+    }
+
+    for (std::size_t i = 0; i < n; i++, src += stride)
+    {
+        for (unsigned c = 0; c < channels; c++)
+            dst[c][i] = detail::load_s16(src + 2 * c);
+    }
+}
+
+} // namespace harp
+
+#endif // HARP_DEINTERLEAVE_HPP
@@ -0,0 +1,145 @@
+#ifndef HARP_DELTA_HPP
+#define HARP_DELTA_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace harp {
+namespace analog_input {
+
+/************************************************************************/
+/* AnalogDataDelta payloads                                             */
+/************************************************************************/
+/* Sent on address 109 instead of AnalogData when DataEncoding is Delta.
+ * The U8 payload is:
+ *
+ *   enabled channels                 1 byte, as on EnabledChannels
+ *   keyframe                         the S16 values of the first read
+ *   each other value                 the zig-zag encoded difference to the
+ *                                    previous value of its channel, or
+ *                                    delta_escape and the S16 value
+ *
+ * Each event starts with its own keyframe, so it is decoded without the
+ * previous ones. Differences wrap around on 16 bits, like the firmware.
+ */
+constexpr std::uint8_t address_analog_data_delta = 109;
+constexpr std::uint8_t delta_escape = 0xFF;
+
+inline std::uint16_t zigzag_encode(std::int16_t delta)
+{
+    return static_cast<std::uint16_t>((static_cast<std::uint16_t>(delta) << 1) ^ static_cast<std::uint16_t>(delta >> 15));
+}
+
+inline std::int16_t zigzag_decode(std::uint8_t value)
+{
+    return static_cast<std::int16_t>((value >> 1) ^ -(value & 1));
+}
+
+inline std::int16_t read_s16(const std::uint8_t *p)
+{
+    return static_cast<std::int16_t>(p[0] | (p[1] << 8));
+}
+
+/* The most reads a payload of this size can hold, to size the destination */
+inline std::size_t delta_max_reads(std::size_t size, unsigned n_enabled)
+{
+    if (!n_enabled || size < 1 + 2 * n_enabled)
+        return 0;
+    return 1 + (size - 1 - 2 * n_enabled) / n_enabled;
+}
+
+/* Decodes the reads of a payload to dst[k], one array per enabled channel
+ * in channel order, each holding delta_max_reads() values. Returns the
+ * number of reads, or 0 if the payload is truncated or its channels are
+ * not enabled_channels.
+ */
+inline std::size_t delta_decode(const std::uint8_t *payload, std::size_t size, std::uint8_t enabled_channels,
+    std::int16_t *const *dst)
+{
+    unsigned n_enabled = 0;
+    for (unsigned c = 0; c < 4; c++)
+        n_enabled += (enabled_channels >> c) & 1;
+
+    if (!delta_max_reads(size, n_enabled) || payload[0] != enabled_channels)
+        return 0;
+
+    const std::uint8_t *p = payload + 1;
+    const std::uint8_t *end = payload + size;
+    std::int16_t previous[4];
+
+    for (unsigned k = 0; k < n_enabled; k++, p += 2)
+        previous[k] = dst[k][0] = read_s16(p);
+
+    std::size_t reads = 1;
+
+    while (p < end)
+    {
+        for (unsigned k = 0; k < n_enabled; k++)
+        {
+            if (p >= end)
+                return 0;
+
+            if (*p == delta_escape)
+            {
+                if (end - p < 3)
+                    return 0;
+                previous[k] = read_s16(p + 1);
+                p += 3;
+            }
+            else
+            {
+                previous[k] = static_cast<std::int16_t>(static_cast<std::uint16_t>(previous[k]) + static_cast<std::uint16_t>(zigzag_decode(*p)));
+                p++;
+            }
+
+            dst[k][reads] = previous[k];
+        }
+
+        reads++;
+    }
+
+    return reads;
+}
+
+/* Encodes interleaved reads of the enabled channels like the firmware, to
+ * generate streams and check the decoder. out must hold 1 + 3 * values
+ * bytes. Returns the payload size.
+ */
+inline std::size_t delta_encode(const std::int16_t *values, std::size_t reads, std::uint8_t enabled_channels,
+    std::uint8_t *out)
+{
+    unsigned n_enabled = 0;
+    for (unsigned c = 0; c < 4; c++)
+        n_enabled += (enabled_channels >> c) & 1;
+
+    std::uint8_t *p = out;
+    *p++ = enabled_channels;
+
+    for (std::size_t i = 0; i < reads * n_enabled; i++)
+    {
+        std::int16_t value = values[i];
+        std::uint16_t zigzag = i >= n_enabled
+            ? zigzag_encode(static_cast<std::int16_t>(static_cast<std::uint16_t>(value) - static_cast<std::uint16_t>(values[i - n_enabled])))
+            : delta_escape;
+
+        if (zigzag < delta_escape)
+        {
+            *p++ = static_cast<std::uint8_t>(zigzag);
+            continue;
+        }
+
+        /* The keyframe has no escape */
+        if (i >= n_enabled)
+            *p++ = delta_escape;
+
+        *p++ = static_cast<std::uint8_t>(value);
+        *p++ = static_cast<std::uint8_t>(static_cast<std::uint16_t>(value) >> 8);
+    }
+
+    return p - out;
+}
+
+} // namespace analog_input
+} // namespace harp
+
+#endif // HARP_DELTA_HPP
@@ -0,0 +1,198 @@
+#ifndef HARP_MESSAGE_HPP
+#define HARP_MESSAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace harp {
+
+/************************************************************************/
+/* Harp messages                                                        */
+/************************************************************************/
+/* Each message is: type, length, address, port, payload type, timestamp
+ * (when the payload type has data_type::has_timestamp), payload and
+ * checksum. The length counts the bytes after itself and the checksum is
+ * the sum of all the other bytes. Multi-byte values are little-endian.
+ */
+namespace msg_type {
+constexpr std::uint8_t read = 1;
+constexpr std::uint8_t write = 2;
+constexpr std::uint8_t event = 3;
+constexpr std::uint8_t error = 0x08;
+}
+
+namespace data_type {
+constexpr std::uint8_t u8 = 0x01;
+constexpr std::uint8_t s8 = 0x81;
+constexpr std::uint8_t u16 = 0x02;
+constexpr std::uint8_t s16 = 0x82;
+constexpr std::uint8_t u32 = 0x04;
+constexpr std::uint8_t s32 = 0x84;
+constexpr std::uint8_t u64 = 0x08;
+constexpr std::uint8_t s64 = 0x88;
+constexpr std::uint8_t float32 = 0x44;
+
+constexpr std::uint8_t has_timestamp = 0x10;
+constexpr std::uint8_t size_mask = 0x0F;
+}
+
+constexpr std::uint8_t port_device = 255;
+
+/* Type, length, address, port and payload type */
+constexpr std::size_t header_size = 5;
+constexpr std::size_t timestamp_size = 6;
+constexpr std::size_t min_message_size = header_size + 1;
+constexpr std::size_t max_message_size = 255 + 2;
+
+/* The micro field of the timestamp counts 32 us ticks */
+constexpr double seconds_per_tick = 32e-6;
+
+/* Sum of the bytes, 16 at a time with SAD when SSE2 is available */
+inline std::uint8_t sum_bytes(const std::uint8_t *data, std::size_t size)
+{
+    std::uint32_t sum = 0;
+    std::size_t i = 0;
+
+#if defined(__SSE2__)
+    __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(block, zero));
+    }
+
+    sum = static_cast<std::uint32_t>(_mm_cvtsi128_si32(acc) + _mm_cvtsi128_si32(_mm_srli_si128(acc, 8)));
+#endif
+
+    for (; i < size; i++)
+        sum += data[i];
+
+    return static_cast<std::uint8_t>(sum);
+}
+
+inline bool is_valid_payload_type(std::uint8_t type)
+{
+    switch (type & ~data_type::has_timestamp)
+    {
+        case data_type::u8:
+        case data_type::s8:
+        case data_type::u16:
+        case data_type::s16:
+        case data_type::u32:
+        case data_type::s32:
+        case data_type::u64:
+        case data_type::s64:
+        case data_type::float32:
+            return true;
+    }
+    return false;
+}
+
+/* Size of the whole message, or 0 if the header can't start a message */
+inline std::size_t message_size(const std::uint8_t *header)
+{
+    std::uint8_t type = header[0] & ~msg_type::error;
+    std::size_t size = header[1] + 2u;
+
+    if (type < msg_type::read || type > msg_type::event)
+        return 0;
+    if (size < min_message_size || !is_valid_payload_type(header[4]))
+        return 0;
+
+    std::size_t payload = size - header_size - 1;
+    if (header[4] & data_type::has_timestamp)
+    {
+        if (payload < timestamp_size)
+            return 0;
+        payload -= timestamp_size;
+    }
+
+    return payload % (header[4] & data_type::size_mask) ? 0 : size;
+}
+
+/************************************************************************/
+/* Message view                                                         */
+/************************************************************************/
+/* Points into the buffer the message was parsed from, nothing is copied */
+struct message
+{
+    const std::uint8_t *data = nullptr;
+    std::size_t size = 0;
+
+    std::uint8_t type() const { return data[0]; }
+    std::uint8_t address() const { return data[2]; }
+    std::uint8_t port() const { return data[3]; }
+    std::uint8_t payload_type() const { return data[4] & ~data_type::has_timestamp; }
+    bool is_error() const { return data[0] & msg_type::error; }
+    bool has_timestamp() const { return data[4] & data_type::has_timestamp; }
+
+    std::uint32_t seconds() const
+    {
+        std::uint32_t value = 0;
+        if (has_timestamp())
+            std::memcpy(&value, data + header_size, 4);
+        return value;
+    }
+
+    std::uint16_t micros() const
+    {
+        std::uint16_t value = 0;
+        if (has_timestamp())
+            std::memcpy(&value, data + header_size + 4, 2);
+        return value;
+    }
+
+    double timestamp() const { return seconds() + micros() * seconds_per_tick; }
+
+    const std::uint8_t *payload() const { return data + header_size + (has_timestamp() ? timestamp_size : 0); }
+    std::size_t payload_size() const { return size - (payload() - data) - 1; }
+
+    bool checksum_ok() const { return sum_bytes(data, size - 1) == data[size - 1]; }
+};
+
+/* Writes a message with a timestamp and returns its size */
+inline std::size_t write_message(std::uint8_t *out, std::uint8_t type, std::uint8_t address, std::uint8_t type_code,
+    std::uint32_t seconds, std::uint16_t micros, const void *payload, std::size_t payload_size)
+{
+    std::size_t size = header_size + timestamp_size + payload_size + 1;
+
+    out[0] = type;
+    out[1] = static_cast<std::uint8_t>(size - 2);
+    out[2] = address;
+    out[3] = port_device;
+    out[4] = type_code | data_type::has_timestamp;
+    std::memcpy(out + header_size, &seconds, 4);
+    std::memcpy(out + header_size + 4, &micros, 2);
+    std::memcpy(out + header_size + timestamp_size, payload, payload_size);
+    out[size - 1] = sum_bytes(out, size - 1);
+
+    return size;
+}
+
+/* Writes a command, which the host sends without a timestamp, and returns its size */
+inline std::size_t write_command(std::uint8_t *out, std::uint8_t type, std::uint8_t address, std::uint8_t type_code,
+    const void *payload, std::size_t payload_size)
+{
+    std::size_t size = header_size + payload_size + 1;
+
+    out[0] = type;
+    out[1] = static_cast<std::uint8_t>(size - 2);
+    out[2] = address;
+    out[3] = port_device;
+    out[4] = type_code;
+    std::memcpy(out + header_size, payload, payload_size);
+    out[size - 1] = sum_bytes(out, size - 1);
+
+    return size;
+}
+
+} // namespace harp
+
+#endif // HARP_MESSAGE_HPP
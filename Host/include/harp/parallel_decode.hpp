@@ -0,0 +1,227 @@
+#ifndef HARP_PARALLEL_DECODE_HPP
+#define HARP_PARALLEL_DECODE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "analog_data.hpp"
+#include "message.hpp"
+#include "parser.hpp"
+#include "thread_pool.hpp"
+
+namespace harp {
+
+/************************************************************************/
+/* Frame synchronisation                                                */
+/************************************************************************/
+/* Returns the offset of the first message at or after pos that starts a
+ * chain of valid messages: a header that gives a valid length and payload
+ * type, and a good checksum, chain times in a row. A chain cut by the end
+ * of the data is accepted. Returns size when there is none.
+ *
+ * One good checksum in the middle of a payload happens once in 256 tries,
+ * a chain of three once in about 16 million.
+ */
+inline std::size_t find_frame(const std::uint8_t *data, std::size_t size, std::size_t pos, unsigned chain = 3)
+{
+    for (; pos < size; pos++)
+    {
+        std::size_t p = pos;
+        unsigned valid = 0;
+        bool ended = false;
+
+        while (valid < chain)
+        {
+            if (p + header_size > size)
+            {
+                ended = true;
+                break;
+            }
+
+            std::size_t length = message_size(data + p);
+            if (!length)
+                break;
+            if (p + length > size)
+            {
+                ended = true;
+                break;
+            }
+            if (sum_bytes(data + p, length - 1) != data[p + length - 1])
+                break;
+
+            p += length;
+            valid++;
+        }
+
+        if (valid == chain || (valid && ended))
+            return pos;
+    }
+    return size;
+}
+
+namespace analog_input {
+
+/************************************************************************/
+/* Parallel AnalogData decoder                                          */
+/************************************************************************/
+/* Decodes a whole recording in memory, usually a mapped .bin file, on a
+ * thread pool:
+ *
+ * 1. The data is cut in parts of part_size bytes and each cut is moved
+ *    forward to the next message with find_frame(), in parallel.
+ * 2. Each part is parsed by its own analog_data_decoder. There are many
+ *    more parts than threads, so the pool balances them by stealing.
+ * 3. The reads of the parts are copied, in parallel, to one array per
+ *    channel, in the order of the parts.
+ *
+ * The result is the same as parsing the data in one pass, unless a cut
+ * lands on a false chain of valid messages. An incomplete message at the
+ * end of a part is counted as skipped bytes.
+ */
+struct parallel_decode_options
+{
+    analog_data_decoder::options decoder;
+    std::size_t part_size = 8 << 20;
+};
+
+class decoded_analog_data;
+
+inline decoded_analog_data parallel_decode(const std::uint8_t *data, std::size_t size, thread_pool &pool,
+    const parallel_decode_options &opts = parallel_decode_options());
+
+class decoded_analog_data
+{
+public:
+    std::size_t size() const { return size_; }
+
+    /* Points to size() reads, or nullptr if the channel is not enabled */
+    const std::int16_t *channel(unsigned c) const { return channels_[c].get(); }
+    const double *timestamps() const { return timestamps_.get(); }
+
+    std::uint64_t messages = 0;
+    parse_stats stats;
+    /* Bytes of an incomplete message at the end of the data */
+    std::size_t pending = 0;
+    std::size_t parts = 0;
+
+private:
+    friend decoded_analog_data parallel_decode(const std::uint8_t *, std::size_t, thread_pool &,
+        const parallel_decode_options &);
+
+    /* Not initialised, so the pages are first touched by the copies, in parallel */
+    std::unique_ptr<std::int16_t[]> channels_[channel_count];
+    std::unique_ptr<double[]> timestamps_;
+    std::size_t size_ = 0;
+};
+
+inline decoded_analog_data parallel_decode(const std::uint8_t *data, std::size_t size, thread_pool &pool,
+    const parallel_decode_options &opts)
+{
+    struct part
+    {
+        std::size_t begin;
+        std::size_t end;
+        std::unique_ptr<analog_data_decoder> decoder;
+        parse_stats stats;
+        std::size_t pending;
+        std::size_t offset;
+    };
+
+    std::size_t part_size = std::max<std::size_t>(opts.part_size, 16 * max_message_size);
+    std::size_t n_parts = std::max<std::size_t>(1, (size + part_size - 1) / part_size);
+    std::vector<part> parts(n_parts);
+
+    /* The first part starts at 0, where parse() skips any leading garbage itself */
+    parts[0].begin = 0;
+    for (std::size_t i = 1; i < n_parts; i++)
+        pool.submit([&, i] { parts[i].begin = find_frame(data, size, i * part_size); });
+    pool.wait();
+
+    /* A long stretch of garbage can move a cut past the next ones */
+    for (std::size_t i = 1; i < n_parts; i++)
+        parts[i].begin = std::max(parts[i].begin, parts[i - 1].begin);
+    for (std::size_t i = 0; i < n_parts; i++)
+        parts[i].end = i + 1 < n_parts ? parts[i + 1].begin : size;
+
+    std::size_t read_bytes = 2 * enabled_count(opts.decoder.enabled_channels) + header_size + timestamp_size + 1;
+
+    for (std::size_t i = 0; i < n_parts; i++)
+    {
+        pool.submit([&, i]
+        {
+            part &p = parts[i];
+            p.decoder.reset(new analog_data_decoder(opts.decoder));
+            p.decoder->reserve((p.end - p.begin) / read_bytes + 1);
+
+            std::size_t consumed = parse(data + p.begin, p.end - p.begin, *p.decoder, p.stats);
+            p.pending = p.end - p.begin - consumed;
+        });
+    }
+    pool.wait();
+
+    decoded_analog_data result;
+    std::size_t total = 0;
+
+    for (std::size_t i = 0; i < n_parts; i++)
+    {
+        part &p = parts[i];
+        p.offset = total;
+        total += p.decoder->size();
+
+        result.messages += p.decoder->messages();
+        result.stats.messages += p.stats.messages;
+        result.stats.runs += p.stats.runs;
+        result.stats.bytes += p.stats.bytes;
+        result.stats.skipped_bytes += p.stats.skipped_bytes;
+        result.stats.checksum_errors += p.stats.checksum_errors;
+
+        if (i + 1 < n_parts)
+        {
+            result.stats.skipped_bytes += p.pending;
+            result.stats.bytes += p.pending;
+        }
+        else
+            result.pending = p.pending;
+    }
+
+    result.parts = n_parts;
+    result.size_ = total;
+    result.timestamps_.reset(new double[total]);
+    for (unsigned c = 0; c < channel_count; c++)
+    {
+        if (opts.decoder.enabled_channels & (1 << c))
+            result.channels_[c].reset(new std::int16_t[total]);
+    }
+
+    for (std::size_t i = 0; i < n_parts; i++)
+    {
+        pool.submit([&, i]
+        {
+            part &p = parts[i];
+            std::size_t n = p.decoder->size();
+
+            if (n)
+            {
+                std::memcpy(result.timestamps_.get() + p.offset, p.decoder->timestamps(), n * sizeof(double));
+                for (unsigned c = 0; c < channel_count; c++)
+                {
+                    if (p.decoder->channel(c))
+                        std::memcpy(result.channels_[c].get() + p.offset, p.decoder->channel(c), n * sizeof(std::int16_t));
+                }
+            }
+            p.decoder.reset();
+        });
+    }
+    pool.wait();
+
+    return result;
+}
+
+} // namespace analog_input
+} // namespace harp
+
+#endif // HARP_PARALLEL_DECODE_HPP
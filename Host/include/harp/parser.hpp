@@ -0,0 +1,215 @@
+#ifndef HARP_PARSER_HPP
+#define HARP_PARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "message.hpp"
+
+namespace harp {
+
+/************************************************************************/
+/* Runs of messages                                                     */
+/************************************************************************/
+/* Consecutive messages with the same header, each one stride bytes after
+ * the previous. A device streaming one register sends long runs, which
+ * lets the decoders treat the payloads as a strided array.
+ */
+struct message_run
+{
+    const std::uint8_t *data = nullptr;
+    std::size_t stride = 0;
+    std::size_t count = 0;
+
+    message operator[](std::size_t i) const { return message{data + i * stride, stride}; }
+    message front() const { return (*this)[0]; }
+};
+
+struct parse_stats
+{
+    std::uint64_t messages = 0;
+    std::uint64_t runs = 0;
+    std::uint64_t bytes = 0;
+    std::uint64_t skipped_bytes = 0;
+    std::uint64_t checksum_errors = 0;
+};
+
+/************************************************************************/
+/* Parser                                                               */
+/************************************************************************/
+/* Messages are framed in batches: the headers are walked first, then the
+ * checksums of the whole batch are validated and the valid messages are
+ * handed out as runs. A bad header or checksum skips one byte and the
+ * walk starts again from there, until a valid message is found.
+ */
+constexpr std::size_t parse_batch = 256;
+
+namespace detail {
+
+inline bool same_header(const std::uint8_t *a, const std::uint8_t *b)
+{
+    std::uint32_t x, y;
+    std::memcpy(&x, a, 4);
+    std::memcpy(&y, b, 4);
+    return x == y && a[4] == b[4];
+}
+
+template <class Handler>
+void emit_runs(const std::uint8_t *data, const std::size_t *offsets, std::size_t n, Handler &on_run, parse_stats &stats)
+{
+    std::size_t i = 0;
+
+    while (i < n)
+    {
+        const std::uint8_t *first = data + offsets[i];
+        std::size_t count = 1;
+
+        while (i + count < n && same_header(first, data + offsets[i + count]))
+            count++;
+
+        on_run(message_run{first, first[1] + 2u, count});
+
+        stats.runs++;
+        stats.messages += count;
+        i += count;
+    }
+}
+
+} // namespace detail
+
+/* Parses the messages on data, in place, and calls on_run(message_run) for
+ * each run of valid messages. Returns the number of bytes consumed. The
+ * bytes after that are the start of a message that is not complete yet and
+ * must be passed again, followed by the next bytes of the stream.
+ */
+template <class Handler>
+std::size_t parse(const std::uint8_t *data, std::size_t size, Handler &&on_run, parse_stats &stats)
+{
+    std::size_t offsets[parse_batch];
+    std::size_t pos = 0;
+
+    for (;;)
+    {
+        std::size_t n = 0;
+        std::size_t next = pos;
+        std::size_t length = 0;
+
+        while (n < parse_batch && next + header_size <= size)
+        {
+            length = message_size(data + next);
+            if (!length || next + length > size)
+                break;
+
+            offsets[n++] = next;
+            next += length;
+        }
+
+        std::size_t valid = 0;
+        while (valid < n)
+        {
+            const std::uint8_t *m = data + offsets[valid];
+            std::size_t m_size = m[1] + 2u;
+
+            if (sum_bytes(m, m_size - 1) != m[m_size - 1])
+                break;
+            valid++;
+        }
+
+        if (valid)
+        {
+            detail::emit_runs(data, offsets, valid, on_run, stats);
+            std::size_t end = valid < n ? offsets[valid] : next;
+            stats.bytes += end - pos;
+            pos = end;
+        }
+
+        if (valid < n)
+        {
+            stats.checksum_errors++;
+            stats.skipped_bytes++;
+            stats.bytes++;
+            pos++;
+            continue;
+        }
+
+        if (n == parse_batch)
+            continue;
+
+        /* The walk stopped on a header that can't start a message */
+        if (next + header_size <= size && !length)
+        {
+            stats.skipped_bytes++;
+            stats.bytes++;
+            pos = next + 1;
+            continue;
+        }
+
+        return pos;
+    }
+}
+
+/************************************************************************/
+/* Stream parser                                                        */
+/************************************************************************/
+/* Owns the receive buffer: read the stream straight into prepare() and
+ * call commit() and parse(). Only the incomplete message at the end of
+ * each read is moved, to the start of the buffer.
+ */
+class stream_parser
+{
+public:
+    explicit stream_parser(std::size_t capacity = 1 << 16)
+        : buffer_(capacity < max_message_size ? max_message_size : capacity)
+    {
+    }
+
+    /* Returns space for at least size bytes */
+    std::uint8_t *prepare(std::size_t size)
+    {
+        if (buffer_.size() - end_ < size)
+        {
+            std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+            end_ -= begin_;
+            begin_ = 0;
+
+            if (buffer_.size() - end_ < size)
+                buffer_.resize(end_ + size);
+        }
+        return buffer_.data() + end_;
+    }
+
+    void commit(std::size_t size) { end_ += size; }
+
+    /* Copies data to the buffer, for streams that can't be read in place */
+    void write(const void *data, std::size_t size)
+    {
+        std::memcpy(prepare(size), data, size);
+        commit(size);
+    }
+
+    template <class Handler>
+    void parse(Handler &&on_run)
+    {
+        begin_ += harp::parse(buffer_.data() + begin_, end_ - begin_, on_run, stats_);
+
+        if (begin_ == end_)
+            begin_ = end_ = 0;
+    }
+
+    /* Bytes kept for the next parse() */
+    std::size_t pending() const { return end_ - begin_; }
+
+    const parse_stats &stats() const { return stats_; }
+
+private:
+    std::vector<std::uint8_t> buffer_;
+    std::size_t begin_ = 0;
+    std::size_t end_ = 0;
+    parse_stats stats_;
+};
+
+} // namespace harp
+
+#endif // HARP_PARSER_HPP
@@ -0,0 +1,57 @@
+#ifndef HARP_SERIAL_HPP
+#define HARP_SERIAL_HPP
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace harp {
+
+/************************************************************************/
+/* Serial port                                                          */
+/************************************************************************/
+/* Harp devices talk at 1 Mbaud, 8N1, with no flow control */
+constexpr speed_t serial_baud = B1000000;
+
+/* Opens a serial port in raw mode, or any other file as it is, so the tools
+ * can also read recordings, pipes and the emulator's pty. Reads block until
+ * some data is available.
+ */
+inline int open_device(const std::string &path, int flags = O_RDWR)
+{
+    int fd = ::open(path.c_str(), flags | O_NOCTTY | O_CLOEXEC);
+    if (fd < 0)
+        throw std::system_error(errno, std::generic_category(), path);
+
+    if (isatty(fd))
+    {
+        termios tio;
+
+        if (tcgetattr(fd, &tio))
+            throw std::system_error(errno, std::generic_category(), path);
+
+        cfmakeraw(&tio);
+        cfsetispeed(&tio, serial_baud);
+        cfsetospeed(&tio, serial_baud);
+        tio.c_cflag |= CLOCAL | CREAD;
+        tio.c_cflag &= ~CRTSCTS;
+        tio.c_cc[VMIN] = 1;
+        tio.c_cc[VTIME] = 0;
+
+        if (tcsetattr(fd, TCSANOW, &tio))
+            throw std::system_error(errno, std::generic_category(), path);
+
+        tcflush(fd, TCIOFLUSH);
+    }
+
+    return fd;
+}
+
+} // namespace harp
+
+#endif // HARP_SERIAL_HPP
@@ -0,0 +1,199 @@
+#ifndef HARP_SPEED_HPP
+#define HARP_SPEED_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "analog_data.hpp"
+
+namespace harp {
+namespace analog_input {
+
+/************************************************************************/
+/* Speed Mode frames                                                    */
+/************************************************************************/
+/* While OperationControl is on Speed Mode the firmware writes each read
+ * straight to the link, without the Harp message around it:
+ *
+ *   speed_frame_sync                 1 byte
+ *   sequence                         1 byte, one more on each frame, wraps at 255
+ *   values                           the S16 values of the enabled channels
+ *   checksum                         1 byte, the sum of the other bytes, as on the Harp messages
+ *
+ * EnabledChannels can't change meanwhile, so every frame has the same
+ * length. Stopping the acquisition takes the device back to Standby and
+ * the Harp messages follow the last frame.
+ */
+constexpr std::uint8_t speed_frame_sync = 0xA5;
+
+inline std::size_t speed_frame_size(unsigned n_enabled)
+{
+    return 2 + 2 * n_enabled + 1;
+}
+
+inline std::uint8_t speed_frame_checksum(const std::uint8_t *frame, std::size_t size)
+{
+    std::uint8_t checksum = 0;
+    for (std::size_t i = 0; i + 1 < size; i++)
+        checksum += frame[i];
+    return checksum;
+}
+
+/* Collects the reads of a Speed Mode stream into one array per channel.
+ * The frames have no timestamp, so read i is at start_time plus i
+ * sampling periods, counting the frames lost on the way.
+ *
+ * A value can look like the sync byte, so each frame is only decoded when
+ * its checksum matches and the next one starts right after it. A frame
+ * that lost bytes on the link then has to match both by chance to get
+ * through. Call finish() at the end of the stream for the last one. Bytes
+ * skipped meanwhile are counted on dropped_bytes(), and the gaps in the
+ * sequence on lost(). A gap of 256 frames or more can't be told apart.
+ */
+class speed_decoder
+{
+public:
+    struct options
+    {
+        std::uint8_t enabled_channels = all_channels;
+        double sampling_period = 0.001;
+        /* Time of the first frame, in seconds */
+        double start_time = 0;
+    };
+
+    speed_decoder() : speed_decoder(options()) {}
+
+    explicit speed_decoder(const options &opts)
+        : opts_(opts), n_enabled_(enabled_count(opts.enabled_channels)), frame_size_(speed_frame_size(n_enabled_))
+    {
+        for (unsigned c = 0, k = 0; c < channel_count; c++)
+        {
+            if (opts_.enabled_channels & (1 << c))
+                enabled_[k++] = c;
+        }
+    }
+
+    /* Decodes the frames followed by the start of the next one and keeps the rest for the next call */
+    void feed(const std::uint8_t *data, std::size_t n)
+    {
+        pending_.insert(pending_.end(), data, data + n);
+
+        const std::uint8_t *p = pending_.data();
+        const std::uint8_t *end = p + pending_.size();
+
+        while (static_cast<std::size_t>(end - p) > frame_size_)
+        {
+            const std::uint8_t *next = p + frame_size_;
+
+            if (!valid_frame(p) || next[0] != speed_frame_sync)
+            {
+                dropped_bytes_++;
+                p++;
+                continue;
+            }
+
+            decode_frame(p);
+            p = next;
+        }
+
+        pending_.erase(pending_.begin(), pending_.begin() + (p - pending_.data()));
+    }
+
+    /* Decodes the last frame, which has no next one to follow it */
+    void finish()
+    {
+        std::size_t decoded = 0;
+
+        if (pending_.size() >= frame_size_ && valid_frame(pending_.data()))
+        {
+            decode_frame(pending_.data());
+            decoded = frame_size_;
+        }
+
+        dropped_bytes_ += pending_.size() - decoded;
+        pending_.clear();
+    }
+
+    /* Reads decoded so far, on every enabled channel */
+    std::size_t size() const { return size_; }
+    std::uint64_t lost() const { return lost_; }
+    std::uint64_t dropped_bytes() const { return dropped_bytes_; }
+
+    /* Points to size() reads, or nullptr if the channel is not enabled */
+    const std::int16_t *channel(unsigned c) const
+    {
+        return (opts_.enabled_channels & (1 << c)) ? channels_[c].data() : nullptr;
+    }
+
+    const double *timestamps() const { return timestamps_.data(); }
+
+    /* Drops the reads and the bytes of a partial frame, keeping the memory */
+    void clear()
+    {
+        pending_.clear();
+        size_ = 0;
+        index_ = 0;
+        lost_ = 0;
+        dropped_bytes_ = 0;
+    }
+
+private:
+    bool valid_frame(const std::uint8_t *frame) const
+    {
+        return frame[0] == speed_frame_sync && frame[frame_size_ - 1] == speed_frame_checksum(frame, frame_size_);
+    }
+
+    void decode_frame(const std::uint8_t *frame)
+    {
+        if (size_)
+        {
+            std::uint8_t gap = static_cast<std::uint8_t>(frame[1] - sequence_ - 1);
+            lost_ += gap;
+            index_ += gap;
+        }
+
+        grow(size_ + 1);
+
+        for (unsigned k = 0; k < n_enabled_; k++)
+            channels_[enabled_[k]][size_] = static_cast<std::int16_t>(frame[2 + 2 * k] | (frame[3 + 2 * k] << 8));
+
+        timestamps_[size_] = opts_.start_time + index_ * opts_.sampling_period;
+
+        sequence_ = frame[1];
+        index_++;
+        size_++;
+    }
+
+    void grow(std::size_t reads)
+    {
+        if (reads <= timestamps_.size())
+            return;
+
+        std::size_t capacity = timestamps_.size() ? 2 * timestamps_.size() : 4096;
+        timestamps_.resize(capacity);
+        for (unsigned c = 0; c < channel_count; c++)
+        {
+            if (opts_.enabled_channels & (1 << c))
+                channels_[c].resize(capacity);
+        }
+    }
+
+    options opts_;
+    unsigned n_enabled_;
+    std::size_t frame_size_;
+    unsigned enabled_[channel_count] = {};
+    std::vector<std::uint8_t> pending_;
+    std::vector<std::int16_t> channels_[channel_count];
+    std::vector<double> timestamps_;
+    std::uint8_t sequence_ = 0;
+    std::size_t size_ = 0;
+    std::uint64_t index_ = 0;
+    std::uint64_t lost_ = 0;
+    std::uint64_t dropped_bytes_ = 0;
+};
+
+} // namespace analog_input
+} // namespace harp
+
+#endif // HARP_SPEED_HPP
@@ -0,0 +1,176 @@
+#ifndef HARP_THREAD_POOL_HPP
+#define HARP_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace harp {
+
+/************************************************************************/
+/* Work-stealing thread pool                                            */
+/************************************************************************/
+/* Each worker has its own queue of tasks. It takes its tasks from the back
+ * of its queue and, when the queue is empty, steals from the front of the
+ * others', so the workers that get the cheap tasks help with the rest.
+ *
+ * submit() deals the tasks to the queues in turn. wait() returns when every
+ * task submitted so far is done, and rethrows the first exception a task
+ * threw.
+ */
+class thread_pool
+{
+public:
+    explicit thread_pool(unsigned threads = std::thread::hardware_concurrency())
+    {
+        threads = std::max(threads, 1u);
+
+        for (unsigned i = 0; i < threads; i++)
+            queues_.emplace_back(new queue);
+        for (unsigned i = 0; i < threads; i++)
+            workers_.emplace_back([this, i] { work(i); });
+    }
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+
+        for (auto &worker : workers_)
+            worker.join();
+    }
+
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(workers_.size()); }
+
+    void submit(std::function<void()> task)
+    {
+        queue &q = *queues_[next_++ % queues_.size()];
+
+        /* Counted first, so take() never counts below zero */
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_++;
+            queued_++;
+        }
+        {
+            std::lock_guard<std::mutex> lock(q.mutex);
+            q.tasks.push_back(std::move(task));
+        }
+        wake_.notify_one();
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return pending_ == 0; });
+
+        if (error_)
+        {
+            std::exception_ptr error = error_;
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    struct queue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    bool take(unsigned self, std::function<void()> &task)
+    {
+        {
+            queue &q = *queues_[self];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (!q.tasks.empty())
+            {
+                task = std::move(q.tasks.back());
+                q.tasks.pop_back();
+                queued_--;
+                return true;
+            }
+        }
+
+        for (std::size_t k = 1; k < queues_.size(); k++)
+        {
+            queue &q = *queues_[(self + k) % queues_.size()];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (!q.tasks.empty())
+            {
+                task = std::move(q.tasks.front());
+                q.tasks.pop_front();
+                queued_--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void work(unsigned self)
+    {
+        std::function<void()> task;
+
+        for (;;)
+        {
+            if (!take(self, task))
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                /* submit() counts the task under the lock, so a task queued after take() looked is not missed */
+                wake_.wait(lock, [this] { return stopping_ || queued_ > 0; });
+                if (stopping_)
+                    return;
+                continue;
+            }
+
+            std::exception_ptr error;
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            task = nullptr;
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (error && !error_)
+                error_ = error;
+            if (--pending_ == 0)
+                done_.notify_all();
+        }
+    }
+
+    std::vector<std::unique_ptr<queue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<std::size_t> next_{0};
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    /* Tasks not done yet, and tasks not taken yet by a worker */
+    std::size_t pending_ = 0;
+    std::atomic<std::size_t> queued_{0};
+    bool stopping_ = false;
+    std::exception_ptr error_;
+};
+
+} // namespace harp
+
+#endif // HARP_THREAD_POOL_HPP
@@ -0,0 +1,307 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "harp/analog_data.hpp"
+#include "harp/columnar.hpp"
+#include "harp/parser.hpp"
+
+/************************************************************************/
+/* Columnar AnalogData files                                            */
+/************************************************************************/
+/* Converts the AnalogData of a recording, <name>_33.bin, to the columnar
+ * format of columnar.hpp and queries it. The queries map the file, so they
+ * only read the chunks the index can't rule out.
+ */
+using namespace harp;
+using analog_input::analog_data_decoder;
+
+namespace {
+
+constexpr std::size_t read_size = 1 << 20;
+/* Decoded reads handed to the writer at a time */
+constexpr std::size_t flush_reads = 1 << 20;
+
+void usage()
+{
+    std::fprintf(stderr, "usage: harp_columnar convert [-c <mask>] [-p <us>] [-k <reads>] <in.bin> <out.hcol>\n");
+    std::fprintf(stderr, "       harp_columnar info <file.hcol>\n");
+    std::fprintf(stderr, "       harp_columnar range <file.hcol> <from s> <to s>\n");
+    std::fprintf(stderr, "       harp_columnar cross <file.hcol> <channel> <threshold> [rising|falling|any] [-f <from s>] [-n <max>]\n");
+    std::fprintf(stderr, "  -c <mask>       EnabledChannels of the recording, 0x0F by default\n");
+    std::fprintf(stderr, "  -p <us>         SamplingPeriod, for the reads after the first of a batch, 1000 by default\n");
+    std::fprintf(stderr, "  -k <reads>      reads per chunk, %u by default\n", columnar::default_chunk_reads);
+    std::fprintf(stderr, "Times are Harp timestamps, in seconds\n");
+    std::exit(2);
+}
+
+double elapsed_ms(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::int64_t to_us(double seconds)
+{
+    return std::llround(seconds * 1e6);
+}
+
+int convert(int argc, char *argv[])
+{
+    analog_data_decoder::options opts;
+    std::uint32_t chunk_reads = columnar::default_chunk_reads;
+    std::vector<std::string> paths;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if (!std::strcmp(argv[i], "-c") && i + 1 < argc)
+            opts.enabled_channels = static_cast<std::uint8_t>(std::strtoul(argv[++i], nullptr, 0));
+        else if (!std::strcmp(argv[i], "-p") && i + 1 < argc)
+            opts.sampling_period = std::atof(argv[++i]) / 1e6;
+        else if (!std::strcmp(argv[i], "-k") && i + 1 < argc)
+            chunk_reads = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        else if (argv[i][0] != '-')
+            paths.push_back(argv[i]);
+        else
+            usage();
+    }
+
+    if (paths.size() != 2 || !chunk_reads || !(opts.enabled_channels & analog_input::all_channels))
+        usage();
+
+    int fd = open(paths[0].c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throw std::system_error(errno, std::generic_category(), paths[0]);
+
+    auto start = std::chrono::steady_clock::now();
+    analog_data_decoder decoder(opts);
+    stream_parser parser(2 * read_size);
+    columnar::writer writer(paths[1], opts.enabled_channels, chunk_reads);
+    std::vector<std::int64_t> time_us;
+    std::uint64_t read_bytes = 0;
+
+    decoder.reserve(flush_reads + read_size);
+
+    auto flush = [&]
+    {
+        std::size_t n = decoder.size();
+        const std::int16_t *channels[columnar::max_channels];
+
+        time_us.resize(n);
+        for (std::size_t i = 0; i < n; i++)
+            time_us[i] = to_us(decoder.timestamps()[i]);
+        for (unsigned c = 0; c < columnar::max_channels; c++)
+            channels[c] = decoder.channel(c);
+
+        writer.append(time_us.data(), channels, n);
+        decoder.clear();
+    };
+
+    for (;;)
+    {
+        ssize_t n = read(fd, parser.prepare(read_size), read_size);
+
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0)
+        {
+            int err = errno;
+            close(fd);
+            throw std::system_error(err, std::generic_category(), paths[0]);
+        }
+        if (n == 0)
+            break;
+
+        parser.commit(n);
+        read_bytes += n;
+        parser.parse(decoder);
+
+        if (decoder.size() >= flush_reads)
+            flush();
+    }
+
+    close(fd);
+    flush();
+    std::uint64_t reads = writer.reads();
+    writer.close();
+
+    double ms = elapsed_ms(start);
+    const parse_stats &p = parser.stats();
+
+    std::printf("converted           %llu reads from %llu bytes in %.0f ms, %.0f MB/s\n",
+        static_cast<unsigned long long>(reads), static_cast<unsigned long long>(read_bytes), ms, read_bytes / ms / 1e3);
+    std::printf("messages            %llu, %llu checksum errors, %llu bytes skipped, %zu bytes incomplete\n",
+        static_cast<unsigned long long>(p.messages), static_cast<unsigned long long>(p.checksum_errors),
+        static_cast<unsigned long long>(p.skipped_bytes), parser.pending());
+    return 0;
+}
+
+int info(const columnar::reader &file)
+{
+    const columnar::file_header &h = file.header();
+    std::size_t delta_bytes[5] = {};
+
+    for (std::size_t k = 0; k < file.chunks(); k++)
+        delta_bytes[file.index(k).delta_bytes]++;
+
+    std::printf("reads               %llu in %u chunks of up to %u\n", static_cast<unsigned long long>(h.reads), h.chunks, h.chunk_reads);
+    std::printf("channels            0x%02X\n", h.enabled_channels);
+    std::printf("time                %.6f s to %.6f s\n", h.first_us / 1e6, h.last_us / 1e6);
+    std::printf("timestamp deltas    %zu chunks of 1 byte, %zu of 2 bytes, %zu of 4 bytes\n", delta_bytes[1], delta_bytes[2], delta_bytes[4]);
+
+    for (unsigned c = 0; c < columnar::max_channels; c++)
+    {
+        if (!(h.enabled_channels & (1 << c)))
+            continue;
+
+        int lo = INT16_MAX, hi = INT16_MIN;
+        for (std::size_t k = 0; k < file.chunks(); k++)
+        {
+            lo = std::min<int>(lo, file.index(k).min[c]);
+            hi = std::max<int>(hi, file.index(k).max[c]);
+        }
+        std::printf("channel %u           min %d, max %d\n", c, lo, hi);
+    }
+    return 0;
+}
+
+int range(const columnar::reader &file, double from, double to)
+{
+    auto start = std::chrono::steady_clock::now();
+    std::size_t decoded = 0;
+    std::vector<columnar::slice> slices = file.range(to_us(from), to_us(to), &decoded);
+
+    std::uint64_t reads = 0;
+    std::int64_t sum[columnar::max_channels] = {};
+    int lo[columnar::max_channels], hi[columnar::max_channels];
+
+    for (unsigned c = 0; c < columnar::max_channels; c++)
+    {
+        lo[c] = INT16_MAX;
+        hi[c] = INT16_MIN;
+    }
+
+    for (const auto &s : slices)
+    {
+        reads += s.end - s.begin;
+
+        for (unsigned c = 0; c < columnar::max_channels; c++)
+        {
+            const std::int16_t *values = file.channel(s.chunk, c);
+            for (std::size_t i = s.begin; values && i < s.end; i++)
+            {
+                sum[c] += values[i];
+                lo[c] = std::min<int>(lo[c], values[i]);
+                hi[c] = std::max<int>(hi[c], values[i]);
+            }
+        }
+    }
+
+    double ms = elapsed_ms(start);
+
+    std::printf("reads               %llu\n", static_cast<unsigned long long>(reads));
+    for (unsigned c = 0; reads && c < columnar::max_channels; c++)
+    {
+        if (file.header().enabled_channels & (1 << c))
+            std::printf("channel %u           min %d, max %d, mean %.1f\n", c, lo[c], hi[c], static_cast<double>(sum[c]) / reads);
+    }
+    std::printf("chunks              %zu of %zu read, %zu timestamp columns decoded, %.3f ms\n",
+        slices.size(), file.chunks(), decoded, ms);
+    return 0;
+}
+
+int cross(const columnar::reader &file, int argc, char *argv[])
+{
+    std::vector<const char *> positional;
+    columnar::edge direction = columnar::edge::rising;
+    double from = -1e18;
+    long max_results = 10;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if (!std::strcmp(argv[i], "-f") && i + 1 < argc)
+            from = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "-n") && i + 1 < argc)
+            max_results = std::atol(argv[++i]);
+        else if (!std::strcmp(argv[i], "rising"))
+            direction = columnar::edge::rising;
+        else if (!std::strcmp(argv[i], "falling"))
+            direction = columnar::edge::falling;
+        else if (!std::strcmp(argv[i], "any"))
+            direction = columnar::edge::any;
+        else
+            positional.push_back(argv[i]);
+    }
+
+    if (positional.size() != 2)
+        usage();
+
+    unsigned c = static_cast<unsigned>(std::atoi(positional[0]));
+    std::int16_t threshold = static_cast<std::int16_t>(std::atoi(positional[1]));
+
+    if (c >= columnar::max_channels || !(file.header().enabled_channels & (1 << c)))
+    {
+        std::fprintf(stderr, "harp_columnar: channel %u is not in the file\n", c);
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::int64_t from_us = to_us(from);
+    std::size_t scanned = 0;
+    long found = 0;
+    columnar::crossing x;
+
+    while (found < max_results)
+    {
+        std::size_t n = 0;
+        bool hit = file.find_crossing(c, threshold, direction, from_us, x, &n);
+        scanned += n;
+        if (!hit)
+            break;
+
+        std::printf("%.6f s  %d -> %d\n", x.time_us / 1e6, x.before, x.after);
+        from_us = x.time_us + 1;
+        found++;
+    }
+
+    std::printf("crossings           %ld, %zu chunk scans of %zu chunks, %.3f ms\n", found, scanned, file.chunks(), elapsed_ms(start));
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+        usage();
+
+    std::string command = argv[1];
+
+    try
+    {
+        if (command == "convert")
+            return convert(argc - 2, argv + 2);
+
+        columnar::reader file(argv[2]);
+
+        if (command == "info" && argc == 3)
+            return info(file);
+        if (command == "range" && argc == 5)
+            return range(file, std::atof(argv[3]), std::atof(argv[4]));
+        if (command == "cross")
+            return cross(file, argc - 3, argv + 3);
+    }
+    catch (const std::exception &e)
+    {
+        std::fprintf(stderr, "harp_columnar: %s\n", e.what());
+        return 1;
+    }
+
+    usage();
+}
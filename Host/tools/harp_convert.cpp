@@ -0,0 +1,155 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "harp/parallel_decode.hpp"
+#include "harp/thread_pool.hpp"
+
+/************************************************************************/
+/* Parallel converter of AnalogData recordings                          */
+/************************************************************************/
+/* Maps a recording, <name>_33.bin, decodes it on every core with
+ * parallel_decode() and writes one NumPy .npy array per enabled channel,
+ * int16, and one of timestamps, float64 seconds, ready for numpy.load().
+ */
+using namespace harp;
+using analog_input::decoded_analog_data;
+using analog_input::parallel_decode_options;
+
+namespace {
+
+void usage()
+{
+    std::fprintf(stderr, "usage: harp_convert [options] <in.bin>\n");
+    std::fprintf(stderr, "  -o <prefix>     output files <prefix>_ch<n>.npy and <prefix>_time.npy, the input without .bin by default\n");
+    std::fprintf(stderr, "  -j <threads>    all the cores by default\n");
+    std::fprintf(stderr, "  -c <mask>       EnabledChannels of the recording, 0x0F by default\n");
+    std::fprintf(stderr, "  -p <us>         SamplingPeriod, for the reads after the first of a batch, 1000 by default\n");
+    std::fprintf(stderr, "  -k <KB>         bytes parsed by each task, 8192 by default\n");
+    std::exit(2);
+}
+
+double elapsed_s(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/* NumPy format 1.0: magic, header length, a Python dict padded to 64 bytes, then the data */
+void write_npy(const std::string &path, const char *descr, const void *data, std::size_t count, std::size_t item_size)
+{
+    char dict[128];
+    int n = std::snprintf(dict, sizeof(dict), "{'descr': '%s', 'fortran_order': False, 'shape': (%zu,), }", descr, count);
+
+    std::string header("\x93NUMPY\x01\x00", 8);
+    std::size_t padded = (10 + n + 1 + 63) / 64 * 64 - 10;
+    header += static_cast<char>(padded & 0xFF);
+    header += static_cast<char>(padded >> 8);
+    header.append(dict, n);
+    header.append(padded - n - 1, ' ');
+    header += '\n';
+
+    std::FILE *f = std::fopen(path.c_str(), "wb");
+    if (!f)
+        throw std::system_error(errno, std::generic_category(), path);
+
+    bool ok = std::fwrite(header.data(), 1, header.size(), f) == header.size() &&
+        std::fwrite(data, item_size, count, f) == count;
+    ok = std::fclose(f) == 0 && ok;
+    if (!ok)
+        throw std::system_error(errno, std::generic_category(), path);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    parallel_decode_options opts;
+    unsigned threads = std::thread::hardware_concurrency();
+    std::string input;
+    std::string prefix;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!std::strcmp(argv[i], "-o") && i + 1 < argc)
+            prefix = argv[++i];
+        else if (!std::strcmp(argv[i], "-j") && i + 1 < argc)
+            threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (!std::strcmp(argv[i], "-c") && i + 1 < argc)
+            opts.decoder.enabled_channels = static_cast<std::uint8_t>(std::strtoul(argv[++i], nullptr, 0));
+        else if (!std::strcmp(argv[i], "-p") && i + 1 < argc)
+            opts.decoder.sampling_period = std::atof(argv[++i]) / 1e6;
+        else if (!std::strcmp(argv[i], "-k") && i + 1 < argc)
+            opts.part_size = std::strtoul(argv[++i], nullptr, 10) * 1024;
+        else if (argv[i][0] != '-' && input.empty())
+            input = argv[i];
+        else
+            usage();
+    }
+
+    if (input.empty() || !opts.part_size || !(opts.decoder.enabled_channels & analog_input::all_channels))
+        usage();
+
+    if (prefix.empty())
+        prefix = input.size() > 4 && input.compare(input.size() - 4, 4, ".bin") == 0 ? input.substr(0, input.size() - 4) : input;
+
+    try
+    {
+        int fd = open(input.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), input);
+
+        struct stat st;
+        if (fstat(fd, &st))
+        {
+            int err = errno;
+            close(fd);
+            throw std::system_error(err, std::generic_category(), input);
+        }
+
+        std::size_t size = static_cast<std::size_t>(st.st_size);
+        void *map = size ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+        close(fd);
+        if (map == MAP_FAILED)
+            throw std::system_error(errno, std::generic_category(), input);
+
+        thread_pool pool(threads);
+        auto start = std::chrono::steady_clock::now();
+        decoded_analog_data result = parallel_decode(static_cast<const std::uint8_t *>(map), size, pool, opts);
+        double decoded = elapsed_s(start);
+
+        if (map)
+            munmap(map, size);
+
+        for (unsigned c = 0; c < analog_input::channel_count; c++)
+        {
+            if (opts.decoder.enabled_channels & (1 << c))
+                write_npy(prefix + "_ch" + std::to_string(c) + ".npy", "<i2", result.channel(c), result.size(), 2);
+        }
+        write_npy(prefix + "_time.npy", "<f8", result.timestamps(), result.size(), 8);
+        double written = elapsed_s(start);
+
+        const parse_stats &p = result.stats;
+        std::printf("decoded             %zu reads from %zu bytes in %.3f s, %.2f GB/s on %u threads, %zu parts\n",
+            result.size(), size, decoded, size / decoded / 1e9, pool.size(), result.parts);
+        std::printf("written             %s_*.npy in %.3f s\n", prefix.c_str(), written - decoded);
+        std::printf("messages            %llu, %llu AnalogData, %llu checksum errors, %llu bytes skipped, %zu bytes incomplete\n",
+            static_cast<unsigned long long>(p.messages), static_cast<unsigned long long>(result.messages),
+            static_cast<unsigned long long>(p.checksum_errors), static_cast<unsigned long long>(p.skipped_bytes), result.pending);
+    }
+    catch (const std::exception &e)
+    {
+        std::fprintf(stderr, "harp_convert: %s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,252 @@
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <poll.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "harp/block_writer.hpp"
+#include "harp/parser.hpp"
+#include "harp/serial.hpp"
+
+/************************************************************************/
+/* Recorder of Harp streams                                             */
+/************************************************************************/
+/* Reads a device in large chunks and writes its messages unchanged to one
+ * .bin file per register address, <dir>/<name>_<address>.bin, like the
+ * Bonsai.Harp MessageWriter grouped by register.
+ *
+ * The reads only copy to the block_writer's memory. The disk is written by
+ * its thread, so a stalled disk doesn't stop the reads and the device's
+ * data is not lost while there is memory for the queue.
+ */
+using namespace harp;
+
+namespace {
+
+constexpr std::size_t read_size = 256 * 1024;
+
+/* Registers of the common bank and of the AnalogInput */
+constexpr std::uint8_t address_operation_control = 10;
+constexpr std::uint8_t address_acquisition_state = 32;
+constexpr std::uint8_t operation_standby = 0x60;
+constexpr std::uint8_t operation_active = 0x61;
+
+volatile std::sig_atomic_t running = 1;
+
+void stop(int)
+{
+    running = 0;
+}
+
+void send_u8(int fd, std::uint8_t address, std::uint8_t value)
+{
+    std::uint8_t message[max_message_size];
+    std::size_t size = write_command(message, msg_type::write, address, data_type::u8, &value, 1);
+
+    if (write(fd, message, size) != static_cast<ssize_t>(size))
+        std::perror("write");
+}
+
+struct register_file
+{
+    int id = -1;
+    std::uint64_t messages = 0;
+    std::uint64_t bytes = 0;
+};
+
+void usage()
+{
+    std::fprintf(stderr, "usage: harp_recorder [options] <device>\n");
+    std::fprintf(stderr, "  -o <dir>        output directory, . by default\n");
+    std::fprintf(stderr, "  -n <name>       file name prefix, AnalogInput by default\n");
+    std::fprintf(stderr, "  -b <KB>         block size, 1024 by default\n");
+    std::fprintf(stderr, "  -m <MB>         memory for the blocks waiting for the disk, 1024 by default\n");
+    std::fprintf(stderr, "  -t <seconds>    stop after this time\n");
+    std::fprintf(stderr, "  -q              don't print the status each second\n");
+    std::fprintf(stderr, "  --no-direct     don't use O_DIRECT\n");
+    std::fprintf(stderr, "  --start         set the device Active and start the acquisition, stop it on exit\n");
+    std::fprintf(stderr, "The device is a serial port, the emulator's pty, a recording or - for stdin\n");
+    std::exit(2);
+}
+
+double elapsed_s(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    std::string dir = ".";
+    std::string name = "AnalogInput";
+    std::string device;
+    block_writer::options opts;
+    double duration = 0;
+    bool quiet = false;
+    bool start_acquisition = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+
+        if (arg == "-o" && i + 1 < argc)
+            dir = argv[++i];
+        else if (arg == "-n" && i + 1 < argc)
+            name = argv[++i];
+        else if (arg == "-b" && i + 1 < argc)
+            opts.block_size = std::strtoul(argv[++i], nullptr, 10) * 1024;
+        else if (arg == "-m" && i + 1 < argc)
+            opts.max_memory = std::strtoul(argv[++i], nullptr, 10) << 20;
+        else if (arg == "-t" && i + 1 < argc)
+            duration = std::atof(argv[++i]);
+        else if (arg == "-q")
+            quiet = true;
+        else if (arg == "--no-direct")
+            opts.direct = false;
+        else if (arg == "--start")
+            start_acquisition = true;
+        else if (arg[0] != '-' || arg == "-")
+        {
+            if (!device.empty())
+                usage();
+            device = arg;
+        }
+        else
+            usage();
+    }
+
+    if (device.empty() || !opts.block_size)
+        usage();
+
+    try
+    {
+        if (mkdir(dir.c_str(), 0755) && errno != EEXIST)
+            throw std::system_error(errno, std::generic_category(), dir);
+
+        int fd = device == "-" ? STDIN_FILENO : open_device(device);
+        bool is_device = isatty(fd);
+
+        block_writer writer(opts);
+        stream_parser parser(2 * read_size);
+        register_file files[256];
+        bool direct = true;
+
+        std::signal(SIGINT, stop);
+        std::signal(SIGTERM, stop);
+
+        if (start_acquisition && is_device)
+        {
+            send_u8(fd, address_operation_control, operation_active);
+            send_u8(fd, address_acquisition_state, 1);
+        }
+
+        auto on_run = [&](const message_run &run)
+        {
+            register_file &f = files[run.front().address()];
+
+            if (f.id < 0)
+            {
+                f.id = writer.open(dir + "/" + name + "_" + std::to_string(run.front().address()) + ".bin");
+                direct = direct && writer.is_direct(f.id);
+            }
+
+            std::size_t size = run.count * run.stride;
+            writer.append(f.id, run.data, size);
+            f.messages += run.count;
+            f.bytes += size;
+        };
+
+        auto start = std::chrono::steady_clock::now();
+        double next_status = 1;
+        std::uint64_t read_bytes = 0;
+        std::uint64_t last_read = 0;
+        std::uint64_t last_written = 0;
+
+        while (running)
+        {
+            pollfd pfd = {fd, POLLIN, 0};
+
+            if (poll(&pfd, 1, 100) > 0)
+            {
+                ssize_t n = read(fd, parser.prepare(read_size), read_size);
+
+                if (n == 0 || (n < 0 && errno != EINTR && errno != EAGAIN))
+                    break;
+
+                if (n > 0)
+                {
+                    parser.commit(n);
+                    read_bytes += n;
+                    parser.parse(on_run);
+                }
+            }
+
+            double t = elapsed_s(start);
+
+            if (duration && t >= duration)
+                break;
+
+            if (!quiet && t >= next_status)
+            {
+                block_writer_stats s = writer.stats();
+
+                std::fprintf(stderr, "t %.0f s  read %.2f MB/s  written %.2f MB/s  queued %zu blocks  memory %zu MB  max write %.1f ms\n",
+                    t, (read_bytes - last_read) / 1e6, (s.bytes_written - last_written) / 1e6, s.queued_blocks,
+                    s.allocated_blocks * writer.block_size() >> 20, s.latency.max_us / 1000);
+
+                last_read = read_bytes;
+                last_written = s.bytes_written;
+                next_status += 1;
+            }
+        }
+
+        if (start_acquisition && is_device)
+        {
+            send_u8(fd, address_acquisition_state, 0);
+            send_u8(fd, address_operation_control, operation_standby);
+        }
+
+        double t = elapsed_s(start);
+        writer.close();
+        double t_closed = elapsed_s(start);
+
+        block_writer_stats s = writer.stats();
+        const parse_stats &p = parser.stats();
+
+        std::fprintf(stderr, "recorded            %.3f s\n", t);
+        std::fprintf(stderr, "read                %llu bytes, %.2f MB/s\n", static_cast<unsigned long long>(read_bytes), read_bytes / t / 1e6);
+        std::fprintf(stderr, "written             %llu bytes, %.2f MB/s including the final flush, %s\n",
+            static_cast<unsigned long long>(s.bytes_written), s.bytes_written / t_closed / 1e6, direct ? "O_DIRECT" : "buffered");
+        std::fprintf(stderr, "writes              %llu of up to %zu KB, latency mean %.2f ms, p99 < %.2f ms, max %.2f ms\n",
+            static_cast<unsigned long long>(s.writes), writer.block_size() / 1024, s.latency.mean_us() / 1000,
+            s.latency.percentile_us(0.99) / 1000, s.latency.max_us / 1000);
+        std::fprintf(stderr, "memory              %zu MB, %llu waits for a free block\n",
+            s.allocated_blocks * writer.block_size() >> 20, static_cast<unsigned long long>(s.stalls));
+        std::fprintf(stderr, "messages            %llu, %llu checksum errors, %llu bytes skipped, %zu bytes incomplete\n",
+            static_cast<unsigned long long>(p.messages), static_cast<unsigned long long>(p.checksum_errors),
+            static_cast<unsigned long long>(p.skipped_bytes), parser.pending());
+
+        for (int a = 0; a < 256; a++)
+        {
+            if (files[a].messages)
+                std::fprintf(stderr, "  %s_%d.bin  %llu messages, %llu bytes\n", name.c_str(), a,
+                    static_cast<unsigned long long>(files[a].messages), static_cast<unsigned long long>(files[a].bytes));
+        }
+
+        if (fd != STDIN_FILENO)
+            close(fd);
+    }
+    catch (const std::exception &e)
+    {
+        std::fprintf(stderr, "harp_recorder: %s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+using BenchmarkDotNet.Attributes;
+using Bonsai.Harp;
+using System;
+
+namespace Harp.AnalogInput.Benchmarks
+{
+    /// <summary>
+    /// Measures the time and the heap allocations of parsing one AnalogData event.
+    /// The payload accessors must report 0 B allocated per message.
+    /// </summary>
+    [MemoryDiagnoser]
+    public class AnalogDataBenchmarks
+    {
+        const int BatchSize = 16;
+        const AnalogChannels AllChannels = AnalogChannels.Channel0 | AnalogChannels.Channel1 | AnalogChannels.Channel2 | AnalogChannels.Channel3;
+        const AnalogChannels TwoChannels = AnalogChannels.Channel0 | AnalogChannels.Channel2;
+
+        HarpMessage message;
+        HarpMessage batchMessage;
+        HarpMessage twoChannelMessage;
+        AnalogDataPayload[] destination;
+
+        [GlobalSetup]
+        public void Setup()
+        {
+            var random = new Random(1);
+            short[] Values(int count)
+            {
+                var values = new short[count];
+                for (int i = 0; i < values.Length; i++)
+                {
+                    values[i] = (short)random.Next(short.MinValue, short.MaxValue);
+                }
+                return values;
+            }
+
+            message = HarpMessage.FromInt16(AnalogData.Address, 1234.5, MessageType.Event, Values(AnalogData.RegisterLength));
+            batchMessage = HarpMessage.FromInt16(AnalogData.Address, 1234.5, MessageType.Event, Values(AnalogData.RegisterLength * BatchSize));
+            twoChannelMessage = HarpMessage.FromInt16(AnalogData.Address, 1234.5, MessageType.Event, Values(2 * BatchSize));
+            destination = new AnalogDataPayload[BatchSize];
+        }
+
+        /// <summary>
+        /// The previous accessor, which copied the payload to a new array.
+        /// </summary>
+        [Benchmark(Baseline = true)]
+        public AnalogDataPayload GetPayloadArray()
+        {
+            var payload = message.GetPayloadArray<short>();
+            return new AnalogDataPayload(payload[0], payload[1], payload[2], payload[3]);
+        }
+
+        [Benchmark]
+        public AnalogDataPayload GetPayload()
+        {
+            return AnalogData.GetPayload(message);
+        }
+
+        [Benchmark]
+        public Timestamped<AnalogDataPayload> GetTimestampedPayload()
+        {
+            return AnalogData.GetTimestampedPayload(message);
+        }
+
+        [Benchmark]
+        public int GetBatchPayload()
+        {
+            return AnalogData.GetBatchPayload(batchMessage, AllChannels, destination);
+        }
+
+        [Benchmark]
+        public int GetBatchPayloadTwoChannels()
+        {
+            return AnalogData.GetBatchPayload(twoChannelMessage, TwoChannels, destination);
+        }
+
+        /// <summary>
+        /// Allocates only the new message.
+        /// </summary>
+        [Benchmark]
+        public HarpMessage FromPayload()
+        {
+            return AnalogData.FromPayload(MessageType.Write, default);
+        }
+    }
+}
@@ -0,0 +1,12 @@
+using BenchmarkDotNet.Running;
+
+namespace Harp.AnalogInput.Benchmarks
+{
+    class Program
+    {
+        static void Main(string[] args)
+        {
+            BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+using Bonsai.Harp;
+using System;
+using Xunit;
+
+namespace Harp.AnalogInput.Tests
+{
+    /// <summary>
+    /// Checks that the AnalogData accessors parse each message without allocating.
+    /// </summary>
+    public class AnalogDataAllocationTests
+    {
+        const int BatchSize = 16;
+        const int MessageCount = 1000;
+        const AnalogChannels AllChannels = AnalogChannels.Channel0 | AnalogChannels.Channel1 | AnalogChannels.Channel2 | AnalogChannels.Channel3;
+        const AnalogChannels TwoChannels = AnalogChannels.Channel0 | AnalogChannels.Channel2;
+
+        static short[] Values(int count)
+        {
+            var values = new short[count];
+            for (int i = 0; i < values.Length; i++)
+            {
+                values[i] = (short)(i * 1000 - 16000);
+            }
+            return values;
+        }
+
+        // Bytes allocated on this thread per call, after a first call to JIT the accessor
+        static long AllocatedPerMessage(Action parse)
+        {
+            parse();
+            var before = GC.GetAllocatedBytesForCurrentThread();
+            for (int i = 0; i < MessageCount; i++)
+            {
+                parse();
+            }
+            return (GC.GetAllocatedBytesForCurrentThread() - before) / MessageCount;
+        }
+
+        [Fact]
+        public void GetPayload_DoesNotAllocate()
+        {
+            var message = HarpMessage.FromInt16(AnalogData.Address, 1234.5, MessageType.Event, Values(AnalogData.RegisterLength));
+            var sum = 0;
+            Assert.Equal(0, AllocatedPerMessage(() => sum += AnalogData.GetPayload(message).Channel3));
+            Assert.Equal(0, AllocatedPerMessage(() => sum += AnalogData.GetTimestampedPayload(message).Value.Channel3));
+        }
+
+        [Fact]
+        public void GetBatchPayload_DoesNotAllocate()
+        {
+            var batchMessage = HarpMessage.FromInt16(AnalogData.Address, 1234.5, MessageType.Event, Values(AnalogData.RegisterLength * BatchSize));
+            var twoChannelMessage = HarpMessage.FromInt16(AnalogData.Address, 1234.5, MessageType.Event, Values(2 * BatchSize));
+            var destination = new AnalogDataPayload[BatchSize];
+            var count = 0;
+            Assert.Equal(0, AllocatedPerMessage(() => count += AnalogData.GetBatchPayload(batchMessage, AllChannels, destination)));
+            Assert.Equal(0, AllocatedPerMessage(() => count += AnalogData.GetBatchPayload(twoChannelMessage, TwoChannels, destination)));
+            Assert.Equal(Values(2 * BatchSize)[2 * BatchSize - 1], destination[BatchSize - 1].Channel2);
+        }
+    }
+}
@@ -0,0 +1,227 @@
+using Bonsai;
+using Bonsai.Harp;
+using System;
+using System.ComponentModel;
+using System.Linq;
+using System.Reactive.Linq;
+using System.Runtime.InteropServices;
+
+namespace Harp.AnalogInput
+{
+    public partial class AnalogData
+    {
+        const AnalogChannels AllChannels = AnalogChannels.Channel0 | AnalogChannels.Channel1 | AnalogChannels.Channel2 | AnalogChannels.Channel3;
+
+        [ThreadStatic]
+        static byte[] formatBuffer;
+
+        static ReadOnlySpan<short> GetPayloadSpan(HarpMessage message)
+        {
+            return MemoryMarshal.Cast<byte, short>(message.GetPayload().AsSpan());
+        }
+
+        // The payload varies with BatchSize and EnabledChannels, so the typed payload is only
+        // parsed from messages holding a single read of the four channels
+        static AnalogDataPayload ParsePayload(ArraySegment<byte> payload)
+        {
+            var values = MemoryMarshal.Cast<byte, short>(payload.AsSpan());
+            if (values.Length != RegisterLength)
+            {
+                throw new InvalidOperationException(
+                    $"The AnalogData payload has {values.Length} values instead of a single read of the four channels. " +
+                    "Use GetBatchPayload or ParseAnalogDataBatch when BatchSize is above one or some channels are disabled.");
+            }
+
+            Span<AnalogDataPayload> result = stackalloc AnalogDataPayload[1];
+            ParseBatchPayload(values, AllChannels, result);
+            return result[0];
+        }
+
+        static byte[] FormatPayload(AnalogDataPayload value)
+        {
+            var result = formatBuffer ??= new byte[RegisterLength * sizeof(short)];
+            MemoryMarshal.Write(result, ref value);
+            return result;
+        }
+
+        internal static int GetChannelCount(AnalogChannels channels)
+        {
+            var channelCount = 0;
+            for (int i = 0; i < RegisterLength; i++)
+            {
+                if (((int)channels & (1 << i)) != 0) channelCount++;
+            }
+            return channelCount;
+        }
+
+        static int ParseBatchPayload(ReadOnlySpan<short> payload, AnalogChannels channels, Span<AnalogDataPayload> destination)
+        {
+            var channelCount = GetChannelCount(channels);
+            var count = channelCount > 0 ? payload.Length / channelCount : 0;
+            if (destination.Length < count)
+            {
+                throw new ArgumentException("The destination is shorter than the number of ADC reads in the message.", nameof(destination));
+            }
+
+            if (channels == AllChannels)
+            {
+                // The reads are laid out like the fields of the payload struct
+                MemoryMarshal.Cast<short, AnalogDataPayload>(payload.Slice(0, count * RegisterLength)).CopyTo(destination);
+                return count;
+            }
+
+            var offset = 0;
+            for (int i = 0; i < count; i++)
+            {
+                AnalogDataPayload value = default;
+                if ((channels & AnalogChannels.Channel0) != 0) value.Channel0 = payload[offset++];
+                if ((channels & AnalogChannels.Channel1) != 0) value.Channel1 = payload[offset++];
+                if ((channels & AnalogChannels.Channel2) != 0) value.Channel2 = payload[offset++];
+                if ((channels & AnalogChannels.Channel3) != 0) value.Channel3 = payload[offset++];
+                destination[i] = value;
+            }
+            return count;
+        }
+
+        static AnalogDataPayload[] ParseBatchPayload(ReadOnlySpan<short> payload, AnalogChannels channels)
+        {
+            var channelCount = GetChannelCount(channels);
+            var result = new AnalogDataPayload[channelCount > 0 ? payload.Length / channelCount : 0];
+            ParseBatchPayload(payload, channels, result);
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the number of ADC reads packed in an <see cref="AnalogData"/> register message
+        /// sent with the specified <see cref="EnabledChannels"/>.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="channels">The channels enabled on the device.</param>
+        /// <returns>The number of ADC reads in the message payload.</returns>
+        public static int GetBatchCount(HarpMessage message, AnalogChannels channels)
+        {
+            var channelCount = GetChannelCount(channels);
+            return channelCount > 0 ? GetPayloadSpan(message).Length / channelCount : 0;
+        }
+
+        /// <summary>
+        /// Copies all the ADC reads packed in an <see cref="AnalogData"/> register message
+        /// sent with the specified <see cref="EnabledChannels"/> to a caller provided buffer,
+        /// without allocating.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="channels">The channels enabled on the device. Disabled channels are set to zero.</param>
+        /// <param name="destination">
+        /// The buffer receiving the ADC reads. It must hold at least <see cref="GetBatchCount"/> values.
+        /// </param>
+        /// <returns>The number of ADC reads copied to <paramref name="destination"/>.</returns>
+        public static int GetBatchPayload(HarpMessage message, AnalogChannels channels, Span<AnalogDataPayload> destination)
+        {
+            return ParseBatchPayload(GetPayloadSpan(message), channels, destination);
+        }
+
+        /// <summary>
+        /// Returns all the ADC reads packed in an <see cref="AnalogData"/> register message.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>
+        /// An array with one value for each ADC read in the message payload. The array
+        /// has more than one element when <see cref="BatchSize"/> is above one.
+        /// </returns>
+        public static AnalogDataPayload[] GetBatchPayload(HarpMessage message)
+        {
+            return GetBatchPayload(message, AllChannels);
+        }
+
+        /// <summary>
+        /// Returns all the ADC reads packed in an <see cref="AnalogData"/> register message
+        /// sent with the specified <see cref="EnabledChannels"/>.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="channels">The channels enabled on the device. Disabled channels are set to zero.</param>
+        /// <returns>
+        /// An array with one value for each ADC read in the message payload.
+        /// </returns>
+        public static AnalogDataPayload[] GetBatchPayload(HarpMessage message, AnalogChannels channels)
+        {
+            return ParseBatchPayload(GetPayloadSpan(message), channels);
+        }
+
+        /// <summary>
+        /// Returns all the ADC reads packed in an <see cref="AnalogData"/> register message,
+        /// each timestamped from the message timestamp and the sampling period.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="samplingPeriod">The time between consecutive ADC reads, in seconds.</param>
+        /// <returns>
+        /// An array with one timestamped value for each ADC read in the message payload.
+        /// </returns>
+        public static Timestamped<AnalogDataPayload>[] GetTimestampedBatchPayload(HarpMessage message, double samplingPeriod)
+        {
+            return GetTimestampedBatchPayload(message, samplingPeriod, AllChannels);
+        }
+
+        /// <summary>
+        /// Returns all the ADC reads packed in an <see cref="AnalogData"/> register message
+        /// sent with the specified <see cref="EnabledChannels"/>, each timestamped from the
+        /// message timestamp and the sampling period.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="samplingPeriod">The time between consecutive ADC reads, in seconds.</param>
+        /// <param name="channels">The channels enabled on the device. Disabled channels are set to zero.</param>
+        /// <returns>
+        /// An array with one timestamped value for each ADC read in the message payload.
+        /// </returns>
+        public static Timestamped<AnalogDataPayload>[] GetTimestampedBatchPayload(HarpMessage message, double samplingPeriod, AnalogChannels channels)
+        {
+            var samples = ParseBatchPayload(GetPayloadSpan(message), channels);
+            var seconds = message.GetTimestamp();
+            var result = new Timestamped<AnalogDataPayload>[samples.Length];
+            for (int i = 0; i < result.Length; i++)
+            {
+                result[i] = Timestamped.Create(samples[i], seconds + i * samplingPeriod);
+            }
+            return result;
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that unpacks each <see cref="AnalogData"/> or
+    /// <see cref="AnalogDataDelta"/> event into the sequence of timestamped ADC
+    /// reads packed in its payload.
+    /// </summary>
+    [Description("Unpacks each AnalogData or AnalogDataDelta event into the sequence of timestamped ADC reads packed in its payload.")]
+    public class ParseAnalogDataBatch : Combinator<HarpMessage, Timestamped<AnalogDataPayload>>
+    {
+        /// <summary>
+        /// Gets or sets the time between consecutive ADC reads, in microseconds.
+        /// </summary>
+        [Description("The time between consecutive ADC reads, in microseconds. Use 1000 for SamplingRate1000Hz and 500 for SamplingRate2000Hz, multiplied by the DecimationFactor.")]
+        public int SamplingPeriod { get; set; } = 1000;
+
+        /// <summary>
+        /// Gets or sets the channels enabled on the device.
+        /// </summary>
+        [Description("The channels enabled on the device. Must match the EnabledChannels register. AnalogDataDelta events carry their own.")]
+        public AnalogChannels EnabledChannels { get; set; } = AnalogChannels.Channel0 | AnalogChannels.Channel1 | AnalogChannels.Channel2 | AnalogChannels.Channel3;
+
+        /// <summary>
+        /// Unpacks each <see cref="AnalogData"/> or <see cref="AnalogDataDelta"/> event
+        /// in an observable sequence into the individual timestamped ADC reads.
+        /// </summary>
+        /// <param name="source">The sequence of Harp device messages.</param>
+        /// <returns>
+        /// A sequence of timestamped ADC reads, one for each read packed in the
+        /// <see cref="AnalogData"/> or <see cref="AnalogDataDelta"/> events.
+        /// </returns>
+        public override IObservable<Timestamped<AnalogDataPayload>> Process(IObservable<HarpMessage> source)
+        {
+            return source
+                .Where(message => message.MessageType == MessageType.Event &&
+                    (message.Address == AnalogData.Address || message.Address == AnalogDataDelta.Address))
+                .SelectMany(message => message.Address == AnalogDataDelta.Address
+                    ? AnalogDataDelta.GetTimestampedBatchPayload(message, SamplingPeriod * 1e-6)
+                    : AnalogData.GetTimestampedBatchPayload(message, SamplingPeriod * 1e-6, EnabledChannels));
+        }
+    }
+}
@@ -0,0 +1,156 @@
+using Bonsai.Harp;
+using System;
+
+namespace Harp.AnalogInput
+{
+    public partial class AnalogDataDelta
+    {
+        /// <summary>
+        /// Represents the byte preceding a value that is sent whole, because its
+        /// difference to the previous value does not fit in a byte. This field is constant.
+        /// </summary>
+        public const byte Escape = 0xFF;
+
+        static short ReadInt16(ReadOnlySpan<byte> payload, int offset)
+        {
+            if (offset + 2 > payload.Length)
+            {
+                throw new InvalidOperationException("The AnalogDataDelta payload is truncated.");
+            }
+
+            return (short)(payload[offset] | payload[offset + 1] << 8);
+        }
+
+        // Walks the payload once, decoding to the destination unless only counting the reads
+        static int DecodeBatchPayload(ReadOnlySpan<byte> payload, Span<AnalogDataPayload> destination, bool countOnly)
+        {
+            var channels = payload.Length > 0 ? payload[0] : 0;
+            if (channels == 0 || (channels & ~0x0F) != 0)
+            {
+                throw new InvalidOperationException("The AnalogDataDelta payload does not start with the enabled channels.");
+            }
+
+            Span<short> previous = stackalloc short[AnalogData.RegisterLength];
+            var offset = 1;
+            var count = 0;
+            while (offset < payload.Length)
+            {
+                for (int i = 0; i < AnalogData.RegisterLength; i++)
+                {
+                    if ((channels & (1 << i)) == 0) continue;
+                    if (offset >= payload.Length)
+                    {
+                        throw new InvalidOperationException("The AnalogDataDelta payload is truncated.");
+                    }
+
+                    if (count == 0)
+                    {
+                        // The first read is a keyframe, sent whole without the escape
+                        previous[i] = ReadInt16(payload, offset);
+                        offset += 2;
+                    }
+                    else if (payload[offset] == Escape)
+                    {
+                        previous[i] = ReadInt16(payload, offset + 1);
+                        offset += 3;
+                    }
+                    else
+                    {
+                        var zigzag = payload[offset++];
+                        previous[i] = (short)(previous[i] + ((zigzag >> 1) ^ -(zigzag & 1)));
+                    }
+                }
+
+                if (!countOnly)
+                {
+                    if (count >= destination.Length)
+                    {
+                        throw new ArgumentException("The destination is shorter than the number of ADC reads in the message.", nameof(destination));
+                    }
+
+                    AnalogDataPayload value = default;
+                    if ((channels & 0x01) != 0) value.Channel0 = previous[0];
+                    if ((channels & 0x02) != 0) value.Channel1 = previous[1];
+                    if ((channels & 0x04) != 0) value.Channel2 = previous[2];
+                    if ((channels & 0x08) != 0) value.Channel3 = previous[3];
+                    destination[count] = value;
+                }
+                count++;
+            }
+            return count;
+        }
+
+        /// <summary>
+        /// Returns the channels enabled on the device when an <see cref="AnalogDataDelta"/>
+        /// register message was sent.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>The channels whose reads are encoded in the message payload.</returns>
+        public static AnalogChannels GetChannels(HarpMessage message)
+        {
+            var payload = message.GetPayload();
+            return payload.Count > 0 ? (AnalogChannels)payload.AsSpan()[0] : default;
+        }
+
+        /// <summary>
+        /// Returns the number of ADC reads encoded in an <see cref="AnalogDataDelta"/> register message.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>The number of ADC reads in the message payload.</returns>
+        public static int GetBatchCount(HarpMessage message)
+        {
+            return DecodeBatchPayload(message.GetPayload().AsSpan(), Span<AnalogDataPayload>.Empty, countOnly: true);
+        }
+
+        /// <summary>
+        /// Decodes all the ADC reads encoded in an <see cref="AnalogDataDelta"/> register message
+        /// to a caller provided buffer, without allocating.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="destination">
+        /// The buffer receiving the ADC reads. It must hold at least <see cref="GetBatchCount"/> values.
+        /// Disabled channels are set to zero.
+        /// </param>
+        /// <returns>The number of ADC reads decoded to <paramref name="destination"/>.</returns>
+        public static int GetBatchPayload(HarpMessage message, Span<AnalogDataPayload> destination)
+        {
+            return DecodeBatchPayload(message.GetPayload().AsSpan(), destination, countOnly: false);
+        }
+
+        /// <summary>
+        /// Decodes all the ADC reads encoded in an <see cref="AnalogDataDelta"/> register message.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>
+        /// An array with one value for each ADC read in the message payload. Disabled channels are set to zero.
+        /// </returns>
+        public static AnalogDataPayload[] GetBatchPayload(HarpMessage message)
+        {
+            var payload = message.GetPayload().AsSpan();
+            var result = new AnalogDataPayload[DecodeBatchPayload(payload, Span<AnalogDataPayload>.Empty, countOnly: true)];
+            DecodeBatchPayload(payload, result, countOnly: false);
+            return result;
+        }
+
+        /// <summary>
+        /// Decodes all the ADC reads encoded in an <see cref="AnalogDataDelta"/> register message,
+        /// each timestamped from the message timestamp and the sampling period.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="samplingPeriod">The time between consecutive ADC reads, in seconds.</param>
+        /// <returns>
+        /// An array with one timestamped value for each ADC read in the message payload.
+        /// </returns>
+        public static Timestamped<AnalogDataPayload>[] GetTimestampedBatchPayload(HarpMessage message, double samplingPeriod)
+        {
+            var samples = GetBatchPayload(message);
+            var seconds = message.GetTimestamp();
+            var result = new Timestamped<AnalogDataPayload>[samples.Length];
+            for (int i = 0; i < result.Length; i++)
+            {
+                result[i] = Timestamped.Create(samples[i], seconds + i * samplingPeriod);
+            }
+            return result;
+        }
+    }
+}
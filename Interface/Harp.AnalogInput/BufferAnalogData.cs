@@ -0,0 +1,218 @@
+using Bonsai;
+using Bonsai.Harp;
+using System;
+using System.Collections.Concurrent;
+using System.ComponentModel;
+using System.Reactive;
+using System.Reactive.Linq;
+using System.Runtime.InteropServices;
+
+namespace Harp.AnalogInput
+{
+    /// <summary>
+    /// Represents a fixed number of consecutive ADC reads of the enabled channels,
+    /// stored one channel after the other in a single pooled buffer.
+    /// </summary>
+    /// <remarks>
+    /// Dispose the window when done with it to return its buffer to the pool of the
+    /// operator that emitted it. The buffer must not be used after that.
+    /// </remarks>
+    public sealed class AnalogDataWindow : IDisposable
+    {
+        readonly ConcurrentBag<short[]> pool;
+        short[] data;
+
+        internal AnalogDataWindow(ConcurrentBag<short[]> pool, short[] data, AnalogChannels channels, int channelCount, int length)
+        {
+            this.pool = pool;
+            this.data = data;
+            Channels = channels;
+            ChannelCount = channelCount;
+            Length = length;
+        }
+
+        /// <summary>
+        /// Gets the channels stored in the window.
+        /// </summary>
+        public AnalogChannels Channels { get; }
+
+        /// <summary>
+        /// Gets the number of channels stored in the window.
+        /// </summary>
+        public int ChannelCount { get; }
+
+        /// <summary>
+        /// Gets the number of ADC reads of each channel.
+        /// </summary>
+        public int Length { get; }
+
+        /// <summary>
+        /// Gets the buffer with the reads of all the stored channels, <see cref="Length"/>
+        /// reads of the lowest channel first, then the next one.
+        /// </summary>
+        public short[] Data
+        {
+            get { return data ?? throw new ObjectDisposedException(nameof(AnalogDataWindow)); }
+        }
+
+        /// <summary>
+        /// Returns the reads of the specified channel.
+        /// </summary>
+        /// <param name="channel">The channel, which must be stored in the window.</param>
+        /// <returns>The segment of <see cref="Data"/> with the reads of the channel.</returns>
+        public ArraySegment<short> GetChannel(AnalogChannels channel)
+        {
+            if ((Channels & channel) == 0 || AnalogData.GetChannelCount(channel) != 1)
+            {
+                throw new ArgumentException("The channel is not stored in the window.", nameof(channel));
+            }
+
+            var index = AnalogData.GetChannelCount(Channels & (channel - 1));
+            return new ArraySegment<short>(Data, index * Length, Length);
+        }
+
+        /// <summary>
+        /// Returns the buffer of the window to the pool.
+        /// </summary>
+        public void Dispose()
+        {
+            var buffer = data;
+            data = null;
+            if (buffer != null) pool.Add(buffer);
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that accumulates the ADC reads of <see cref="AnalogData"/> or
+    /// <see cref="AnalogDataDelta"/> events into windows with a fixed number of reads per channel.
+    /// </summary>
+    /// <remarks>
+    /// Each window is timestamped with its first read, using the event timestamp and the
+    /// sampling period for reads after the first of a batch. The buffers are pooled: dispose
+    /// each window when done with it and its buffer is reused for a later window. A window
+    /// that is not complete when the sequence ends is dropped.
+    /// </remarks>
+    [Description("Accumulates the ADC reads of AnalogData or AnalogDataDelta events into windows with a fixed number of reads per channel.")]
+    public class BufferAnalogData : Combinator<HarpMessage, Timestamped<AnalogDataWindow>>
+    {
+        /// <summary>
+        /// Gets or sets the number of ADC reads of each channel in a window.
+        /// </summary>
+        [Description("The number of ADC reads of each channel in a window.")]
+        public int WindowSize { get; set; } = 100;
+
+        /// <summary>
+        /// Gets or sets the time between consecutive ADC reads, in microseconds.
+        /// </summary>
+        [Description("The time between consecutive ADC reads, in microseconds. Only used for the reads after the first in an event, when BatchSize is above one.")]
+        public int SamplingPeriod { get; set; } = 1000;
+
+        /// <summary>
+        /// Gets or sets the channels enabled on the device.
+        /// </summary>
+        [Description("The channels enabled on the device. Must match the EnabledChannels register, and the channels carried by AnalogDataDelta events.")]
+        public AnalogChannels EnabledChannels { get; set; } = AnalogChannels.Channel0 | AnalogChannels.Channel1 | AnalogChannels.Channel2 | AnalogChannels.Channel3;
+
+        /// <summary>
+        /// Accumulates the ADC reads of the <see cref="AnalogData"/> or <see cref="AnalogDataDelta"/>
+        /// events in an observable sequence into windows with a fixed number of reads per channel.
+        /// </summary>
+        /// <param name="source">The sequence of Harp device messages.</param>
+        /// <returns>A sequence of timestamped windows of ADC reads.</returns>
+        public override IObservable<Timestamped<AnalogDataWindow>> Process(IObservable<HarpMessage> source)
+        {
+            return Observable.Create<Timestamped<AnalogDataWindow>>(observer =>
+            {
+                var windowSize = WindowSize;
+                var channels = EnabledChannels;
+                var channelCount = AnalogData.GetChannelCount(channels);
+                var samplingPeriod = SamplingPeriod * 1e-6;
+                if (windowSize <= 0)
+                {
+                    throw new InvalidOperationException("The window size must be positive.");
+                }
+                if (channelCount == 0)
+                {
+                    throw new InvalidOperationException("At least one channel must be enabled.");
+                }
+
+                var pool = new ConcurrentBag<short[]>();
+                short[] buffer = null;
+                double timestamp = 0;
+                var count = 0;
+
+                // The reads of AnalogData hold only the enabled channels, and the decoded reads
+                // of AnalogDataDelta all four, so each channel is taken by its index in a read
+                var identity = new int[channelCount];
+                var channelIndex = new int[channelCount];
+                for (int i = 0, k = 0; i < AnalogData.RegisterLength; i++)
+                {
+                    if (((int)channels & (1 << i)) == 0) continue;
+                    identity[k] = k;
+                    channelIndex[k++] = i;
+                }
+                AnalogDataPayload[] decoded = null;
+
+                void Accumulate(ReadOnlySpan<short> values, int stride, int[] index, double seconds)
+                {
+                    var reads = values.Length / stride;
+                    for (int i = 0; i < reads; i++)
+                    {
+                        if (buffer == null)
+                        {
+                            if (!pool.TryTake(out buffer)) buffer = new short[channelCount * windowSize];
+                            timestamp = seconds + i * samplingPeriod;
+                        }
+
+                        var read = values.Slice(i * stride, stride);
+                        for (int k = 0; k < channelCount; k++)
+                        {
+                            buffer[k * windowSize + count] = read[index[k]];
+                        }
+
+                        if (++count == windowSize)
+                        {
+                            var window = new AnalogDataWindow(pool, buffer, channels, channelCount, windowSize);
+                            buffer = null;
+                            count = 0;
+                            observer.OnNext(Timestamped.Create(window, timestamp));
+                        }
+                    }
+                }
+
+                var messageObserver = Observer.Create<HarpMessage>(
+                    message =>
+                    {
+                        if (message.MessageType != MessageType.Event)
+                        {
+                            return;
+                        }
+
+                        if (message.Address == AnalogData.Address)
+                        {
+                            var payload = MemoryMarshal.Cast<byte, short>(message.GetPayload().AsSpan());
+                            Accumulate(payload, channelCount, identity, message.GetTimestamp());
+                        }
+                        else if (message.Address == AnalogDataDelta.Address)
+                        {
+                            if (AnalogDataDelta.GetChannels(message) != channels)
+                            {
+                                observer.OnError(new InvalidOperationException("The channels of the AnalogDataDelta event do not match the enabled channels."));
+                                return;
+                            }
+
+                            // The decode buffer belongs to the subscription and only grows with the batch size
+                            var reads = AnalogDataDelta.GetBatchCount(message);
+                            if (decoded == null || decoded.Length < reads) decoded = new AnalogDataPayload[reads];
+                            AnalogDataDelta.GetBatchPayload(message, decoded);
+                            var values = MemoryMarshal.Cast<AnalogDataPayload, short>(decoded.AsSpan(0, reads));
+                            Accumulate(values, AnalogData.RegisterLength, channelIndex, message.GetTimestamp());
+                        }
+                    },
+                    observer.OnError,
+                    observer.OnCompleted);
+                return source.SubscribeSafe(messageObserver);
+            });
+        }
+    }
+}
@@ -75,10 +75,10 @@ namespace Harp.AnalogInput
             { 67, typeof(DO1Threshold) },
             { 68, typeof(DO2Threshold) },
             { 69, typeof(DO3Threshold) },
-            { 70, typeof(Reserved17) },
-            { 71, typeof(Reserved18) },
-            { 72, typeof(Reserved19) },
-            { 73, typeof(Reserved20) },
+            { 70, typeof(DO0ThresholdLow) },
+            { 71, typeof(DO1ThresholdLow) },
+            { 72, typeof(DO2ThresholdLow) },
+            { 73, typeof(DO3ThresholdLow) },
             { 74, typeof(DO0TimeAboveThreshold) },
             { 75, typeof(DO1TimeAboveThreshold) },
             { 76, typeof(DO2TimeAboveThreshold) },
@@ -95,7 +95,26 @@ namespace Harp.AnalogInput
             { 87, typeof(Reserved26) },
             { 88, typeof(Reserved27) },
             { 89, typeof(Reserved28) },
-            { 90, typeof(Reserved29) }
+            { 90, typeof(Reserved29) },
+            { 91, typeof(SamplingPeriod) },
+            { 92, typeof(BatchSize) },
+            { 93, typeof(SampleRingOverflows) },
+            { 94, typeof(SampleRingHighWater) },
+            { 95, typeof(ConversionInterval) },
+            { 96, typeof(OversamplingRatio) },
+            { 97, typeof(DecimationFactor) },
+            { 98, typeof(DecimationFilter) },
+            { 99, typeof(ThresholdSource) },
+            { 100, typeof(EnabledChannels) },
+            { 101, typeof(AcquisitionMode) },
+            { 102, typeof(CaptureTrigger) },
+            { 103, typeof(CapturePreSamples) },
+            { 104, typeof(CapturePostSamples) },
+            { 105, typeof(BurstSamples) },
+            { 106, typeof(BurstTrigger) },
+            { 107, typeof(BurstInterval) },
+            { 108, typeof(DataEncoding) },
+            { 109, typeof(AnalogDataDelta) }
         };
 
         /// <summary>
@@ -180,6 +199,10 @@ namespace Harp.AnalogInput
     /// <seealso cref="DO1Threshold"/>
     /// <seealso cref="DO2Threshold"/>
     /// <seealso cref="DO3Threshold"/>
+    /// <seealso cref="DO0ThresholdLow"/>
+    /// <seealso cref="DO1ThresholdLow"/>
+    /// <seealso cref="DO2ThresholdLow"/>
+    /// <seealso cref="DO3ThresholdLow"/>
     /// <seealso cref="DO0TimeAboveThreshold"/>
     /// <seealso cref="DO1TimeAboveThreshold"/>
     /// <seealso cref="DO2TimeAboveThreshold"/>
@@ -188,6 +211,25 @@ namespace Harp.AnalogInput
     /// <seealso cref="DO1TimeBelowThreshold"/>
     /// <seealso cref="DO2TimeBelowThreshold"/>
     /// <seealso cref="DO3TimeBelowThreshold"/>
+    /// <seealso cref="SamplingPeriod"/>
+    /// <seealso cref="BatchSize"/>
+    /// <seealso cref="SampleRingOverflows"/>
+    /// <seealso cref="SampleRingHighWater"/>
+    /// <seealso cref="ConversionInterval"/>
+    /// <seealso cref="OversamplingRatio"/>
+    /// <seealso cref="DecimationFactor"/>
+    /// <seealso cref="DecimationFilter"/>
+    /// <seealso cref="ThresholdSource"/>
+    /// <seealso cref="EnabledChannels"/>
+    /// <seealso cref="AcquisitionMode"/>
+    /// <seealso cref="CaptureTrigger"/>
+    /// <seealso cref="CapturePreSamples"/>
+    /// <seealso cref="CapturePostSamples"/>
+    /// <seealso cref="BurstSamples"/>
+    /// <seealso cref="BurstTrigger"/>
+    /// <seealso cref="BurstInterval"/>
+    /// <seealso cref="DataEncoding"/>
+    /// <seealso cref="AnalogDataDelta"/>
     [XmlInclude(typeof(AcquisitionState))]
     [XmlInclude(typeof(AnalogData))]
     [XmlInclude(typeof(DigitalInputState))]
@@ -209,6 +251,10 @@ namespace Harp.AnalogInput
     [XmlInclude(typeof(DO1Threshold))]
     [XmlInclude(typeof(DO2Threshold))]
     [XmlInclude(typeof(DO3Threshold))]
+    [XmlInclude(typeof(DO0ThresholdLow))]
+    [XmlInclude(typeof(DO1ThresholdLow))]
+    [XmlInclude(typeof(DO2ThresholdLow))]
+    [XmlInclude(typeof(DO3ThresholdLow))]
     [XmlInclude(typeof(DO0TimeAboveThreshold))]
     [XmlInclude(typeof(DO1TimeAboveThreshold))]
     [XmlInclude(typeof(DO2TimeAboveThreshold))]
@@ -217,6 +263,25 @@ namespace Harp.AnalogInput
     [XmlInclude(typeof(DO1TimeBelowThreshold))]
     [XmlInclude(typeof(DO2TimeBelowThreshold))]
     [XmlInclude(typeof(DO3TimeBelowThreshold))]
+    [XmlInclude(typeof(SamplingPeriod))]
+    [XmlInclude(typeof(BatchSize))]
+    [XmlInclude(typeof(SampleRingOverflows))]
+    [XmlInclude(typeof(SampleRingHighWater))]
+    [XmlInclude(typeof(ConversionInterval))]
+    [XmlInclude(typeof(OversamplingRatio))]
+    [XmlInclude(typeof(DecimationFactor))]
+    [XmlInclude(typeof(DecimationFilter))]
+    [XmlInclude(typeof(ThresholdSource))]
+    [XmlInclude(typeof(EnabledChannels))]
+    [XmlInclude(typeof(AcquisitionMode))]
+    [XmlInclude(typeof(CaptureTrigger))]
+    [XmlInclude(typeof(CapturePreSamples))]
+    [XmlInclude(typeof(CapturePostSamples))]
+    [XmlInclude(typeof(BurstSamples))]
+    [XmlInclude(typeof(BurstTrigger))]
+    [XmlInclude(typeof(BurstInterval))]
+    [XmlInclude(typeof(DataEncoding))]
+    [XmlInclude(typeof(AnalogDataDelta))]
     [Description("Filters register-specific messages reported by the AnalogInput device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -259,6 +324,10 @@ namespace Harp.AnalogInput
     /// <seealso cref="DO1Threshold"/>
     /// <seealso cref="DO2Threshold"/>
     /// <seealso cref="DO3Threshold"/>
+    /// <seealso cref="DO0ThresholdLow"/>
+    /// <seealso cref="DO1ThresholdLow"/>
+    /// <seealso cref="DO2ThresholdLow"/>
+    /// <seealso cref="DO3ThresholdLow"/>
     /// <seealso cref="DO0TimeAboveThreshold"/>
     /// <seealso cref="DO1TimeAboveThreshold"/>
     /// <seealso cref="DO2TimeAboveThreshold"/>
@@ -267,6 +336,25 @@ namespace Harp.AnalogInput
     /// <seealso cref="DO1TimeBelowThreshold"/>
     /// <seealso cref="DO2TimeBelowThreshold"/>
     /// <seealso cref="DO3TimeBelowThreshold"/>
+    /// <seealso cref="SamplingPeriod"/>
+    /// <seealso cref="BatchSize"/>
+    /// <seealso cref="SampleRingOverflows"/>
+    /// <seealso cref="SampleRingHighWater"/>
+    /// <seealso cref="ConversionInterval"/>
+    /// <seealso cref="OversamplingRatio"/>
+    /// <seealso cref="DecimationFactor"/>
+    /// <seealso cref="DecimationFilter"/>
+    /// <seealso cref="ThresholdSource"/>
+    /// <seealso cref="EnabledChannels"/>
+    /// <seealso cref="AcquisitionMode"/>
+    /// <seealso cref="CaptureTrigger"/>
+    /// <seealso cref="CapturePreSamples"/>
+    /// <seealso cref="CapturePostSamples"/>
+    /// <seealso cref="BurstSamples"/>
+    /// <seealso cref="BurstTrigger"/>
+    /// <seealso cref="BurstInterval"/>
+    /// <seealso cref="DataEncoding"/>
+    /// <seealso cref="AnalogDataDelta"/>
     [XmlInclude(typeof(AcquisitionState))]
     [XmlInclude(typeof(AnalogData))]
     [XmlInclude(typeof(DigitalInputState))]
@@ -288,6 +376,10 @@ namespace Harp.AnalogInput
     [XmlInclude(typeof(DO1Threshold))]
     [XmlInclude(typeof(DO2Threshold))]
     [XmlInclude(typeof(DO3Threshold))]
+    [XmlInclude(typeof(DO0ThresholdLow))]
+    [XmlInclude(typeof(DO1ThresholdLow))]
+    [XmlInclude(typeof(DO2ThresholdLow))]
+    [XmlInclude(typeof(DO3ThresholdLow))]
     [XmlInclude(typeof(DO0TimeAboveThreshold))]
     [XmlInclude(typeof(DO1TimeAboveThreshold))]
     [XmlInclude(typeof(DO2TimeAboveThreshold))]
@@ -296,6 +388,25 @@ namespace Harp.AnalogInput
     [XmlInclude(typeof(DO1TimeBelowThreshold))]
     [XmlInclude(typeof(DO2TimeBelowThreshold))]
     [XmlInclude(typeof(DO3TimeBelowThreshold))]
+    [XmlInclude(typeof(SamplingPeriod))]
+    [XmlInclude(typeof(BatchSize))]
+    [XmlInclude(typeof(SampleRingOverflows))]
+    [XmlInclude(typeof(SampleRingHighWater))]
+    [XmlInclude(typeof(ConversionInterval))]
+    [XmlInclude(typeof(OversamplingRatio))]
+    [XmlInclude(typeof(DecimationFactor))]
+    [XmlInclude(typeof(DecimationFilter))]
+    [XmlInclude(typeof(ThresholdSource))]
+    [XmlInclude(typeof(EnabledChannels))]
+    [XmlInclude(typeof(AcquisitionMode))]
+    [XmlInclude(typeof(CaptureTrigger))]
+    [XmlInclude(typeof(CapturePreSamples))]
+    [XmlInclude(typeof(CapturePostSamples))]
+    [XmlInclude(typeof(BurstSamples))]
+    [XmlInclude(typeof(BurstTrigger))]
+    [XmlInclude(typeof(BurstInterval))]
+    [XmlInclude(typeof(DataEncoding))]
+    [XmlInclude(typeof(AnalogDataDelta))]
     [XmlInclude(typeof(TimestampedAcquisitionState))]
     [XmlInclude(typeof(TimestampedAnalogData))]
     [XmlInclude(typeof(TimestampedDigitalInputState))]
@@ -317,6 +428,10 @@ namespace Harp.AnalogInput
     [XmlInclude(typeof(TimestampedDO1Threshold))]
     [XmlInclude(typeof(TimestampedDO2Threshold))]
     [XmlInclude(typeof(TimestampedDO3Threshold))]
+    [XmlInclude(typeof(TimestampedDO0ThresholdLow))]
+    [XmlInclude(typeof(TimestampedDO1ThresholdLow))]
+    [XmlInclude(typeof(TimestampedDO2ThresholdLow))]
+    [XmlInclude(typeof(TimestampedDO3ThresholdLow))]
     [XmlInclude(typeof(TimestampedDO0TimeAboveThreshold))]
     [XmlInclude(typeof(TimestampedDO1TimeAboveThreshold))]
     [XmlInclude(typeof(TimestampedDO2TimeAboveThreshold))]
@@ -325,6 +440,25 @@ namespace Harp.AnalogInput
     [XmlInclude(typeof(TimestampedDO1TimeBelowThreshold))]
     [XmlInclude(typeof(TimestampedDO2TimeBelowThreshold))]
     [XmlInclude(typeof(TimestampedDO3TimeBelowThreshold))]
+    [XmlInclude(typeof(TimestampedSamplingPeriod))]
+    [XmlInclude(typeof(TimestampedBatchSize))]
+    [XmlInclude(typeof(TimestampedSampleRingOverflows))]
+    [XmlInclude(typeof(TimestampedSampleRingHighWater))]
+    [XmlInclude(typeof(TimestampedConversionInterval))]
+    [XmlInclude(typeof(TimestampedOversamplingRatio))]
+    [XmlInclude(typeof(TimestampedDecimationFactor))]
+    [XmlInclude(typeof(TimestampedDecimationFilter))]
+    [XmlInclude(typeof(TimestampedThresholdSource))]
+    [XmlInclude(typeof(TimestampedEnabledChannels))]
+    [XmlInclude(typeof(TimestampedAcquisitionMode))]
+    [XmlInclude(typeof(TimestampedCaptureTrigger))]
+    [XmlInclude(typeof(TimestampedCapturePreSamples))]
+    [XmlInclude(typeof(TimestampedCapturePostSamples))]
+    [XmlInclude(typeof(TimestampedBurstSamples))]
+    [XmlInclude(typeof(TimestampedBurstTrigger))]
+    [XmlInclude(typeof(TimestampedBurstInterval))]
+    [XmlInclude(typeof(TimestampedDataEncoding))]
+    [XmlInclude(typeof(TimestampedAnalogDataDelta))]
     [Description("Filters and selects specific messages reported by the AnalogInput device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -364,6 +498,10 @@ namespace Harp.AnalogInput
     /// <seealso cref="DO1Threshold"/>
     /// <seealso cref="DO2Threshold"/>
     /// <seealso cref="DO3Threshold"/>
+    /// <seealso cref="DO0ThresholdLow"/>
+    /// <seealso cref="DO1ThresholdLow"/>
+    /// <seealso cref="DO2ThresholdLow"/>
+    /// <seealso cref="DO3ThresholdLow"/>
     /// <seealso cref="DO0TimeAboveThreshold"/>
     /// <seealso cref="DO1TimeAboveThreshold"/>
     /// <seealso cref="DO2TimeAboveThreshold"/>
@@ -372,6 +510,25 @@ namespace Harp.AnalogInput
     /// <seealso cref="DO1TimeBelowThreshold"/>
     /// <seealso cref="DO2TimeBelowThreshold"/>
     /// <seealso cref="DO3TimeBelowThreshold"/>
+    /// <seealso cref="SamplingPeriod"/>
+    /// <seealso cref="BatchSize"/>
+    /// <seealso cref="SampleRingOverflows"/>
+    /// <seealso cref="SampleRingHighWater"/>
+    /// <seealso cref="ConversionInterval"/>
+    /// <seealso cref="OversamplingRatio"/>
+    /// <seealso cref="DecimationFactor"/>
+    /// <seealso cref="DecimationFilter"/>
+    /// <seealso cref="ThresholdSource"/>
+    /// <seealso cref="EnabledChannels"/>
+    /// <seealso cref="AcquisitionMode"/>
+    /// <seealso cref="CaptureTrigger"/>
+    /// <seealso cref="CapturePreSamples"/>
+    /// <seealso cref="CapturePostSamples"/>
+    /// <seealso cref="BurstSamples"/>
+    /// <seealso cref="BurstTrigger"/>
+    /// <seealso cref="BurstInterval"/>
+    /// <seealso cref="DataEncoding"/>
+    /// <seealso cref="AnalogDataDelta"/>
     [XmlInclude(typeof(AcquisitionState))]
     [XmlInclude(typeof(AnalogData))]
     [XmlInclude(typeof(DigitalInputState))]
@@ -393,6 +550,10 @@ namespace Harp.AnalogInput
     [XmlInclude(typeof(DO1Threshold))]
     [XmlInclude(typeof(DO2Threshold))]
     [XmlInclude(typeof(DO3Threshold))]
+    [XmlInclude(typeof(DO0ThresholdLow))]
+    [XmlInclude(typeof(DO1ThresholdLow))]
+    [XmlInclude(typeof(DO2ThresholdLow))]
+    [XmlInclude(typeof(DO3ThresholdLow))]
     [XmlInclude(typeof(DO0TimeAboveThreshold))]
     [XmlInclude(typeof(DO1TimeAboveThreshold))]
     [XmlInclude(typeof(DO2TimeAboveThreshold))]
@@ -401,6 +562,25 @@ namespace Harp.AnalogInput
     [XmlInclude(typeof(DO1TimeBelowThreshold))]
     [XmlInclude(typeof(DO2TimeBelowThreshold))]
     [XmlInclude(typeof(DO3TimeBelowThreshold))]
+    [XmlInclude(typeof(SamplingPeriod))]
+    [XmlInclude(typeof(BatchSize))]
+    [XmlInclude(typeof(SampleRingOverflows))]
+    [XmlInclude(typeof(SampleRingHighWater))]
+    [XmlInclude(typeof(ConversionInterval))]
+    [XmlInclude(typeof(OversamplingRatio))]
+    [XmlInclude(typeof(DecimationFactor))]
+    [XmlInclude(typeof(DecimationFilter))]
+    [XmlInclude(typeof(ThresholdSource))]
+    [XmlInclude(typeof(EnabledChannels))]
+    [XmlInclude(typeof(AcquisitionMode))]
+    [XmlInclude(typeof(CaptureTrigger))]
+    [XmlInclude(typeof(CapturePreSamples))]
+    [XmlInclude(typeof(CapturePostSamples))]
+    [XmlInclude(typeof(BurstSamples))]
+    [XmlInclude(typeof(BurstTrigger))]
+    [XmlInclude(typeof(BurstInterval))]
+    [XmlInclude(typeof(DataEncoding))]
+    [XmlInclude(typeof(AnalogDataDelta))]
     [Description("Formats a sequence of values as specific AnalogInput register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -513,9 +693,9 @@ namespace Harp.AnalogInput
     }
 
     /// <summary>
-    /// Represents a register that value from a single read of all ADC channels.
+    /// Represents a register that reports BatchSize consecutive reads of the ADC channels set on EnabledChannels. The typed payload is a single read of the four channels.
     /// </summary>
-    [Description("Value from a single read of all ADC channels.")]
+    [Description("Reports BatchSize consecutive reads of the ADC channels set on EnabledChannels. The typed payload is a single read of the four channels.")]
     public partial class AnalogData
     {
         /// <summary>
@@ -533,27 +713,6 @@ namespace Harp.AnalogInput
         /// </summary>
         public const int RegisterLength = 4;
 
-        static AnalogDataPayload ParsePayload(short[] payload)
-        {
-            AnalogDataPayload result;
-            result.Channel0 = payload[0];
-            result.Channel1 = payload[1];
-            result.Channel2 = payload[2];
-            result.Channel3 = payload[3];
-            return result;
-        }
-
-        static short[] FormatPayload(AnalogDataPayload value)
-        {
-            short[] result;
-            result = new short[4];
-            result[0] = value.Channel0;
-            result[1] = value.Channel1;
-            result[2] = value.Channel2;
-            result[3] = value.Channel3;
-            return result;
-        }
-
         /// <summary>
         /// Returns the payload data for <see cref="AnalogData"/> register messages.
         /// </summary>
@@ -561,7 +720,7 @@ namespace Harp.AnalogInput
         /// <returns>A value representing the message payload.</returns>
         public static AnalogDataPayload GetPayload(HarpMessage message)
         {
-            return ParsePayload(message.GetPayloadArray<short>());
+            return ParsePayload(message.GetPayload());
         }
 
         /// <summary>
@@ -571,8 +730,7 @@ namespace Harp.AnalogInput
         /// <returns>A value representing the timestamped message payload.</returns>
         public static Timestamped<AnalogDataPayload> GetTimestampedPayload(HarpMessage message)
         {
-            var payload = message.GetTimestampedPayloadArray<short>();
-            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+            return Timestamped.Create(ParsePayload(message.GetPayload()), message.GetTimestamp());
         }
 
         /// <summary>
@@ -586,7 +744,7 @@ namespace Harp.AnalogInput
         /// </returns>
         public static HarpMessage FromPayload(MessageType messageType, AnalogDataPayload value)
         {
-            return HarpMessage.FromInt16(Address, messageType, FormatPayload(value));
+            return HarpMessage.FromPayload(Address, messageType, RegisterType, FormatPayload(value));
         }
 
         /// <summary>
@@ -602,7 +760,7 @@ namespace Harp.AnalogInput
         /// </returns>
         public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogDataPayload value)
         {
-            return HarpMessage.FromInt16(Address, timestamp, messageType, FormatPayload(value));
+            return HarpMessage.FromPayload(Address, timestamp, messageType, RegisterType, FormatPayload(value));
         }
     }
 
@@ -2843,404 +3001,412 @@ namespace Harp.AnalogInput
     }
 
     /// <summary>
-    /// Represents a register that reserved.
+    /// Represents a register that value below which an ADC read clears DO0 pin. Follows DO0Threshold, without hysteresis, until it is written.
     /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved17
+    [Description("Value below which an ADC read clears DO0 pin. Follows DO0Threshold, without hysteresis, until it is written.")]
+    public partial class DO0ThresholdLow
     {
         /// <summary>
-        /// Represents the address of the <see cref="Reserved17"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO0ThresholdLow"/> register. This field is constant.
         /// </summary>
         public const int Address = 70;
 
         /// <summary>
-        /// Represents the payload type of the <see cref="Reserved17"/> register. This field is constant.
+        /// Represents the payload type of the <see cref="DO0ThresholdLow"/> register. This field is constant.
         /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
+        public const PayloadType RegisterType = PayloadType.S16;
 
         /// <summary>
-        /// Represents the length of the <see cref="Reserved17"/> register. This field is constant.
+        /// Represents the length of the <see cref="DO0ThresholdLow"/> register. This field is constant.
         /// </summary>
         public const int RegisterLength = 1;
-    }
-
-    /// <summary>
-    /// Represents a register that reserved.
-    /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved18
-    {
-        /// <summary>
-        /// Represents the address of the <see cref="Reserved18"/> register. This field is constant.
-        /// </summary>
-        public const int Address = 71;
-
-        /// <summary>
-        /// Represents the payload type of the <see cref="Reserved18"/> register. This field is constant.
-        /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
 
         /// <summary>
-        /// Represents the length of the <see cref="Reserved18"/> register. This field is constant.
+        /// Returns the payload data for <see cref="DO0ThresholdLow"/> register messages.
         /// </summary>
-        public const int RegisterLength = 1;
-    }
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static short GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt16();
+        }
 
-    /// <summary>
-    /// Represents a register that reserved.
-    /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved19
-    {
         /// <summary>
-        /// Represents the address of the <see cref="Reserved19"/> register. This field is constant.
+        /// Returns the timestamped payload data for <see cref="DO0ThresholdLow"/> register messages.
         /// </summary>
-        public const int Address = 72;
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<short> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt16();
+        }
 
         /// <summary>
-        /// Represents the payload type of the <see cref="Reserved19"/> register. This field is constant.
+        /// Returns a Harp message for the <see cref="DO0ThresholdLow"/> register.
         /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0ThresholdLow"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, short value)
+        {
+            return HarpMessage.FromInt16(Address, messageType, value);
+        }
 
         /// <summary>
-        /// Represents the length of the <see cref="Reserved19"/> register. This field is constant.
+        /// Returns a timestamped Harp message for the <see cref="DO0ThresholdLow"/>
+        /// register.
         /// </summary>
-        public const int RegisterLength = 1;
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0ThresholdLow"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, short value)
+        {
+            return HarpMessage.FromInt16(Address, timestamp, messageType, value);
+        }
     }
 
     /// <summary>
-    /// Represents a register that reserved.
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0ThresholdLow register.
     /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved20
+    /// <seealso cref="DO0ThresholdLow"/>
+    [Description("Filters and selects timestamped messages from the DO0ThresholdLow register.")]
+    public partial class TimestampedDO0ThresholdLow
     {
         /// <summary>
-        /// Represents the address of the <see cref="Reserved20"/> register. This field is constant.
-        /// </summary>
-        public const int Address = 73;
-
-        /// <summary>
-        /// Represents the payload type of the <see cref="Reserved20"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO0ThresholdLow"/> register. This field is constant.
         /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
+        public const int Address = DO0ThresholdLow.Address;
 
         /// <summary>
-        /// Represents the length of the <see cref="Reserved20"/> register. This field is constant.
+        /// Returns timestamped payload data for <see cref="DO0ThresholdLow"/> register messages.
         /// </summary>
-        public const int RegisterLength = 1;
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<short> GetPayload(HarpMessage message)
+        {
+            return DO0ThresholdLow.GetTimestampedPayload(message);
+        }
     }
 
     /// <summary>
-    /// Represents a register that time (ms) above threshold value that is required to trigger a DO0 pin event.
+    /// Represents a register that value below which an ADC read clears DO1 pin. Follows DO1Threshold, without hysteresis, until it is written.
     /// </summary>
-    [Description("Time (ms) above threshold value that is required to trigger a DO0 pin event.")]
-    public partial class DO0TimeAboveThreshold
+    [Description("Value below which an ADC read clears DO1 pin. Follows DO1Threshold, without hysteresis, until it is written.")]
+    public partial class DO1ThresholdLow
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO0TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO1ThresholdLow"/> register. This field is constant.
         /// </summary>
-        public const int Address = 74;
+        public const int Address = 71;
 
         /// <summary>
-        /// Represents the payload type of the <see cref="DO0TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the payload type of the <see cref="DO1ThresholdLow"/> register. This field is constant.
         /// </summary>
-        public const PayloadType RegisterType = PayloadType.U16;
+        public const PayloadType RegisterType = PayloadType.S16;
 
         /// <summary>
-        /// Represents the length of the <see cref="DO0TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the length of the <see cref="DO1ThresholdLow"/> register. This field is constant.
         /// </summary>
         public const int RegisterLength = 1;
 
         /// <summary>
-        /// Returns the payload data for <see cref="DO0TimeAboveThreshold"/> register messages.
+        /// Returns the payload data for <see cref="DO1ThresholdLow"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
-        public static ushort GetPayload(HarpMessage message)
+        public static short GetPayload(HarpMessage message)
         {
-            return message.GetPayloadUInt16();
+            return message.GetPayloadInt16();
         }
 
         /// <summary>
-        /// Returns the timestamped payload data for <see cref="DO0TimeAboveThreshold"/> register messages.
+        /// Returns the timestamped payload data for <see cref="DO1ThresholdLow"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        public static Timestamped<short> GetTimestampedPayload(HarpMessage message)
         {
-            return message.GetTimestampedPayloadUInt16();
+            return message.GetTimestampedPayloadInt16();
         }
 
         /// <summary>
-        /// Returns a Harp message for the <see cref="DO0TimeAboveThreshold"/> register.
+        /// Returns a Harp message for the <see cref="DO1ThresholdLow"/> register.
         /// </summary>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TimeAboveThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO1ThresholdLow"/> register
         /// with the specified message type and payload.
         /// </returns>
-        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        public static HarpMessage FromPayload(MessageType messageType, short value)
         {
-            return HarpMessage.FromUInt16(Address, messageType, value);
+            return HarpMessage.FromInt16(Address, messageType, value);
         }
 
         /// <summary>
-        /// Returns a timestamped Harp message for the <see cref="DO0TimeAboveThreshold"/>
+        /// Returns a timestamped Harp message for the <see cref="DO1ThresholdLow"/>
         /// register.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TimeAboveThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO1ThresholdLow"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
-        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, short value)
         {
-            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+            return HarpMessage.FromInt16(Address, timestamp, messageType, value);
         }
     }
 
     /// <summary>
     /// Provides methods for manipulating timestamped messages from the
-    /// DO0TimeAboveThreshold register.
+    /// DO1ThresholdLow register.
     /// </summary>
-    /// <seealso cref="DO0TimeAboveThreshold"/>
-    [Description("Filters and selects timestamped messages from the DO0TimeAboveThreshold register.")]
-    public partial class TimestampedDO0TimeAboveThreshold
+    /// <seealso cref="DO1ThresholdLow"/>
+    [Description("Filters and selects timestamped messages from the DO1ThresholdLow register.")]
+    public partial class TimestampedDO1ThresholdLow
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO0TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO1ThresholdLow"/> register. This field is constant.
         /// </summary>
-        public const int Address = DO0TimeAboveThreshold.Address;
+        public const int Address = DO1ThresholdLow.Address;
 
         /// <summary>
-        /// Returns timestamped payload data for <see cref="DO0TimeAboveThreshold"/> register messages.
+        /// Returns timestamped payload data for <see cref="DO1ThresholdLow"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        public static Timestamped<short> GetPayload(HarpMessage message)
         {
-            return DO0TimeAboveThreshold.GetTimestampedPayload(message);
+            return DO1ThresholdLow.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents a register that time (ms) above threshold value that is required to trigger a DO1 pin event.
+    /// Represents a register that value below which an ADC read clears DO2 pin. Follows DO2Threshold, without hysteresis, until it is written.
     /// </summary>
-    [Description("Time (ms) above threshold value that is required to trigger a DO1 pin event.")]
-    public partial class DO1TimeAboveThreshold
+    [Description("Value below which an ADC read clears DO2 pin. Follows DO2Threshold, without hysteresis, until it is written.")]
+    public partial class DO2ThresholdLow
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO1TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO2ThresholdLow"/> register. This field is constant.
         /// </summary>
-        public const int Address = 75;
+        public const int Address = 72;
 
         /// <summary>
-        /// Represents the payload type of the <see cref="DO1TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the payload type of the <see cref="DO2ThresholdLow"/> register. This field is constant.
         /// </summary>
-        public const PayloadType RegisterType = PayloadType.U16;
+        public const PayloadType RegisterType = PayloadType.S16;
 
         /// <summary>
-        /// Represents the length of the <see cref="DO1TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the length of the <see cref="DO2ThresholdLow"/> register. This field is constant.
         /// </summary>
         public const int RegisterLength = 1;
 
         /// <summary>
-        /// Returns the payload data for <see cref="DO1TimeAboveThreshold"/> register messages.
+        /// Returns the payload data for <see cref="DO2ThresholdLow"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
-        public static ushort GetPayload(HarpMessage message)
+        public static short GetPayload(HarpMessage message)
         {
-            return message.GetPayloadUInt16();
+            return message.GetPayloadInt16();
         }
 
         /// <summary>
-        /// Returns the timestamped payload data for <see cref="DO1TimeAboveThreshold"/> register messages.
+        /// Returns the timestamped payload data for <see cref="DO2ThresholdLow"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        public static Timestamped<short> GetTimestampedPayload(HarpMessage message)
         {
-            return message.GetTimestampedPayloadUInt16();
+            return message.GetTimestampedPayloadInt16();
         }
 
         /// <summary>
-        /// Returns a Harp message for the <see cref="DO1TimeAboveThreshold"/> register.
+        /// Returns a Harp message for the <see cref="DO2ThresholdLow"/> register.
         /// </summary>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO1TimeAboveThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO2ThresholdLow"/> register
         /// with the specified message type and payload.
         /// </returns>
-        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        public static HarpMessage FromPayload(MessageType messageType, short value)
         {
-            return HarpMessage.FromUInt16(Address, messageType, value);
+            return HarpMessage.FromInt16(Address, messageType, value);
         }
 
         /// <summary>
-        /// Returns a timestamped Harp message for the <see cref="DO1TimeAboveThreshold"/>
+        /// Returns a timestamped Harp message for the <see cref="DO2ThresholdLow"/>
         /// register.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO1TimeAboveThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO2ThresholdLow"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
-        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, short value)
         {
-            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+            return HarpMessage.FromInt16(Address, timestamp, messageType, value);
         }
     }
 
     /// <summary>
     /// Provides methods for manipulating timestamped messages from the
-    /// DO1TimeAboveThreshold register.
+    /// DO2ThresholdLow register.
     /// </summary>
-    /// <seealso cref="DO1TimeAboveThreshold"/>
-    [Description("Filters and selects timestamped messages from the DO1TimeAboveThreshold register.")]
-    public partial class TimestampedDO1TimeAboveThreshold
+    /// <seealso cref="DO2ThresholdLow"/>
+    [Description("Filters and selects timestamped messages from the DO2ThresholdLow register.")]
+    public partial class TimestampedDO2ThresholdLow
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO1TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO2ThresholdLow"/> register. This field is constant.
         /// </summary>
-        public const int Address = DO1TimeAboveThreshold.Address;
+        public const int Address = DO2ThresholdLow.Address;
 
         /// <summary>
-        /// Returns timestamped payload data for <see cref="DO1TimeAboveThreshold"/> register messages.
+        /// Returns timestamped payload data for <see cref="DO2ThresholdLow"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        public static Timestamped<short> GetPayload(HarpMessage message)
         {
-            return DO1TimeAboveThreshold.GetTimestampedPayload(message);
+            return DO2ThresholdLow.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents a register that time (ms) above threshold value that is required to trigger a DO2 pin event.
+    /// Represents a register that value below which an ADC read clears DO3 pin. Follows DO3Threshold, without hysteresis, until it is written.
     /// </summary>
-    [Description("Time (ms) above threshold value that is required to trigger a DO2 pin event.")]
-    public partial class DO2TimeAboveThreshold
+    [Description("Value below which an ADC read clears DO3 pin. Follows DO3Threshold, without hysteresis, until it is written.")]
+    public partial class DO3ThresholdLow
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO2TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO3ThresholdLow"/> register. This field is constant.
         /// </summary>
-        public const int Address = 76;
+        public const int Address = 73;
 
         /// <summary>
-        /// Represents the payload type of the <see cref="DO2TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the payload type of the <see cref="DO3ThresholdLow"/> register. This field is constant.
         /// </summary>
-        public const PayloadType RegisterType = PayloadType.U16;
+        public const PayloadType RegisterType = PayloadType.S16;
 
         /// <summary>
-        /// Represents the length of the <see cref="DO2TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the length of the <see cref="DO3ThresholdLow"/> register. This field is constant.
         /// </summary>
         public const int RegisterLength = 1;
 
         /// <summary>
-        /// Returns the payload data for <see cref="DO2TimeAboveThreshold"/> register messages.
+        /// Returns the payload data for <see cref="DO3ThresholdLow"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
-        public static ushort GetPayload(HarpMessage message)
+        public static short GetPayload(HarpMessage message)
         {
-            return message.GetPayloadUInt16();
+            return message.GetPayloadInt16();
         }
 
         /// <summary>
-        /// Returns the timestamped payload data for <see cref="DO2TimeAboveThreshold"/> register messages.
+        /// Returns the timestamped payload data for <see cref="DO3ThresholdLow"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        public static Timestamped<short> GetTimestampedPayload(HarpMessage message)
         {
-            return message.GetTimestampedPayloadUInt16();
+            return message.GetTimestampedPayloadInt16();
         }
 
         /// <summary>
-        /// Returns a Harp message for the <see cref="DO2TimeAboveThreshold"/> register.
+        /// Returns a Harp message for the <see cref="DO3ThresholdLow"/> register.
         /// </summary>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO2TimeAboveThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO3ThresholdLow"/> register
         /// with the specified message type and payload.
         /// </returns>
-        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        public static HarpMessage FromPayload(MessageType messageType, short value)
         {
-            return HarpMessage.FromUInt16(Address, messageType, value);
+            return HarpMessage.FromInt16(Address, messageType, value);
         }
 
         /// <summary>
-        /// Returns a timestamped Harp message for the <see cref="DO2TimeAboveThreshold"/>
+        /// Returns a timestamped Harp message for the <see cref="DO3ThresholdLow"/>
         /// register.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO2TimeAboveThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO3ThresholdLow"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
-        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, short value)
         {
-            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+            return HarpMessage.FromInt16(Address, timestamp, messageType, value);
         }
     }
 
     /// <summary>
     /// Provides methods for manipulating timestamped messages from the
-    /// DO2TimeAboveThreshold register.
+    /// DO3ThresholdLow register.
     /// </summary>
-    /// <seealso cref="DO2TimeAboveThreshold"/>
-    [Description("Filters and selects timestamped messages from the DO2TimeAboveThreshold register.")]
-    public partial class TimestampedDO2TimeAboveThreshold
+    /// <seealso cref="DO3ThresholdLow"/>
+    [Description("Filters and selects timestamped messages from the DO3ThresholdLow register.")]
+    public partial class TimestampedDO3ThresholdLow
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO2TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO3ThresholdLow"/> register. This field is constant.
         /// </summary>
-        public const int Address = DO2TimeAboveThreshold.Address;
+        public const int Address = DO3ThresholdLow.Address;
 
         /// <summary>
-        /// Returns timestamped payload data for <see cref="DO2TimeAboveThreshold"/> register messages.
+        /// Returns timestamped payload data for <see cref="DO3ThresholdLow"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        public static Timestamped<short> GetPayload(HarpMessage message)
         {
-            return DO2TimeAboveThreshold.GetTimestampedPayload(message);
+            return DO3ThresholdLow.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents a register that time (ms) above threshold value that is required to trigger a DO3 pin event.
+    /// Represents a register that time (ms) above threshold value that is required to trigger a DO0 pin event.
     /// </summary>
-    [Description("Time (ms) above threshold value that is required to trigger a DO3 pin event.")]
-    public partial class DO3TimeAboveThreshold
+    [Description("Time (ms) above threshold value that is required to trigger a DO0 pin event.")]
+    public partial class DO0TimeAboveThreshold
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO3TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO0TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
-        public const int Address = 77;
+        public const int Address = 74;
 
         /// <summary>
-        /// Represents the payload type of the <see cref="DO3TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the payload type of the <see cref="DO0TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
         public const PayloadType RegisterType = PayloadType.U16;
 
         /// <summary>
-        /// Represents the length of the <see cref="DO3TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the length of the <see cref="DO0TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
         public const int RegisterLength = 1;
 
         /// <summary>
-        /// Returns the payload data for <see cref="DO3TimeAboveThreshold"/> register messages.
+        /// Returns the payload data for <see cref="DO0TimeAboveThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
@@ -3250,7 +3416,7 @@ namespace Harp.AnalogInput
         }
 
         /// <summary>
-        /// Returns the timestamped payload data for <see cref="DO3TimeAboveThreshold"/> register messages.
+        /// Returns the timestamped payload data for <see cref="DO0TimeAboveThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
@@ -3260,12 +3426,12 @@ namespace Harp.AnalogInput
         }
 
         /// <summary>
-        /// Returns a Harp message for the <see cref="DO3TimeAboveThreshold"/> register.
+        /// Returns a Harp message for the <see cref="DO0TimeAboveThreshold"/> register.
         /// </summary>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO3TimeAboveThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TimeAboveThreshold"/> register
         /// with the specified message type and payload.
         /// </returns>
         public static HarpMessage FromPayload(MessageType messageType, ushort value)
@@ -3274,14 +3440,14 @@ namespace Harp.AnalogInput
         }
 
         /// <summary>
-        /// Returns a timestamped Harp message for the <see cref="DO3TimeAboveThreshold"/>
+        /// Returns a timestamped Harp message for the <see cref="DO0TimeAboveThreshold"/>
         /// register.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO3TimeAboveThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TimeAboveThreshold"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
         public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
@@ -3292,139 +3458,51 @@ namespace Harp.AnalogInput
 
     /// <summary>
     /// Provides methods for manipulating timestamped messages from the
-    /// DO3TimeAboveThreshold register.
+    /// DO0TimeAboveThreshold register.
     /// </summary>
-    /// <seealso cref="DO3TimeAboveThreshold"/>
-    [Description("Filters and selects timestamped messages from the DO3TimeAboveThreshold register.")]
-    public partial class TimestampedDO3TimeAboveThreshold
+    /// <seealso cref="DO0TimeAboveThreshold"/>
+    [Description("Filters and selects timestamped messages from the DO0TimeAboveThreshold register.")]
+    public partial class TimestampedDO0TimeAboveThreshold
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO3TimeAboveThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO0TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
-        public const int Address = DO3TimeAboveThreshold.Address;
+        public const int Address = DO0TimeAboveThreshold.Address;
 
         /// <summary>
-        /// Returns timestamped payload data for <see cref="DO3TimeAboveThreshold"/> register messages.
+        /// Returns timestamped payload data for <see cref="DO0TimeAboveThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
         public static Timestamped<ushort> GetPayload(HarpMessage message)
         {
-            return DO3TimeAboveThreshold.GetTimestampedPayload(message);
+            return DO0TimeAboveThreshold.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents a register that reserved.
+    /// Represents a register that time (ms) above threshold value that is required to trigger a DO1 pin event.
     /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved21
+    [Description("Time (ms) above threshold value that is required to trigger a DO1 pin event.")]
+    public partial class DO1TimeAboveThreshold
     {
         /// <summary>
-        /// Represents the address of the <see cref="Reserved21"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO1TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
-        public const int Address = 78;
-
-        /// <summary>
-        /// Represents the payload type of the <see cref="Reserved21"/> register. This field is constant.
-        /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
-
-        /// <summary>
-        /// Represents the length of the <see cref="Reserved21"/> register. This field is constant.
-        /// </summary>
-        public const int RegisterLength = 1;
-    }
-
-    /// <summary>
-    /// Represents a register that reserved.
-    /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved22
-    {
-        /// <summary>
-        /// Represents the address of the <see cref="Reserved22"/> register. This field is constant.
-        /// </summary>
-        public const int Address = 79;
-
-        /// <summary>
-        /// Represents the payload type of the <see cref="Reserved22"/> register. This field is constant.
-        /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
-
-        /// <summary>
-        /// Represents the length of the <see cref="Reserved22"/> register. This field is constant.
-        /// </summary>
-        public const int RegisterLength = 1;
-    }
-
-    /// <summary>
-    /// Represents a register that reserved.
-    /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved23
-    {
-        /// <summary>
-        /// Represents the address of the <see cref="Reserved23"/> register. This field is constant.
-        /// </summary>
-        public const int Address = 80;
-
-        /// <summary>
-        /// Represents the payload type of the <see cref="Reserved23"/> register. This field is constant.
-        /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
-
-        /// <summary>
-        /// Represents the length of the <see cref="Reserved23"/> register. This field is constant.
-        /// </summary>
-        public const int RegisterLength = 1;
-    }
-
-    /// <summary>
-    /// Represents a register that reserved.
-    /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved24
-    {
-        /// <summary>
-        /// Represents the address of the <see cref="Reserved24"/> register. This field is constant.
-        /// </summary>
-        public const int Address = 81;
-
-        /// <summary>
-        /// Represents the payload type of the <see cref="Reserved24"/> register. This field is constant.
-        /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
-
-        /// <summary>
-        /// Represents the length of the <see cref="Reserved24"/> register. This field is constant.
-        /// </summary>
-        public const int RegisterLength = 1;
-    }
-
-    /// <summary>
-    /// Represents a register that time (ms) below threshold value that is required to trigger a DO0 pin event.
-    /// </summary>
-    [Description("Time (ms) below threshold value that is required to trigger a DO0 pin event.")]
-    public partial class DO0TimeBelowThreshold
-    {
-        /// <summary>
-        /// Represents the address of the <see cref="DO0TimeBelowThreshold"/> register. This field is constant.
-        /// </summary>
-        public const int Address = 82;
+        public const int Address = 75;
 
         /// <summary>
-        /// Represents the payload type of the <see cref="DO0TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the payload type of the <see cref="DO1TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
         public const PayloadType RegisterType = PayloadType.U16;
 
         /// <summary>
-        /// Represents the length of the <see cref="DO0TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the length of the <see cref="DO1TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
         public const int RegisterLength = 1;
 
         /// <summary>
-        /// Returns the payload data for <see cref="DO0TimeBelowThreshold"/> register messages.
+        /// Returns the payload data for <see cref="DO1TimeAboveThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
@@ -3434,7 +3512,7 @@ namespace Harp.AnalogInput
         }
 
         /// <summary>
-        /// Returns the timestamped payload data for <see cref="DO0TimeBelowThreshold"/> register messages.
+        /// Returns the timestamped payload data for <see cref="DO1TimeAboveThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
@@ -3444,12 +3522,12 @@ namespace Harp.AnalogInput
         }
 
         /// <summary>
-        /// Returns a Harp message for the <see cref="DO0TimeBelowThreshold"/> register.
+        /// Returns a Harp message for the <see cref="DO1TimeAboveThreshold"/> register.
         /// </summary>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TimeBelowThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO1TimeAboveThreshold"/> register
         /// with the specified message type and payload.
         /// </returns>
         public static HarpMessage FromPayload(MessageType messageType, ushort value)
@@ -3458,14 +3536,14 @@ namespace Harp.AnalogInput
         }
 
         /// <summary>
-        /// Returns a timestamped Harp message for the <see cref="DO0TimeBelowThreshold"/>
+        /// Returns a timestamped Harp message for the <see cref="DO1TimeAboveThreshold"/>
         /// register.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TimeBelowThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO1TimeAboveThreshold"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
         public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
@@ -3476,51 +3554,51 @@ namespace Harp.AnalogInput
 
     /// <summary>
     /// Provides methods for manipulating timestamped messages from the
-    /// DO0TimeBelowThreshold register.
+    /// DO1TimeAboveThreshold register.
     /// </summary>
-    /// <seealso cref="DO0TimeBelowThreshold"/>
-    [Description("Filters and selects timestamped messages from the DO0TimeBelowThreshold register.")]
-    public partial class TimestampedDO0TimeBelowThreshold
+    /// <seealso cref="DO1TimeAboveThreshold"/>
+    [Description("Filters and selects timestamped messages from the DO1TimeAboveThreshold register.")]
+    public partial class TimestampedDO1TimeAboveThreshold
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO0TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO1TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
-        public const int Address = DO0TimeBelowThreshold.Address;
+        public const int Address = DO1TimeAboveThreshold.Address;
 
         /// <summary>
-        /// Returns timestamped payload data for <see cref="DO0TimeBelowThreshold"/> register messages.
+        /// Returns timestamped payload data for <see cref="DO1TimeAboveThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
         public static Timestamped<ushort> GetPayload(HarpMessage message)
         {
-            return DO0TimeBelowThreshold.GetTimestampedPayload(message);
+            return DO1TimeAboveThreshold.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents a register that time (ms) below threshold value that is required to trigger a DO1 pin event.
+    /// Represents a register that time (ms) above threshold value that is required to trigger a DO2 pin event.
     /// </summary>
-    [Description("Time (ms) below threshold value that is required to trigger a DO1 pin event.")]
-    public partial class DO1TimeBelowThreshold
+    [Description("Time (ms) above threshold value that is required to trigger a DO2 pin event.")]
+    public partial class DO2TimeAboveThreshold
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO1TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO2TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
-        public const int Address = 83;
+        public const int Address = 76;
 
         /// <summary>
-        /// Represents the payload type of the <see cref="DO1TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the payload type of the <see cref="DO2TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
         public const PayloadType RegisterType = PayloadType.U16;
 
         /// <summary>
-        /// Represents the length of the <see cref="DO1TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the length of the <see cref="DO2TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
         public const int RegisterLength = 1;
 
         /// <summary>
-        /// Returns the payload data for <see cref="DO1TimeBelowThreshold"/> register messages.
+        /// Returns the payload data for <see cref="DO2TimeAboveThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
@@ -3530,7 +3608,7 @@ namespace Harp.AnalogInput
         }
 
         /// <summary>
-        /// Returns the timestamped payload data for <see cref="DO1TimeBelowThreshold"/> register messages.
+        /// Returns the timestamped payload data for <see cref="DO2TimeAboveThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
@@ -3540,12 +3618,12 @@ namespace Harp.AnalogInput
         }
 
         /// <summary>
-        /// Returns a Harp message for the <see cref="DO1TimeBelowThreshold"/> register.
+        /// Returns a Harp message for the <see cref="DO2TimeAboveThreshold"/> register.
         /// </summary>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO1TimeBelowThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO2TimeAboveThreshold"/> register
         /// with the specified message type and payload.
         /// </returns>
         public static HarpMessage FromPayload(MessageType messageType, ushort value)
@@ -3554,14 +3632,14 @@ namespace Harp.AnalogInput
         }
 
         /// <summary>
-        /// Returns a timestamped Harp message for the <see cref="DO1TimeBelowThreshold"/>
+        /// Returns a timestamped Harp message for the <see cref="DO2TimeAboveThreshold"/>
         /// register.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO1TimeBelowThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO2TimeAboveThreshold"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
         public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
@@ -3572,51 +3650,51 @@ namespace Harp.AnalogInput
 
     /// <summary>
     /// Provides methods for manipulating timestamped messages from the
-    /// DO1TimeBelowThreshold register.
+    /// DO2TimeAboveThreshold register.
     /// </summary>
-    /// <seealso cref="DO1TimeBelowThreshold"/>
-    [Description("Filters and selects timestamped messages from the DO1TimeBelowThreshold register.")]
-    public partial class TimestampedDO1TimeBelowThreshold
+    /// <seealso cref="DO2TimeAboveThreshold"/>
+    [Description("Filters and selects timestamped messages from the DO2TimeAboveThreshold register.")]
+    public partial class TimestampedDO2TimeAboveThreshold
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO1TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO2TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
-        public const int Address = DO1TimeBelowThreshold.Address;
+        public const int Address = DO2TimeAboveThreshold.Address;
 
         /// <summary>
-        /// Returns timestamped payload data for <see cref="DO1TimeBelowThreshold"/> register messages.
+        /// Returns timestamped payload data for <see cref="DO2TimeAboveThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
         public static Timestamped<ushort> GetPayload(HarpMessage message)
         {
-            return DO1TimeBelowThreshold.GetTimestampedPayload(message);
+            return DO2TimeAboveThreshold.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents a register that time (ms) below threshold value that is required to trigger a DO2 pin event.
+    /// Represents a register that time (ms) above threshold value that is required to trigger a DO3 pin event.
     /// </summary>
-    [Description("Time (ms) below threshold value that is required to trigger a DO2 pin event.")]
-    public partial class DO2TimeBelowThreshold
+    [Description("Time (ms) above threshold value that is required to trigger a DO3 pin event.")]
+    public partial class DO3TimeAboveThreshold
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO2TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO3TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
-        public const int Address = 84;
+        public const int Address = 77;
 
         /// <summary>
-        /// Represents the payload type of the <see cref="DO2TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the payload type of the <see cref="DO3TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
         public const PayloadType RegisterType = PayloadType.U16;
 
         /// <summary>
-        /// Represents the length of the <see cref="DO2TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the length of the <see cref="DO3TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
         public const int RegisterLength = 1;
 
         /// <summary>
-        /// Returns the payload data for <see cref="DO2TimeBelowThreshold"/> register messages.
+        /// Returns the payload data for <see cref="DO3TimeAboveThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the message payload.</returns>
@@ -3626,7 +3704,7 @@ namespace Harp.AnalogInput
         }
 
         /// <summary>
-        /// Returns the timestamped payload data for <see cref="DO2TimeBelowThreshold"/> register messages.
+        /// Returns the timestamped payload data for <see cref="DO3TimeAboveThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
@@ -3636,12 +3714,12 @@ namespace Harp.AnalogInput
         }
 
         /// <summary>
-        /// Returns a Harp message for the <see cref="DO2TimeBelowThreshold"/> register.
+        /// Returns a Harp message for the <see cref="DO3TimeAboveThreshold"/> register.
         /// </summary>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO2TimeBelowThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO3TimeAboveThreshold"/> register
         /// with the specified message type and payload.
         /// </returns>
         public static HarpMessage FromPayload(MessageType messageType, ushort value)
@@ -3650,14 +3728,14 @@ namespace Harp.AnalogInput
         }
 
         /// <summary>
-        /// Returns a timestamped Harp message for the <see cref="DO2TimeBelowThreshold"/>
+        /// Returns a timestamped Harp message for the <see cref="DO3TimeAboveThreshold"/>
         /// register.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO2TimeBelowThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO3TimeAboveThreshold"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
         public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
@@ -3668,92 +3746,180 @@ namespace Harp.AnalogInput
 
     /// <summary>
     /// Provides methods for manipulating timestamped messages from the
-    /// DO2TimeBelowThreshold register.
+    /// DO3TimeAboveThreshold register.
     /// </summary>
-    /// <seealso cref="DO2TimeBelowThreshold"/>
-    [Description("Filters and selects timestamped messages from the DO2TimeBelowThreshold register.")]
-    public partial class TimestampedDO2TimeBelowThreshold
+    /// <seealso cref="DO3TimeAboveThreshold"/>
+    [Description("Filters and selects timestamped messages from the DO3TimeAboveThreshold register.")]
+    public partial class TimestampedDO3TimeAboveThreshold
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO2TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO3TimeAboveThreshold"/> register. This field is constant.
         /// </summary>
-        public const int Address = DO2TimeBelowThreshold.Address;
+        public const int Address = DO3TimeAboveThreshold.Address;
 
         /// <summary>
-        /// Returns timestamped payload data for <see cref="DO2TimeBelowThreshold"/> register messages.
+        /// Returns timestamped payload data for <see cref="DO3TimeAboveThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
         public static Timestamped<ushort> GetPayload(HarpMessage message)
         {
-            return DO2TimeBelowThreshold.GetTimestampedPayload(message);
+            return DO3TimeAboveThreshold.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents a register that time (ms) below threshold value that is required to trigger a DO3 pin event.
+    /// Represents a register that reserved.
     /// </summary>
-    [Description("Time (ms) below threshold value that is required to trigger a DO3 pin event.")]
-    public partial class DO3TimeBelowThreshold
+    [Description("Reserved")]
+    internal partial class Reserved21
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO3TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="Reserved21"/> register. This field is constant.
         /// </summary>
-        public const int Address = 85;
+        public const int Address = 78;
 
         /// <summary>
-        /// Represents the payload type of the <see cref="DO3TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the payload type of the <see cref="Reserved21"/> register. This field is constant.
         /// </summary>
-        public const PayloadType RegisterType = PayloadType.U16;
+        public const PayloadType RegisterType = PayloadType.U8;
 
         /// <summary>
-        /// Represents the length of the <see cref="DO3TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the length of the <see cref="Reserved21"/> register. This field is constant.
         /// </summary>
         public const int RegisterLength = 1;
+    }
 
+    /// <summary>
+    /// Represents a register that reserved.
+    /// </summary>
+    [Description("Reserved")]
+    internal partial class Reserved22
+    {
         /// <summary>
-        /// Returns the payload data for <see cref="DO3TimeBelowThreshold"/> register messages.
+        /// Represents the address of the <see cref="Reserved22"/> register. This field is constant.
         /// </summary>
-        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
-        /// <returns>A value representing the message payload.</returns>
-        public static ushort GetPayload(HarpMessage message)
-        {
-            return message.GetPayloadUInt16();
-        }
+        public const int Address = 79;
 
         /// <summary>
-        /// Returns the timestamped payload data for <see cref="DO3TimeBelowThreshold"/> register messages.
+        /// Represents the payload type of the <see cref="Reserved22"/> register. This field is constant.
         /// </summary>
-        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
-        /// <returns>A value representing the timestamped message payload.</returns>
-        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
-        {
-            return message.GetTimestampedPayloadUInt16();
-        }
+        public const PayloadType RegisterType = PayloadType.U8;
 
         /// <summary>
-        /// Returns a Harp message for the <see cref="DO3TimeBelowThreshold"/> register.
+        /// Represents the length of the <see cref="Reserved22"/> register. This field is constant.
         /// </summary>
-        /// <param name="messageType">The type of the Harp message.</param>
-        /// <param name="value">The value to be stored in the message payload.</param>
-        /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO3TimeBelowThreshold"/> register
-        /// with the specified message type and payload.
-        /// </returns>
-        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        public const int RegisterLength = 1;
+    }
+
+    /// <summary>
+    /// Represents a register that reserved.
+    /// </summary>
+    [Description("Reserved")]
+    internal partial class Reserved23
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Reserved23"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 80;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Reserved23"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Reserved23"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+    }
+
+    /// <summary>
+    /// Represents a register that reserved.
+    /// </summary>
+    [Description("Reserved")]
+    internal partial class Reserved24
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Reserved24"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 81;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Reserved24"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Reserved24"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+    }
+
+    /// <summary>
+    /// Represents a register that time (ms) below threshold value that is required to trigger a DO0 pin event.
+    /// </summary>
+    [Description("Time (ms) below threshold value that is required to trigger a DO0 pin event.")]
+    public partial class DO0TimeBelowThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 82;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0TimeBelowThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0TimeBelowThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0TimeBelowThreshold"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TimeBelowThreshold"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
         {
             return HarpMessage.FromUInt16(Address, messageType, value);
         }
 
         /// <summary>
-        /// Returns a timestamped Harp message for the <see cref="DO3TimeBelowThreshold"/>
+        /// Returns a timestamped Harp message for the <see cref="DO0TimeBelowThreshold"/>
         /// register.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">The type of the Harp message.</param>
         /// <param name="value">The value to be stored in the message payload.</param>
         /// <returns>
-        /// A <see cref="HarpMessage"/> object for the <see cref="DO3TimeBelowThreshold"/> register
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TimeBelowThreshold"/> register
         /// with the specified message type, timestamp, and payload.
         /// </returns>
         public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
@@ -3764,1831 +3930,5272 @@ namespace Harp.AnalogInput
 
     /// <summary>
     /// Provides methods for manipulating timestamped messages from the
-    /// DO3TimeBelowThreshold register.
+    /// DO0TimeBelowThreshold register.
     /// </summary>
-    /// <seealso cref="DO3TimeBelowThreshold"/>
-    [Description("Filters and selects timestamped messages from the DO3TimeBelowThreshold register.")]
-    public partial class TimestampedDO3TimeBelowThreshold
+    /// <seealso cref="DO0TimeBelowThreshold"/>
+    [Description("Filters and selects timestamped messages from the DO0TimeBelowThreshold register.")]
+    public partial class TimestampedDO0TimeBelowThreshold
     {
         /// <summary>
-        /// Represents the address of the <see cref="DO3TimeBelowThreshold"/> register. This field is constant.
+        /// Represents the address of the <see cref="DO0TimeBelowThreshold"/> register. This field is constant.
         /// </summary>
-        public const int Address = DO3TimeBelowThreshold.Address;
+        public const int Address = DO0TimeBelowThreshold.Address;
 
         /// <summary>
-        /// Returns timestamped payload data for <see cref="DO3TimeBelowThreshold"/> register messages.
+        /// Returns timestamped payload data for <see cref="DO0TimeBelowThreshold"/> register messages.
         /// </summary>
         /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
         /// <returns>A value representing the timestamped message payload.</returns>
         public static Timestamped<ushort> GetPayload(HarpMessage message)
         {
-            return DO3TimeBelowThreshold.GetTimestampedPayload(message);
+            return DO0TimeBelowThreshold.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents a register that reserved.
+    /// Represents a register that time (ms) below threshold value that is required to trigger a DO1 pin event.
     /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved25
+    [Description("Time (ms) below threshold value that is required to trigger a DO1 pin event.")]
+    public partial class DO1TimeBelowThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO1TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 83;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO1TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO1TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO1TimeBelowThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO1TimeBelowThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO1TimeBelowThreshold"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO1TimeBelowThreshold"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO1TimeBelowThreshold"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO1TimeBelowThreshold"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO1TimeBelowThreshold register.
+    /// </summary>
+    /// <seealso cref="DO1TimeBelowThreshold"/>
+    [Description("Filters and selects timestamped messages from the DO1TimeBelowThreshold register.")]
+    public partial class TimestampedDO1TimeBelowThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO1TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO1TimeBelowThreshold.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO1TimeBelowThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DO1TimeBelowThreshold.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time (ms) below threshold value that is required to trigger a DO2 pin event.
+    /// </summary>
+    [Description("Time (ms) below threshold value that is required to trigger a DO2 pin event.")]
+    public partial class DO2TimeBelowThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO2TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 84;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO2TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO2TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO2TimeBelowThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO2TimeBelowThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO2TimeBelowThreshold"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO2TimeBelowThreshold"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO2TimeBelowThreshold"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO2TimeBelowThreshold"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO2TimeBelowThreshold register.
+    /// </summary>
+    /// <seealso cref="DO2TimeBelowThreshold"/>
+    [Description("Filters and selects timestamped messages from the DO2TimeBelowThreshold register.")]
+    public partial class TimestampedDO2TimeBelowThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO2TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO2TimeBelowThreshold.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO2TimeBelowThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DO2TimeBelowThreshold.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time (ms) below threshold value that is required to trigger a DO3 pin event.
+    /// </summary>
+    [Description("Time (ms) below threshold value that is required to trigger a DO3 pin event.")]
+    public partial class DO3TimeBelowThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO3TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 85;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO3TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO3TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO3TimeBelowThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO3TimeBelowThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO3TimeBelowThreshold"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO3TimeBelowThreshold"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO3TimeBelowThreshold"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO3TimeBelowThreshold"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO3TimeBelowThreshold register.
+    /// </summary>
+    /// <seealso cref="DO3TimeBelowThreshold"/>
+    [Description("Filters and selects timestamped messages from the DO3TimeBelowThreshold register.")]
+    public partial class TimestampedDO3TimeBelowThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO3TimeBelowThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO3TimeBelowThreshold.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO3TimeBelowThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DO3TimeBelowThreshold.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reserved.
+    /// </summary>
+    [Description("Reserved")]
+    internal partial class Reserved25
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Reserved25"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 86;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Reserved25"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Reserved25"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+    }
+
+    /// <summary>
+    /// Represents a register that reserved.
+    /// </summary>
+    [Description("Reserved")]
+    internal partial class Reserved26
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Reserved26"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 87;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Reserved26"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Reserved26"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+    }
+
+    /// <summary>
+    /// Represents a register that reserved.
+    /// </summary>
+    [Description("Reserved")]
+    internal partial class Reserved27
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Reserved27"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 88;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Reserved27"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Reserved27"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+    }
+
+    /// <summary>
+    /// Represents a register that reserved.
+    /// </summary>
+    [Description("Reserved")]
+    internal partial class Reserved28
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Reserved28"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 89;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Reserved28"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Reserved28"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+    }
+
+    /// <summary>
+    /// Represents a register that reserved.
+    /// </summary>
+    [Description("Reserved")]
+    internal partial class Reserved29
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Reserved29"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 90;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Reserved29"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Reserved29"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+    }
+
+    /// <summary>
+    /// Represents a register that sets the sampling period (us) of the ADC when SamplingRate is set to SamplingRateCustom.
+    /// </summary>
+    [Description("Sets the sampling period (us) of the ADC when SamplingRate is set to SamplingRateCustom.")]
+    public partial class SamplingPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SamplingPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 91;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SamplingPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SamplingPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SamplingPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SamplingPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SamplingPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SamplingPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SamplingPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SamplingPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SamplingPeriod register.
+    /// </summary>
+    /// <seealso cref="SamplingPeriod"/>
+    [Description("Filters and selects timestamped messages from the SamplingPeriod register.")]
+    public partial class TimestampedSamplingPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SamplingPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SamplingPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SamplingPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return SamplingPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the number of ADC reads packed on each AnalogData event. The event is timestamped with the first read. BatchSize times the number of enabled channels must not exceed 120.
+    /// </summary>
+    [Description("Sets the number of ADC reads packed on each AnalogData event. The event is timestamped with the first read. BatchSize times the number of enabled channels must not exceed 120.")]
+    public partial class BatchSize
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BatchSize"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 92;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BatchSize"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BatchSize"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BatchSize"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BatchSize"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BatchSize"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BatchSize"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BatchSize"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BatchSize"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BatchSize register.
+    /// </summary>
+    /// <seealso cref="BatchSize"/>
+    [Description("Filters and selects timestamped messages from the BatchSize register.")]
+    public partial class TimestampedBatchSize
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BatchSize"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BatchSize.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BatchSize"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return BatchSize.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that counts the ADC reads lost because the firmware sample buffer was full. Writing any value resets it.
+    /// </summary>
+    [Description("Counts the ADC reads lost because the firmware sample buffer was full. Writing any value resets it.")]
+    public partial class SampleRingOverflows
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SampleRingOverflows"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 93;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SampleRingOverflows"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SampleRingOverflows"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SampleRingOverflows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SampleRingOverflows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SampleRingOverflows"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SampleRingOverflows"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SampleRingOverflows"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SampleRingOverflows"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SampleRingOverflows register.
+    /// </summary>
+    /// <seealso cref="SampleRingOverflows"/>
+    [Description("Filters and selects timestamped messages from the SampleRingOverflows register.")]
+    public partial class TimestampedSampleRingOverflows
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SampleRingOverflows"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SampleRingOverflows.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SampleRingOverflows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return SampleRingOverflows.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the maximum number of ADC reads waiting to be sent on the firmware sample buffer. Writing any value resets it.
+    /// </summary>
+    [Description("Reports the maximum number of ADC reads waiting to be sent on the firmware sample buffer. Writing any value resets it.")]
+    public partial class SampleRingHighWater
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SampleRingHighWater"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 94;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SampleRingHighWater"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SampleRingHighWater"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SampleRingHighWater"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SampleRingHighWater"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SampleRingHighWater"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SampleRingHighWater"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SampleRingHighWater"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SampleRingHighWater"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SampleRingHighWater register.
+    /// </summary>
+    /// <seealso cref="SampleRingHighWater"/>
+    [Description("Filters and selects timestamped messages from the SampleRingHighWater register.")]
+    public partial class TimestampedSampleRingHighWater
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SampleRingHighWater"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SampleRingHighWater.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SampleRingHighWater"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return SampleRingHighWater.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the minimum and maximum time between consecutive conversion starts, in units of 250 ns. Writing any value resets it.
+    /// </summary>
+    [Description("Reports the minimum and maximum time between consecutive conversion starts, in units of 250 ns. Writing any value resets it.")]
+    public partial class ConversionInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ConversionInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 95;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ConversionInterval"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ConversionInterval"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ConversionInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ConversionInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ConversionInterval"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ConversionInterval"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ConversionInterval"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ConversionInterval"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ConversionInterval register.
+    /// </summary>
+    /// <seealso cref="ConversionInterval"/>
+    [Description("Filters and selects timestamped messages from the ConversionInterval register.")]
+    public partial class TimestampedConversionInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ConversionInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ConversionInterval.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ConversionInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return ConversionInterval.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the oversampling ratio of the ADC without changing the range. The conversion time plus the readout must fit in the sampling period.
+    /// </summary>
+    [Description("Sets the oversampling ratio of the ADC without changing the range. The conversion time plus the readout must fit in the sampling period.")]
+    public partial class OversamplingRatio
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OversamplingRatio"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 96;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="OversamplingRatio"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="OversamplingRatio"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="OversamplingRatio"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static OversamplingRatioConfig GetPayload(HarpMessage message)
+        {
+            return (OversamplingRatioConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="OversamplingRatio"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<OversamplingRatioConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((OversamplingRatioConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="OversamplingRatio"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OversamplingRatio"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, OversamplingRatioConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="OversamplingRatio"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OversamplingRatio"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, OversamplingRatioConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// OversamplingRatio register.
+    /// </summary>
+    /// <seealso cref="OversamplingRatio"/>
+    [Description("Filters and selects timestamped messages from the OversamplingRatio register.")]
+    public partial class TimestampedOversamplingRatio
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OversamplingRatio"/> register. This field is constant.
+        /// </summary>
+        public const int Address = OversamplingRatio.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="OversamplingRatio"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<OversamplingRatioConfig> GetPayload(HarpMessage message)
+        {
+            return OversamplingRatio.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the number of ADC reads combined on each AnalogData sample. One disables the decimation.
+    /// </summary>
+    [Description("Sets the number of ADC reads combined on each AnalogData sample. One disables the decimation.")]
+    public partial class DecimationFactor
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DecimationFactor"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 97;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DecimationFactor"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DecimationFactor"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DecimationFactor"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DecimationFactor"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DecimationFactor"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DecimationFactor"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DecimationFactor"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DecimationFactor"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DecimationFactor register.
+    /// </summary>
+    /// <seealso cref="DecimationFactor"/>
+    [Description("Filters and selects timestamped messages from the DecimationFactor register.")]
+    public partial class TimestampedDecimationFactor
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DecimationFactor"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DecimationFactor.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DecimationFactor"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return DecimationFactor.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the filter used to decimate the ADC reads.
+    /// </summary>
+    [Description("Sets the filter used to decimate the ADC reads.")]
+    public partial class DecimationFilter
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DecimationFilter"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 98;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DecimationFilter"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DecimationFilter"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DecimationFilter"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DecimationFilterConfig GetPayload(HarpMessage message)
+        {
+            return (DecimationFilterConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DecimationFilter"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DecimationFilterConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((DecimationFilterConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DecimationFilter"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DecimationFilter"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DecimationFilterConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DecimationFilter"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DecimationFilter"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DecimationFilterConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DecimationFilter register.
+    /// </summary>
+    /// <seealso cref="DecimationFilter"/>
+    [Description("Filters and selects timestamped messages from the DecimationFilter register.")]
+    public partial class TimestampedDecimationFilter
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DecimationFilter"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DecimationFilter.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DecimationFilter"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DecimationFilterConfig> GetPayload(HarpMessage message)
+        {
+            return DecimationFilter.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets whether the thresholds are evaluated on every ADC read or on the decimated samples.
+    /// </summary>
+    [Description("Sets whether the thresholds are evaluated on every ADC read or on the decimated samples.")]
+    public partial class ThresholdSource
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdSource"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 99;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ThresholdSource"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ThresholdSource"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ThresholdSource"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ThresholdSourceConfig GetPayload(HarpMessage message)
+        {
+            return (ThresholdSourceConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ThresholdSource"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdSourceConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((ThresholdSourceConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ThresholdSource"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdSource"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ThresholdSourceConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ThresholdSource"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdSource"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ThresholdSourceConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ThresholdSource register.
+    /// </summary>
+    /// <seealso cref="ThresholdSource"/>
+    [Description("Filters and selects timestamped messages from the ThresholdSource register.")]
+    public partial class TimestampedThresholdSource
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdSource"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ThresholdSource.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ThresholdSource"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdSourceConfig> GetPayload(HarpMessage message)
+        {
+            return ThresholdSource.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the ADC channels sent on the AnalogData events. At least one channel must be enabled.
+    /// </summary>
+    [Description("Sets the ADC channels sent on the AnalogData events. At least one channel must be enabled.")]
+    public partial class EnabledChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnabledChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 100;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EnabledChannels"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EnabledChannels"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EnabledChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogChannels GetPayload(HarpMessage message)
+        {
+            return (AnalogChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EnabledChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((AnalogChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EnabledChannels"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnabledChannels"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EnabledChannels"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnabledChannels"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EnabledChannels register.
+    /// </summary>
+    /// <seealso cref="EnabledChannels"/>
+    [Description("Filters and selects timestamped messages from the EnabledChannels register.")]
+    public partial class TimestampedEnabledChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnabledChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EnabledChannels.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EnabledChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogChannels> GetPayload(HarpMessage message)
+        {
+            return EnabledChannels.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets whether each ADC result is read before the next conversion starts or while it runs. Pipelined mode needs an oversampling ratio of 8x or more and can only be changed while stopped.
+    /// </summary>
+    [Description("Sets whether each ADC result is read before the next conversion starts or while it runs. Pipelined mode needs an oversampling ratio of 8x or more and can only be changed while stopped.")]
+    public partial class AcquisitionMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AcquisitionMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 101;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AcquisitionMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AcquisitionMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AcquisitionMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AcquisitionModeConfig GetPayload(HarpMessage message)
+        {
+            return (AcquisitionModeConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AcquisitionMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AcquisitionModeConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((AcquisitionModeConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AcquisitionMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AcquisitionMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AcquisitionModeConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AcquisitionMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AcquisitionMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AcquisitionModeConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AcquisitionMode register.
+    /// </summary>
+    /// <seealso cref="AcquisitionMode"/>
+    [Description("Filters and selects timestamped messages from the AcquisitionMode register.")]
+    public partial class TimestampedAcquisitionMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AcquisitionMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AcquisitionMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AcquisitionMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AcquisitionModeConfig> GetPayload(HarpMessage message)
+        {
+            return AcquisitionMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the trigger of the capture windows. While capturing, only the samples of each window are sent on AnalogData, and an event is sent when a window is triggered. Can only be changed while stopped.
+    /// </summary>
+    [Description("Sets the trigger of the capture windows. While capturing, only the samples of each window are sent on AnalogData, and an event is sent when a window is triggered. Can only be changed while stopped.")]
+    public partial class CaptureTrigger
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CaptureTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 102;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CaptureTrigger"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CaptureTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CaptureTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static CaptureTriggerConfig GetPayload(HarpMessage message)
+        {
+            return (CaptureTriggerConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CaptureTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CaptureTriggerConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((CaptureTriggerConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CaptureTrigger"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CaptureTrigger"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, CaptureTriggerConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CaptureTrigger"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CaptureTrigger"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, CaptureTriggerConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CaptureTrigger register.
+    /// </summary>
+    /// <seealso cref="CaptureTrigger"/>
+    [Description("Filters and selects timestamped messages from the CaptureTrigger register.")]
+    public partial class TimestampedCaptureTrigger
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CaptureTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CaptureTrigger.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CaptureTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CaptureTriggerConfig> GetPayload(HarpMessage message)
+        {
+            return CaptureTrigger.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the number of samples from before the trigger sent on each capture window. Can only be changed while stopped.
+    /// </summary>
+    [Description("Sets the number of samples from before the trigger sent on each capture window. Can only be changed while stopped.")]
+    public partial class CapturePreSamples
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CapturePreSamples"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 103;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CapturePreSamples"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CapturePreSamples"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CapturePreSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CapturePreSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CapturePreSamples"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CapturePreSamples"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CapturePreSamples"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CapturePreSamples"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CapturePreSamples register.
+    /// </summary>
+    /// <seealso cref="CapturePreSamples"/>
+    [Description("Filters and selects timestamped messages from the CapturePreSamples register.")]
+    public partial class TimestampedCapturePreSamples
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CapturePreSamples"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CapturePreSamples.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CapturePreSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return CapturePreSamples.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the number of samples from after the trigger sent on each capture window. Can only be changed while stopped.
+    /// </summary>
+    [Description("Sets the number of samples from after the trigger sent on each capture window. Can only be changed while stopped.")]
+    public partial class CapturePostSamples
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CapturePostSamples"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 104;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CapturePostSamples"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CapturePostSamples"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CapturePostSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CapturePostSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CapturePostSamples"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CapturePostSamples"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CapturePostSamples"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CapturePostSamples"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CapturePostSamples register.
+    /// </summary>
+    /// <seealso cref="CapturePostSamples"/>
+    [Description("Filters and selects timestamped messages from the CapturePostSamples register.")]
+    public partial class TimestampedCapturePostSamples
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CapturePostSamples"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CapturePostSamples.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CapturePostSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return CapturePostSamples.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the number of samples acquired on each burst when SamplingRate is set to SamplingRateBurst. BurstSamples times the number of enabled channels must not exceed 896.
+    /// </summary>
+    [Description("Sets the number of samples acquired on each burst when SamplingRate is set to SamplingRateBurst. BurstSamples times the number of enabled channels must not exceed 896.")]
+    public partial class BurstSamples
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BurstSamples"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 105;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BurstSamples"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BurstSamples"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BurstSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BurstSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BurstSamples"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BurstSamples"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BurstSamples"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BurstSamples"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BurstSamples register.
+    /// </summary>
+    /// <seealso cref="BurstSamples"/>
+    [Description("Filters and selects timestamped messages from the BurstSamples register.")]
+    public partial class TimestampedBurstSamples
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BurstSamples"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BurstSamples.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BurstSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return BurstSamples.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the trigger of the bursts. With Immediate, a new burst starts as soon as the previous one is sent.
+    /// </summary>
+    [Description("Sets the trigger of the bursts. With Immediate, a new burst starts as soon as the previous one is sent.")]
+    public partial class BurstTrigger
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BurstTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 106;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BurstTrigger"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BurstTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BurstTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static BurstTriggerConfig GetPayload(HarpMessage message)
+        {
+            return (BurstTriggerConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BurstTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<BurstTriggerConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((BurstTriggerConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BurstTrigger"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BurstTrigger"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, BurstTriggerConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BurstTrigger"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BurstTrigger"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, BurstTriggerConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BurstTrigger register.
+    /// </summary>
+    /// <seealso cref="BurstTrigger"/>
+    [Description("Filters and selects timestamped messages from the BurstTrigger register.")]
+    public partial class TimestampedBurstTrigger
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BurstTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BurstTrigger.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BurstTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<BurstTriggerConfig> GetPayload(HarpMessage message)
+        {
+            return BurstTrigger.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the mean time between the conversions of the last burst (units of 250 ns). Sent before the AnalogData events of each burst, with the timestamp of its first sample.
+    /// </summary>
+    [Description("Reports the mean time between the conversions of the last burst (units of 250 ns). Sent before the AnalogData events of each burst, with the timestamp of its first sample.")]
+    public partial class BurstInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BurstInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 107;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BurstInterval"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BurstInterval"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BurstInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BurstInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BurstInterval"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BurstInterval"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BurstInterval"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BurstInterval"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BurstInterval register.
+    /// </summary>
+    /// <seealso cref="BurstInterval"/>
+    [Description("Filters and selects timestamped messages from the BurstInterval register.")]
+    public partial class TimestampedBurstInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BurstInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BurstInterval.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BurstInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return BurstInterval.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the encoding of the ADC reads. With Delta, the AnalogData events are replaced by AnalogDataDelta events. Bursts are always sent on AnalogData.
+    /// </summary>
+    [Description("Sets the encoding of the ADC reads. With Delta, the AnalogData events are replaced by AnalogDataDelta events. Bursts are always sent on AnalogData.")]
+    public partial class DataEncoding
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DataEncoding"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 108;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DataEncoding"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DataEncoding"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DataEncoding"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DataEncodingConfig GetPayload(HarpMessage message)
+        {
+            return (DataEncodingConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DataEncoding"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DataEncodingConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((DataEncodingConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DataEncoding"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DataEncoding"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DataEncodingConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DataEncoding"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DataEncoding"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DataEncodingConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DataEncoding register.
+    /// </summary>
+    /// <seealso cref="DataEncoding"/>
+    [Description("Filters and selects timestamped messages from the DataEncoding register.")]
+    public partial class TimestampedDataEncoding
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DataEncoding"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DataEncoding.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DataEncoding"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DataEncodingConfig> GetPayload(HarpMessage message)
+        {
+            return DataEncoding.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the delta encoded ADC reads when DataEncoding is set to Delta. The payload has the enabled channels, the values of the first read, and then one byte per value with the zig-zag encoded difference to the previous value of its channel, or 0xFF followed by the value. Each event carries up to BatchSize reads and is timestamped with the first one.
+    /// </summary>
+    [Description("Reports the delta encoded ADC reads when DataEncoding is set to Delta. The payload has the enabled channels, the values of the first read, and then one byte per value with the zig-zag encoded difference to the previous value of its channel, or 0xFF followed by the value. Each event carries up to BatchSize reads and is timestamped with the first one.")]
+    public partial class AnalogDataDelta
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogDataDelta"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 109;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogDataDelta"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogDataDelta"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 240;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogDataDelta"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogDataDelta"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogDataDelta"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataDelta"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogDataDelta"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataDelta"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogDataDelta register.
+    /// </summary>
+    /// <seealso cref="AnalogDataDelta"/>
+    [Description("Filters and selects timestamped messages from the AnalogDataDelta register.")]
+    public partial class TimestampedAnalogDataDelta
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogDataDelta"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogDataDelta.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogDataDelta"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return AnalogDataDelta.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator which creates standard message payloads for the
+    /// AnalogInput device.
+    /// </summary>
+    /// <seealso cref="CreateAcquisitionStatePayload"/>
+    /// <seealso cref="CreateAnalogDataPayload"/>
+    /// <seealso cref="CreateDigitalInputStatePayload"/>
+    /// <seealso cref="CreateRangeAndFilterPayload"/>
+    /// <seealso cref="CreateSamplingRatePayload"/>
+    /// <seealso cref="CreateDI0TriggerPayload"/>
+    /// <seealso cref="CreateDO0SyncPayload"/>
+    /// <seealso cref="CreateDO0PulseWidthPayload"/>
+    /// <seealso cref="CreateDigitalOutputSetPayload"/>
+    /// <seealso cref="CreateDigitalOutputClearPayload"/>
+    /// <seealso cref="CreateDigitalOutputTogglePayload"/>
+    /// <seealso cref="CreateDigitalOutputStatePayload"/>
+    /// <seealso cref="CreateSyncOutputPayload"/>
+    /// <seealso cref="CreateDO0TargetChannelPayload"/>
+    /// <seealso cref="CreateDO1TargetChannelPayload"/>
+    /// <seealso cref="CreateDO2TargetChannelPayload"/>
+    /// <seealso cref="CreateDO3TargetChannelPayload"/>
+    /// <seealso cref="CreateDO0ThresholdPayload"/>
+    /// <seealso cref="CreateDO1ThresholdPayload"/>
+    /// <seealso cref="CreateDO2ThresholdPayload"/>
+    /// <seealso cref="CreateDO3ThresholdPayload"/>
+    /// <seealso cref="CreateDO0ThresholdLowPayload"/>
+    /// <seealso cref="CreateDO1ThresholdLowPayload"/>
+    /// <seealso cref="CreateDO2ThresholdLowPayload"/>
+    /// <seealso cref="CreateDO3ThresholdLowPayload"/>
+    /// <seealso cref="CreateDO0TimeAboveThresholdPayload"/>
+    /// <seealso cref="CreateDO1TimeAboveThresholdPayload"/>
+    /// <seealso cref="CreateDO2TimeAboveThresholdPayload"/>
+    /// <seealso cref="CreateDO3TimeAboveThresholdPayload"/>
+    /// <seealso cref="CreateDO0TimeBelowThresholdPayload"/>
+    /// <seealso cref="CreateDO1TimeBelowThresholdPayload"/>
+    /// <seealso cref="CreateDO2TimeBelowThresholdPayload"/>
+    /// <seealso cref="CreateDO3TimeBelowThresholdPayload"/>
+    /// <seealso cref="CreateSamplingPeriodPayload"/>
+    /// <seealso cref="CreateBatchSizePayload"/>
+    /// <seealso cref="CreateSampleRingOverflowsPayload"/>
+    /// <seealso cref="CreateSampleRingHighWaterPayload"/>
+    /// <seealso cref="CreateConversionIntervalPayload"/>
+    /// <seealso cref="CreateOversamplingRatioPayload"/>
+    /// <seealso cref="CreateDecimationFactorPayload"/>
+    /// <seealso cref="CreateDecimationFilterPayload"/>
+    /// <seealso cref="CreateThresholdSourcePayload"/>
+    /// <seealso cref="CreateEnabledChannelsPayload"/>
+    /// <seealso cref="CreateAcquisitionModePayload"/>
+    /// <seealso cref="CreateCaptureTriggerPayload"/>
+    /// <seealso cref="CreateCapturePreSamplesPayload"/>
+    /// <seealso cref="CreateCapturePostSamplesPayload"/>
+    /// <seealso cref="CreateBurstSamplesPayload"/>
+    /// <seealso cref="CreateBurstTriggerPayload"/>
+    /// <seealso cref="CreateBurstIntervalPayload"/>
+    /// <seealso cref="CreateDataEncodingPayload"/>
+    /// <seealso cref="CreateAnalogDataDeltaPayload"/>
+    [XmlInclude(typeof(CreateAcquisitionStatePayload))]
+    [XmlInclude(typeof(CreateAnalogDataPayload))]
+    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateRangeAndFilterPayload))]
+    [XmlInclude(typeof(CreateSamplingRatePayload))]
+    [XmlInclude(typeof(CreateDI0TriggerPayload))]
+    [XmlInclude(typeof(CreateDO0SyncPayload))]
+    [XmlInclude(typeof(CreateDO0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateDigitalOutputSetPayload))]
+    [XmlInclude(typeof(CreateDigitalOutputClearPayload))]
+    [XmlInclude(typeof(CreateDigitalOutputTogglePayload))]
+    [XmlInclude(typeof(CreateDigitalOutputStatePayload))]
+    [XmlInclude(typeof(CreateSyncOutputPayload))]
+    [XmlInclude(typeof(CreateDO0TargetChannelPayload))]
+    [XmlInclude(typeof(CreateDO1TargetChannelPayload))]
+    [XmlInclude(typeof(CreateDO2TargetChannelPayload))]
+    [XmlInclude(typeof(CreateDO3TargetChannelPayload))]
+    [XmlInclude(typeof(CreateDO0ThresholdPayload))]
+    [XmlInclude(typeof(CreateDO1ThresholdPayload))]
+    [XmlInclude(typeof(CreateDO2ThresholdPayload))]
+    [XmlInclude(typeof(CreateDO3ThresholdPayload))]
+    [XmlInclude(typeof(CreateDO0ThresholdLowPayload))]
+    [XmlInclude(typeof(CreateDO1ThresholdLowPayload))]
+    [XmlInclude(typeof(CreateDO2ThresholdLowPayload))]
+    [XmlInclude(typeof(CreateDO3ThresholdLowPayload))]
+    [XmlInclude(typeof(CreateDO0TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateDO1TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateDO2TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateDO3TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateDO0TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateDO1TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateDO2TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateDO3TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateSamplingPeriodPayload))]
+    [XmlInclude(typeof(CreateBatchSizePayload))]
+    [XmlInclude(typeof(CreateSampleRingOverflowsPayload))]
+    [XmlInclude(typeof(CreateSampleRingHighWaterPayload))]
+    [XmlInclude(typeof(CreateConversionIntervalPayload))]
+    [XmlInclude(typeof(CreateOversamplingRatioPayload))]
+    [XmlInclude(typeof(CreateDecimationFactorPayload))]
+    [XmlInclude(typeof(CreateDecimationFilterPayload))]
+    [XmlInclude(typeof(CreateThresholdSourcePayload))]
+    [XmlInclude(typeof(CreateEnabledChannelsPayload))]
+    [XmlInclude(typeof(CreateAcquisitionModePayload))]
+    [XmlInclude(typeof(CreateCaptureTriggerPayload))]
+    [XmlInclude(typeof(CreateCapturePreSamplesPayload))]
+    [XmlInclude(typeof(CreateCapturePostSamplesPayload))]
+    [XmlInclude(typeof(CreateBurstSamplesPayload))]
+    [XmlInclude(typeof(CreateBurstTriggerPayload))]
+    [XmlInclude(typeof(CreateBurstIntervalPayload))]
+    [XmlInclude(typeof(CreateDataEncodingPayload))]
+    [XmlInclude(typeof(CreateAnalogDataDeltaPayload))]
+    [XmlInclude(typeof(CreateTimestampedAcquisitionStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogDataPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedRangeAndFilterPayload))]
+    [XmlInclude(typeof(CreateTimestampedSamplingRatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDI0TriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0SyncPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputSetPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputClearPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputTogglePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedSyncOutputPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0TargetChannelPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO1TargetChannelPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO2TargetChannelPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO3TargetChannelPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0ThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO1ThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO2ThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO3ThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0ThresholdLowPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO1ThresholdLowPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO2ThresholdLowPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO3ThresholdLowPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO1TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO2TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO3TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO1TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO2TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO3TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedSamplingPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedBatchSizePayload))]
+    [XmlInclude(typeof(CreateTimestampedSampleRingOverflowsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSampleRingHighWaterPayload))]
+    [XmlInclude(typeof(CreateTimestampedConversionIntervalPayload))]
+    [XmlInclude(typeof(CreateTimestampedOversamplingRatioPayload))]
+    [XmlInclude(typeof(CreateTimestampedDecimationFactorPayload))]
+    [XmlInclude(typeof(CreateTimestampedDecimationFilterPayload))]
+    [XmlInclude(typeof(CreateTimestampedThresholdSourcePayload))]
+    [XmlInclude(typeof(CreateTimestampedEnabledChannelsPayload))]
+    [XmlInclude(typeof(CreateTimestampedAcquisitionModePayload))]
+    [XmlInclude(typeof(CreateTimestampedCaptureTriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedCapturePreSamplesPayload))]
+    [XmlInclude(typeof(CreateTimestampedCapturePostSamplesPayload))]
+    [XmlInclude(typeof(CreateTimestampedBurstSamplesPayload))]
+    [XmlInclude(typeof(CreateTimestampedBurstTriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedBurstIntervalPayload))]
+    [XmlInclude(typeof(CreateTimestampedDataEncodingPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogDataDeltaPayload))]
+    [Description("Creates standard message payloads for the AnalogInput device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateAcquisitionStatePayload();
+        }
+
+        string INamedElement.Name => $"{nameof(AnalogInput)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the data acquisition.
+    /// </summary>
+    [DisplayName("AcquisitionStatePayload")]
+    [Description("Creates a message payload that enables the data acquisition.")]
+    public partial class CreateAcquisitionStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables the data acquisition.
+        /// </summary>
+        [Description("The value that enables the data acquisition.")]
+        public EnableFlag AcquisitionState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AcquisitionState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return AcquisitionState;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the data acquisition.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AcquisitionState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.AcquisitionState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the data acquisition.
+    /// </summary>
+    [DisplayName("TimestampedAcquisitionStatePayload")]
+    [Description("Creates a timestamped message payload that enables the data acquisition.")]
+    public partial class CreateTimestampedAcquisitionStatePayload : CreateAcquisitionStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the data acquisition.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AcquisitionState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.AcquisitionState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports BatchSize consecutive reads of the ADC channels set on EnabledChannels. The typed payload is a single read of the four channels.
+    /// </summary>
+    [DisplayName("AnalogDataPayload")]
+    [Description("Creates a message payload that reports BatchSize consecutive reads of the ADC channels set on EnabledChannels. The typed payload is a single read of the four channels.")]
+    public partial class CreateAnalogDataPayload
+    {
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel0.
+        /// </summary>
+        [Description("")]
+        public short Channel0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel1.
+        /// </summary>
+        [Description("")]
+        public short Channel1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel2.
+        /// </summary>
+        [Description("")]
+        public short Channel2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel3.
+        /// </summary>
+        [Description("")]
+        public short Channel3 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogData register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogDataPayload GetPayload()
+        {
+            AnalogDataPayload value;
+            value.Channel0 = Channel0;
+            value.Channel1 = Channel1;
+            value.Channel2 = Channel2;
+            value.Channel3 = Channel3;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that reports BatchSize consecutive reads of the ADC channels set on EnabledChannels. The typed payload is a single read of the four channels.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogData register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.AnalogData.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports BatchSize consecutive reads of the ADC channels set on EnabledChannels. The typed payload is a single read of the four channels.
+    /// </summary>
+    [DisplayName("TimestampedAnalogDataPayload")]
+    [Description("Creates a timestamped message payload that reports BatchSize consecutive reads of the ADC channels set on EnabledChannels. The typed payload is a single read of the four channels.")]
+    public partial class CreateTimestampedAnalogDataPayload : CreateAnalogDataPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports BatchSize consecutive reads of the ADC channels set on EnabledChannels. The typed payload is a single read of the four channels.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogData register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.AnalogData.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that state of the digital input pin 0.
+    /// </summary>
+    [DisplayName("DigitalInputStatePayload")]
+    [Description("Creates a message payload that state of the digital input pin 0.")]
+    public partial class CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that state of the digital input pin 0.
+        /// </summary>
+        [Description("The value that state of the digital input pin 0.")]
+        public DigitalInputs DigitalInputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DigitalInputState;
+        }
+
+        /// <summary>
+        /// Creates a message that state of the digital input pin 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DigitalInputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that state of the digital input pin 0.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputStatePayload")]
+    [Description("Creates a timestamped message payload that state of the digital input pin 0.")]
+    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that state of the digital input pin 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the range and LowPass filter cutoff of the ADC.
+    /// </summary>
+    [DisplayName("RangeAndFilterPayload")]
+    [Description("Creates a message payload that sets the range and LowPass filter cutoff of the ADC.")]
+    public partial class CreateRangeAndFilterPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the range and LowPass filter cutoff of the ADC.
+        /// </summary>
+        [Description("The value that sets the range and LowPass filter cutoff of the ADC.")]
+        public RangeAndFilterConfig RangeAndFilter { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RangeAndFilter register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public RangeAndFilterConfig GetPayload()
+        {
+            return RangeAndFilter;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the range and LowPass filter cutoff of the ADC.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RangeAndFilter register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.RangeAndFilter.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the range and LowPass filter cutoff of the ADC.
+    /// </summary>
+    [DisplayName("TimestampedRangeAndFilterPayload")]
+    [Description("Creates a timestamped message payload that sets the range and LowPass filter cutoff of the ADC.")]
+    public partial class CreateTimestampedRangeAndFilterPayload : CreateRangeAndFilterPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the range and LowPass filter cutoff of the ADC.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RangeAndFilter register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.RangeAndFilter.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the sampling frequency of the ADC.
+    /// </summary>
+    [DisplayName("SamplingRatePayload")]
+    [Description("Creates a message payload that sets the sampling frequency of the ADC.")]
+    public partial class CreateSamplingRatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the sampling frequency of the ADC.
+        /// </summary>
+        [Description("The value that sets the sampling frequency of the ADC.")]
+        public SamplingRateMode SamplingRate { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SamplingRate register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SamplingRateMode GetPayload()
+        {
+            return SamplingRate;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the sampling frequency of the ADC.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SamplingRate register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.SamplingRate.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the sampling frequency of the ADC.
+    /// </summary>
+    [DisplayName("TimestampedSamplingRatePayload")]
+    [Description("Creates a timestamped message payload that sets the sampling frequency of the ADC.")]
+    public partial class CreateTimestampedSamplingRatePayload : CreateSamplingRatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the sampling frequency of the ADC.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SamplingRate register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.SamplingRate.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configuration of the digital input pin 0.
+    /// </summary>
+    [DisplayName("DI0TriggerPayload")]
+    [Description("Creates a message payload that configuration of the digital input pin 0.")]
+    public partial class CreateDI0TriggerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configuration of the digital input pin 0.
+        /// </summary>
+        [Description("The value that configuration of the digital input pin 0.")]
+        public TriggerConfig DI0Trigger { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DI0Trigger register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public TriggerConfig GetPayload()
+        {
+            return DI0Trigger;
+        }
+
+        /// <summary>
+        /// Creates a message that configuration of the digital input pin 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DI0Trigger register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DI0Trigger.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configuration of the digital input pin 0.
+    /// </summary>
+    [DisplayName("TimestampedDI0TriggerPayload")]
+    [Description("Creates a timestamped message payload that configuration of the digital input pin 0.")]
+    public partial class CreateTimestampedDI0TriggerPayload : CreateDI0TriggerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configuration of the digital input pin 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DI0Trigger register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DI0Trigger.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configuration of the digital output pin 0.
+    /// </summary>
+    [DisplayName("DO0SyncPayload")]
+    [Description("Creates a message payload that configuration of the digital output pin 0.")]
+    public partial class CreateDO0SyncPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configuration of the digital output pin 0.
+        /// </summary>
+        [Description("The value that configuration of the digital output pin 0.")]
+        public SyncConfig DO0Sync { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0Sync register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SyncConfig GetPayload()
+        {
+            return DO0Sync;
+        }
+
+        /// <summary>
+        /// Creates a message that configuration of the digital output pin 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0Sync register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DO0Sync.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configuration of the digital output pin 0.
+    /// </summary>
+    [DisplayName("TimestampedDO0SyncPayload")]
+    [Description("Creates a timestamped message payload that configuration of the digital output pin 0.")]
+    public partial class CreateTimestampedDO0SyncPayload : CreateDO0SyncPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configuration of the digital output pin 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0Sync register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DO0Sync.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+    /// </summary>
+    [DisplayName("DO0PulseWidthPayload")]
+    [Description("Creates a message payload that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.")]
+    public partial class CreateDO0PulseWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+        /// </summary>
+        [Range(min: 1, max: 250)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.")]
+        public byte DO0PulseWidth { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the DO0PulseWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return DO0PulseWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0PulseWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DO0PulseWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+    /// </summary>
+    [DisplayName("TimestampedDO0PulseWidthPayload")]
+    [Description("Creates a timestamped message payload that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.")]
+    public partial class CreateTimestampedDO0PulseWidthPayload : CreateDO0PulseWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0PulseWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DO0PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputSetPayload")]
+    [Description("Creates a message payload that set the specified digital output lines.")]
+    public partial class CreateDigitalOutputSetPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that set the specified digital output lines.
+        /// </summary>
+        [Description("The value that set the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputSet { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputSet register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputSet;
+        }
+
+        /// <summary>
+        /// Creates a message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputSet register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DigitalOutputSet.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputSetPayload")]
+    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputSetPayload : CreateDigitalOutputSetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputSet register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DigitalOutputSet.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that clear the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputClearPayload")]
+    [Description("Creates a message payload that clear the specified digital output lines.")]
+    public partial class CreateDigitalOutputClearPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that clear the specified digital output lines.
+        /// </summary>
+        [Description("The value that clear the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputClear { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputClear register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputClear;
+        }
+
+        /// <summary>
+        /// Creates a message that clear the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputClear register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DigitalOutputClear.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that clear the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputClearPayload")]
+    [Description("Creates a timestamped message payload that clear the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputClearPayload : CreateDigitalOutputClearPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that clear the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputClear register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DigitalOutputClear.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that toggle the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputTogglePayload")]
+    [Description("Creates a message payload that toggle the specified digital output lines.")]
+    public partial class CreateDigitalOutputTogglePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that toggle the specified digital output lines.
+        /// </summary>
+        [Description("The value that toggle the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputToggle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputToggle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputToggle;
+        }
+
+        /// <summary>
+        /// Creates a message that toggle the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputToggle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DigitalOutputToggle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that toggle the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputTogglePayload")]
+    [Description("Creates a timestamped message payload that toggle the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputTogglePayload : CreateDigitalOutputTogglePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that toggle the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputToggle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DigitalOutputToggle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+    /// </summary>
+    [DisplayName("DigitalOutputStatePayload")]
+    [Description("Creates a message payload that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.")]
+    public partial class CreateDigitalOutputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+        /// </summary>
+        [Description("The value that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.")]
+        public DigitalOutputs DigitalOutputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputState;
+        }
+
+        /// <summary>
+        /// Creates a message that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DigitalOutputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputStatePayload")]
+    [Description("Creates a timestamped message payload that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.")]
+    public partial class CreateTimestampedDigitalOutputStatePayload : CreateDigitalOutputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DigitalOutputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that digital output that will be set when acquisition starts.
+    /// </summary>
+    [DisplayName("SyncOutputPayload")]
+    [Description("Creates a message payload that digital output that will be set when acquisition starts.")]
+    public partial class CreateSyncOutputPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that digital output that will be set when acquisition starts.
+        /// </summary>
+        [Description("The value that digital output that will be set when acquisition starts.")]
+        public StartSyncOutputTarget SyncOutput { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SyncOutput register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public StartSyncOutputTarget GetPayload()
+        {
+            return SyncOutput;
+        }
+
+        /// <summary>
+        /// Creates a message that digital output that will be set when acquisition starts.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SyncOutput register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.SyncOutput.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that digital output that will be set when acquisition starts.
+    /// </summary>
+    [DisplayName("TimestampedSyncOutputPayload")]
+    [Description("Creates a timestamped message payload that digital output that will be set when acquisition starts.")]
+    public partial class CreateTimestampedSyncOutputPayload : CreateSyncOutputPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that digital output that will be set when acquisition starts.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SyncOutput register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.SyncOutput.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target ADC channel that will be used to trigger a threshold event on DO0 pin.
+    /// </summary>
+    [DisplayName("DO0TargetChannelPayload")]
+    [Description("Creates a message payload that target ADC channel that will be used to trigger a threshold event on DO0 pin.")]
+    public partial class CreateDO0TargetChannelPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target ADC channel that will be used to trigger a threshold event on DO0 pin.
+        /// </summary>
+        [Description("The value that target ADC channel that will be used to trigger a threshold event on DO0 pin.")]
+        public AdcChannel DO0TargetChannel { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0TargetChannel register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AdcChannel GetPayload()
+        {
+            return DO0TargetChannel;
+        }
+
+        /// <summary>
+        /// Creates a message that target ADC channel that will be used to trigger a threshold event on DO0 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0TargetChannel register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DO0TargetChannel.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target ADC channel that will be used to trigger a threshold event on DO0 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO0TargetChannelPayload")]
+    [Description("Creates a timestamped message payload that target ADC channel that will be used to trigger a threshold event on DO0 pin.")]
+    public partial class CreateTimestampedDO0TargetChannelPayload : CreateDO0TargetChannelPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target ADC channel that will be used to trigger a threshold event on DO0 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0TargetChannel register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DO0TargetChannel.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target ADC channel that will be used to trigger a threshold event on DO1 pin.
+    /// </summary>
+    [DisplayName("DO1TargetChannelPayload")]
+    [Description("Creates a message payload that target ADC channel that will be used to trigger a threshold event on DO1 pin.")]
+    public partial class CreateDO1TargetChannelPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target ADC channel that will be used to trigger a threshold event on DO1 pin.
+        /// </summary>
+        [Description("The value that target ADC channel that will be used to trigger a threshold event on DO1 pin.")]
+        public AdcChannel DO1TargetChannel { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO1TargetChannel register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AdcChannel GetPayload()
+        {
+            return DO1TargetChannel;
+        }
+
+        /// <summary>
+        /// Creates a message that target ADC channel that will be used to trigger a threshold event on DO1 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO1TargetChannel register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DO1TargetChannel.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target ADC channel that will be used to trigger a threshold event on DO1 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO1TargetChannelPayload")]
+    [Description("Creates a timestamped message payload that target ADC channel that will be used to trigger a threshold event on DO1 pin.")]
+    public partial class CreateTimestampedDO1TargetChannelPayload : CreateDO1TargetChannelPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target ADC channel that will be used to trigger a threshold event on DO1 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO1TargetChannel register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DO1TargetChannel.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target ADC channel that will be used to trigger a threshold event on DO2 pin.
+    /// </summary>
+    [DisplayName("DO2TargetChannelPayload")]
+    [Description("Creates a message payload that target ADC channel that will be used to trigger a threshold event on DO2 pin.")]
+    public partial class CreateDO2TargetChannelPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target ADC channel that will be used to trigger a threshold event on DO2 pin.
+        /// </summary>
+        [Description("The value that target ADC channel that will be used to trigger a threshold event on DO2 pin.")]
+        public AdcChannel DO2TargetChannel { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO2TargetChannel register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AdcChannel GetPayload()
+        {
+            return DO2TargetChannel;
+        }
+
+        /// <summary>
+        /// Creates a message that target ADC channel that will be used to trigger a threshold event on DO2 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO2TargetChannel register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DO2TargetChannel.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target ADC channel that will be used to trigger a threshold event on DO2 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO2TargetChannelPayload")]
+    [Description("Creates a timestamped message payload that target ADC channel that will be used to trigger a threshold event on DO2 pin.")]
+    public partial class CreateTimestampedDO2TargetChannelPayload : CreateDO2TargetChannelPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target ADC channel that will be used to trigger a threshold event on DO2 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO2TargetChannel register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DO2TargetChannel.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target ADC channel that will be used to trigger a threshold event on DO3 pin.
+    /// </summary>
+    [DisplayName("DO3TargetChannelPayload")]
+    [Description("Creates a message payload that target ADC channel that will be used to trigger a threshold event on DO3 pin.")]
+    public partial class CreateDO3TargetChannelPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target ADC channel that will be used to trigger a threshold event on DO3 pin.
+        /// </summary>
+        [Description("The value that target ADC channel that will be used to trigger a threshold event on DO3 pin.")]
+        public AdcChannel DO3TargetChannel { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO3TargetChannel register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AdcChannel GetPayload()
+        {
+            return DO3TargetChannel;
+        }
+
+        /// <summary>
+        /// Creates a message that target ADC channel that will be used to trigger a threshold event on DO3 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO3TargetChannel register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DO3TargetChannel.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target ADC channel that will be used to trigger a threshold event on DO3 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO3TargetChannelPayload")]
+    [Description("Creates a timestamped message payload that target ADC channel that will be used to trigger a threshold event on DO3 pin.")]
+    public partial class CreateTimestampedDO3TargetChannelPayload : CreateDO3TargetChannelPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target ADC channel that will be used to trigger a threshold event on DO3 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO3TargetChannel register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DO3TargetChannel.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value used to threshold an ADC read, and trigger DO0 pin.
+    /// </summary>
+    [DisplayName("DO0ThresholdPayload")]
+    [Description("Creates a message payload that value used to threshold an ADC read, and trigger DO0 pin.")]
+    public partial class CreateDO0ThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value used to threshold an ADC read, and trigger DO0 pin.
+        /// </summary>
+        [Description("The value that value used to threshold an ADC read, and trigger DO0 pin.")]
+        public short DO0Threshold { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0Threshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO0Threshold;
+        }
+
+        /// <summary>
+        /// Creates a message that value used to threshold an ADC read, and trigger DO0 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0Threshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DO0Threshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value used to threshold an ADC read, and trigger DO0 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO0ThresholdPayload")]
+    [Description("Creates a timestamped message payload that value used to threshold an ADC read, and trigger DO0 pin.")]
+    public partial class CreateTimestampedDO0ThresholdPayload : CreateDO0ThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value used to threshold an ADC read, and trigger DO0 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0Threshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DO0Threshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value used to threshold an ADC read, and trigger DO1 pin.
+    /// </summary>
+    [DisplayName("DO1ThresholdPayload")]
+    [Description("Creates a message payload that value used to threshold an ADC read, and trigger DO1 pin.")]
+    public partial class CreateDO1ThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value used to threshold an ADC read, and trigger DO1 pin.
+        /// </summary>
+        [Description("The value that value used to threshold an ADC read, and trigger DO1 pin.")]
+        public short DO1Threshold { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO1Threshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO1Threshold;
+        }
+
+        /// <summary>
+        /// Creates a message that value used to threshold an ADC read, and trigger DO1 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO1Threshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DO1Threshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value used to threshold an ADC read, and trigger DO1 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO1ThresholdPayload")]
+    [Description("Creates a timestamped message payload that value used to threshold an ADC read, and trigger DO1 pin.")]
+    public partial class CreateTimestampedDO1ThresholdPayload : CreateDO1ThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value used to threshold an ADC read, and trigger DO1 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO1Threshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DO1Threshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value used to threshold an ADC read, and trigger DO2 pin.
+    /// </summary>
+    [DisplayName("DO2ThresholdPayload")]
+    [Description("Creates a message payload that value used to threshold an ADC read, and trigger DO2 pin.")]
+    public partial class CreateDO2ThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value used to threshold an ADC read, and trigger DO2 pin.
+        /// </summary>
+        [Description("The value that value used to threshold an ADC read, and trigger DO2 pin.")]
+        public short DO2Threshold { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO2Threshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO2Threshold;
+        }
+
+        /// <summary>
+        /// Creates a message that value used to threshold an ADC read, and trigger DO2 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO2Threshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DO2Threshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value used to threshold an ADC read, and trigger DO2 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO2ThresholdPayload")]
+    [Description("Creates a timestamped message payload that value used to threshold an ADC read, and trigger DO2 pin.")]
+    public partial class CreateTimestampedDO2ThresholdPayload : CreateDO2ThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value used to threshold an ADC read, and trigger DO2 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO2Threshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DO2Threshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value used to threshold an ADC read, and trigger DO3 pin.
+    /// </summary>
+    [DisplayName("DO3ThresholdPayload")]
+    [Description("Creates a message payload that value used to threshold an ADC read, and trigger DO3 pin.")]
+    public partial class CreateDO3ThresholdPayload
     {
         /// <summary>
-        /// Represents the address of the <see cref="Reserved25"/> register. This field is constant.
+        /// Gets or sets the value that value used to threshold an ADC read, and trigger DO3 pin.
         /// </summary>
-        public const int Address = 86;
+        [Description("The value that value used to threshold an ADC read, and trigger DO3 pin.")]
+        public short DO3Threshold { get; set; }
 
         /// <summary>
-        /// Represents the payload type of the <see cref="Reserved25"/> register. This field is constant.
+        /// Creates a message payload for the DO3Threshold register.
         /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO3Threshold;
+        }
 
         /// <summary>
-        /// Represents the length of the <see cref="Reserved25"/> register. This field is constant.
+        /// Creates a message that value used to threshold an ADC read, and trigger DO3 pin.
         /// </summary>
-        public const int RegisterLength = 1;
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO3Threshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DO3Threshold.FromPayload(messageType, GetPayload());
+        }
     }
 
     /// <summary>
-    /// Represents a register that reserved.
+    /// Represents an operator that creates a timestamped message payload
+    /// that value used to threshold an ADC read, and trigger DO3 pin.
     /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved26
+    [DisplayName("TimestampedDO3ThresholdPayload")]
+    [Description("Creates a timestamped message payload that value used to threshold an ADC read, and trigger DO3 pin.")]
+    public partial class CreateTimestampedDO3ThresholdPayload : CreateDO3ThresholdPayload
     {
         /// <summary>
-        /// Represents the address of the <see cref="Reserved26"/> register. This field is constant.
-        /// </summary>
-        public const int Address = 87;
-
-        /// <summary>
-        /// Represents the payload type of the <see cref="Reserved26"/> register. This field is constant.
-        /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
-
-        /// <summary>
-        /// Represents the length of the <see cref="Reserved26"/> register. This field is constant.
+        /// Creates a timestamped message that value used to threshold an ADC read, and trigger DO3 pin.
         /// </summary>
-        public const int RegisterLength = 1;
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO3Threshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DO3Threshold.FromPayload(timestamp, messageType, GetPayload());
+        }
     }
 
     /// <summary>
-    /// Represents a register that reserved.
+    /// Represents an operator that creates a message payload
+    /// that value below which an ADC read clears DO0 pin. Follows DO0Threshold, without hysteresis, until it is written.
     /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved27
+    [DisplayName("DO0ThresholdLowPayload")]
+    [Description("Creates a message payload that value below which an ADC read clears DO0 pin. Follows DO0Threshold, without hysteresis, until it is written.")]
+    public partial class CreateDO0ThresholdLowPayload
     {
         /// <summary>
-        /// Represents the address of the <see cref="Reserved27"/> register. This field is constant.
+        /// Gets or sets the value that value below which an ADC read clears DO0 pin. Follows DO0Threshold, without hysteresis, until it is written.
         /// </summary>
-        public const int Address = 88;
+        [Description("The value that value below which an ADC read clears DO0 pin. Follows DO0Threshold, without hysteresis, until it is written.")]
+        public short DO0ThresholdLow { get; set; }
 
         /// <summary>
-        /// Represents the payload type of the <see cref="Reserved27"/> register. This field is constant.
+        /// Creates a message payload for the DO0ThresholdLow register.
         /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO0ThresholdLow;
+        }
 
         /// <summary>
-        /// Represents the length of the <see cref="Reserved27"/> register. This field is constant.
+        /// Creates a message that value below which an ADC read clears DO0 pin. Follows DO0Threshold, without hysteresis, until it is written.
         /// </summary>
-        public const int RegisterLength = 1;
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0ThresholdLow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DO0ThresholdLow.FromPayload(messageType, GetPayload());
+        }
     }
 
     /// <summary>
-    /// Represents a register that reserved.
+    /// Represents an operator that creates a timestamped message payload
+    /// that value below which an ADC read clears DO0 pin. Follows DO0Threshold, without hysteresis, until it is written.
     /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved28
+    [DisplayName("TimestampedDO0ThresholdLowPayload")]
+    [Description("Creates a timestamped message payload that value below which an ADC read clears DO0 pin. Follows DO0Threshold, without hysteresis, until it is written.")]
+    public partial class CreateTimestampedDO0ThresholdLowPayload : CreateDO0ThresholdLowPayload
     {
         /// <summary>
-        /// Represents the address of the <see cref="Reserved28"/> register. This field is constant.
-        /// </summary>
-        public const int Address = 89;
-
-        /// <summary>
-        /// Represents the payload type of the <see cref="Reserved28"/> register. This field is constant.
-        /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
-
-        /// <summary>
-        /// Represents the length of the <see cref="Reserved28"/> register. This field is constant.
+        /// Creates a timestamped message that value below which an ADC read clears DO0 pin. Follows DO0Threshold, without hysteresis, until it is written.
         /// </summary>
-        public const int RegisterLength = 1;
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0ThresholdLow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AnalogInput.DO0ThresholdLow.FromPayload(timestamp, messageType, GetPayload());
+        }
     }
 
     /// <summary>
-    /// Represents a register that reserved.
+    /// Represents an operator that creates a message payload
+    /// that value below which an ADC read clears DO1 pin. Follows DO1Threshold, without hysteresis, until it is written.
     /// </summary>
-    [Description("Reserved")]
-    internal partial class Reserved29
+    [DisplayName("DO1ThresholdLowPayload")]
+    [Description("Creates a message payload that value below which an ADC read clears DO1 pin. Follows DO1Threshold, without hysteresis, until it is written.")]
+    public partial class CreateDO1ThresholdLowPayload
     {
         /// <summary>
-        /// Represents the address of the <see cref="Reserved29"/> register. This field is constant.
+        /// Gets or sets the value that value below which an ADC read clears DO1 pin. Follows DO1Threshold, without hysteresis, until it is written.
         /// </summary>
-        public const int Address = 90;
+        [Description("The value that value below which an ADC read clears DO1 pin. Follows DO1Threshold, without hysteresis, until it is written.")]
+        public short DO1ThresholdLow { get; set; }
 
         /// <summary>
-        /// Represents the payload type of the <see cref="Reserved29"/> register. This field is constant.
+        /// Creates a message payload for the DO1ThresholdLow register.
         /// </summary>
-        public const PayloadType RegisterType = PayloadType.U8;
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO1ThresholdLow;
+        }
 
         /// <summary>
-        /// Represents the length of the <see cref="Reserved29"/> register. This field is constant.
+        /// Creates a message that value below which an ADC read clears DO1 pin. Follows DO1Threshold, without hysteresis, until it is written.
         /// </summary>
-        public const int RegisterLength = 1;
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO1ThresholdLow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AnalogInput.DO1ThresholdLow.FromPayload(messageType, GetPayload());
+        }
     }
 
     /// <summary>
-    /// Represents an operator which creates standard message payloads for the
-    /// AnalogInput device.
+    /// Represents an operator that creates a timestamped message payload
+    /// that value below which an ADC read clears DO1 pin. Follows DO1Threshold, without hysteresis, until it is written.
     /// </summary>
-    /// <seealso cref="CreateAcquisitionStatePayload"/>
-    /// <seealso cref="CreateAnalogDataPayload"/>
-    /// <seealso cref="CreateDigitalInputStatePayload"/>
-    /// <seealso cref="CreateRangeAndFilterPayload"/>
-    /// <seealso cref="CreateSamplingRatePayload"/>
-    /// <seealso cref="CreateDI0TriggerPayload"/>
-    /// <seealso cref="CreateDO0SyncPayload"/>
-    /// <seealso cref="CreateDO0PulseWidthPayload"/>
-    /// <seealso cref="CreateDigitalOutputSetPayload"/>
-    /// <seealso cref="CreateDigitalOutputClearPayload"/>
-    /// <seealso cref="CreateDigitalOutputTogglePayload"/>
-    /// <seealso cref="CreateDigitalOutputStatePayload"/>
-    /// <seealso cref="CreateSyncOutputPayload"/>
-    /// <seealso cref="CreateDO0TargetChannelPayload"/>
-    /// <seealso cref="CreateDO1TargetChannelPayload"/>
-    /// <seealso cref="CreateDO2TargetChannelPayload"/>
-    /// <seealso cref="CreateDO3TargetChannelPayload"/>
-    /// <seealso cref="CreateDO0ThresholdPayload"/>
-    /// <seealso cref="CreateDO1ThresholdPayload"/>
-    /// <seealso cref="CreateDO2ThresholdPayload"/>
-    /// <seealso cref="CreateDO3ThresholdPayload"/>
-    /// <seealso cref="CreateDO0TimeAboveThresholdPayload"/>
-    /// <seealso cref="CreateDO1TimeAboveThresholdPayload"/>
-    /// <seealso cref="CreateDO2TimeAboveThresholdPayload"/>
-    /// <seealso cref="CreateDO3TimeAboveThresholdPayload"/>
-    /// <seealso cref="CreateDO0TimeBelowThresholdPayload"/>
-    /// <seealso cref="CreateDO1TimeBelowThresholdPayload"/>
-    /// <seealso cref="CreateDO2TimeBelowThresholdPayload"/>
-    /// <seealso cref="CreateDO3TimeBelowThresholdPayload"/>
-    [XmlInclude(typeof(CreateAcquisitionStatePayload))]
-    [XmlInclude(typeof(CreateAnalogDataPayload))]
-    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateRangeAndFilterPayload))]
-    [XmlInclude(typeof(CreateSamplingRatePayload))]
-    [XmlInclude(typeof(CreateDI0TriggerPayload))]
-    [XmlInclude(typeof(CreateDO0SyncPayload))]
-    [XmlInclude(typeof(CreateDO0PulseWidthPayload))]
-    [XmlInclude(typeof(CreateDigitalOutputSetPayload))]
-    [XmlInclude(typeof(CreateDigitalOutputClearPayload))]
-    [XmlInclude(typeof(CreateDigitalOutputTogglePayload))]
-    [XmlInclude(typeof(CreateDigitalOutputStatePayload))]
-    [XmlInclude(typeof(CreateSyncOutputPayload))]
-    [XmlInclude(typeof(CreateDO0TargetChannelPayload))]
-    [XmlInclude(typeof(CreateDO1TargetChannelPayload))]
-    [XmlInclude(typeof(CreateDO2TargetChannelPayload))]
-    [XmlInclude(typeof(CreateDO3TargetChannelPayload))]
-    [XmlInclude(typeof(CreateDO0ThresholdPayload))]
-    [XmlInclude(typeof(CreateDO1ThresholdPayload))]
-    [XmlInclude(typeof(CreateDO2ThresholdPayload))]
-    [XmlInclude(typeof(CreateDO3ThresholdPayload))]
-    [XmlInclude(typeof(CreateDO0TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateDO1TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateDO2TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateDO3TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateDO0TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateDO1TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateDO2TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateDO3TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedAcquisitionStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedAnalogDataPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedRangeAndFilterPayload))]
-    [XmlInclude(typeof(CreateTimestampedSamplingRatePayload))]
-    [XmlInclude(typeof(CreateTimestampedDI0TriggerPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0SyncPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0PulseWidthPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputSetPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputClearPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputTogglePayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedSyncOutputPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0TargetChannelPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO1TargetChannelPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO2TargetChannelPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO3TargetChannelPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0ThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO1ThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO2ThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO3ThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO1TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO2TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO3TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO1TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO2TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO3TimeBelowThresholdPayload))]
-    [Description("Creates standard message payloads for the AnalogInput device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    [DisplayName("TimestampedDO1ThresholdLowPayload")]
+    [Description("Creates a timestamped message payload that value below which an ADC read clears DO1 pin. Follows DO1Threshold, without hysteresis, until it is written.")]
+    public partial class CreateTimestampedDO1ThresholdLowPayload : CreateDO1ThresholdLowPayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Creates a timestamped message that value below which an ADC read clears DO1 pin. Follows DO1Threshold, without hysteresis, until it is written.
         /// </summary>
-        public CreateMessage()
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO1ThresholdLow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            Payload = new CreateAcquisitionStatePayload();
+            return Harp.AnalogInput.DO1ThresholdLow.FromPayload(timestamp, messageType, GetPayload());
         }
-
-        string INamedElement.Name => $"{nameof(AnalogInput)}.{GetElementDisplayName(Payload)}";
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that enables the data acquisition.
+    /// that value below which an ADC read clears DO2 pin. Follows DO2Threshold, without hysteresis, until it is written.
     /// </summary>
-    [DisplayName("AcquisitionStatePayload")]
-    [Description("Creates a message payload that enables the data acquisition.")]
-    public partial class CreateAcquisitionStatePayload
+    [DisplayName("DO2ThresholdLowPayload")]
+    [Description("Creates a message payload that value below which an ADC read clears DO2 pin. Follows DO2Threshold, without hysteresis, until it is written.")]
+    public partial class CreateDO2ThresholdLowPayload
     {
         /// <summary>
-        /// Gets or sets the value that enables the data acquisition.
+        /// Gets or sets the value that value below which an ADC read clears DO2 pin. Follows DO2Threshold, without hysteresis, until it is written.
         /// </summary>
-        [Description("The value that enables the data acquisition.")]
-        public EnableFlag AcquisitionState { get; set; }
+        [Description("The value that value below which an ADC read clears DO2 pin. Follows DO2Threshold, without hysteresis, until it is written.")]
+        public short DO2ThresholdLow { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the AcquisitionState register.
+        /// Creates a message payload for the DO2ThresholdLow register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public EnableFlag GetPayload()
+        public short GetPayload()
         {
-            return AcquisitionState;
+            return DO2ThresholdLow;
         }
 
         /// <summary>
-        /// Creates a message that enables the data acquisition.
+        /// Creates a message that value below which an ADC read clears DO2 pin. Follows DO2Threshold, without hysteresis, until it is written.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the AcquisitionState register.</returns>
+        /// <returns>A new message for the DO2ThresholdLow register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.AcquisitionState.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DO2ThresholdLow.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that enables the data acquisition.
+    /// that value below which an ADC read clears DO2 pin. Follows DO2Threshold, without hysteresis, until it is written.
     /// </summary>
-    [DisplayName("TimestampedAcquisitionStatePayload")]
-    [Description("Creates a timestamped message payload that enables the data acquisition.")]
-    public partial class CreateTimestampedAcquisitionStatePayload : CreateAcquisitionStatePayload
+    [DisplayName("TimestampedDO2ThresholdLowPayload")]
+    [Description("Creates a timestamped message payload that value below which an ADC read clears DO2 pin. Follows DO2Threshold, without hysteresis, until it is written.")]
+    public partial class CreateTimestampedDO2ThresholdLowPayload : CreateDO2ThresholdLowPayload
     {
         /// <summary>
-        /// Creates a timestamped message that enables the data acquisition.
+        /// Creates a timestamped message that value below which an ADC read clears DO2 pin. Follows DO2Threshold, without hysteresis, until it is written.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the AcquisitionState register.</returns>
+        /// <returns>A new timestamped message for the DO2ThresholdLow register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.AcquisitionState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DO2ThresholdLow.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value from a single read of all ADC channels.
+    /// that value below which an ADC read clears DO3 pin. Follows DO3Threshold, without hysteresis, until it is written.
     /// </summary>
-    [DisplayName("AnalogDataPayload")]
-    [Description("Creates a message payload that value from a single read of all ADC channels.")]
-    public partial class CreateAnalogDataPayload
+    [DisplayName("DO3ThresholdLowPayload")]
+    [Description("Creates a message payload that value below which an ADC read clears DO3 pin. Follows DO3Threshold, without hysteresis, until it is written.")]
+    public partial class CreateDO3ThresholdLowPayload
     {
         /// <summary>
-        /// Gets or sets a value to write on payload member Channel0.
-        /// </summary>
-        [Description("")]
-        public short Channel0 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel1.
-        /// </summary>
-        [Description("")]
-        public short Channel1 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel2.
-        /// </summary>
-        [Description("")]
-        public short Channel2 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel3.
-        /// </summary>
-        [Description("")]
-        public short Channel3 { get; set; }
+        /// Gets or sets the value that value below which an ADC read clears DO3 pin. Follows DO3Threshold, without hysteresis, until it is written.
+        /// </summary>
+        [Description("The value that value below which an ADC read clears DO3 pin. Follows DO3Threshold, without hysteresis, until it is written.")]
+        public short DO3ThresholdLow { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the AnalogData register.
+        /// Creates a message payload for the DO3ThresholdLow register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public AnalogDataPayload GetPayload()
+        public short GetPayload()
         {
-            AnalogDataPayload value;
-            value.Channel0 = Channel0;
-            value.Channel1 = Channel1;
-            value.Channel2 = Channel2;
-            value.Channel3 = Channel3;
-            return value;
+            return DO3ThresholdLow;
         }
 
         /// <summary>
-        /// Creates a message that value from a single read of all ADC channels.
+        /// Creates a message that value below which an ADC read clears DO3 pin. Follows DO3Threshold, without hysteresis, until it is written.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the AnalogData register.</returns>
+        /// <returns>A new message for the DO3ThresholdLow register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.AnalogData.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DO3ThresholdLow.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value from a single read of all ADC channels.
+    /// that value below which an ADC read clears DO3 pin. Follows DO3Threshold, without hysteresis, until it is written.
     /// </summary>
-    [DisplayName("TimestampedAnalogDataPayload")]
-    [Description("Creates a timestamped message payload that value from a single read of all ADC channels.")]
-    public partial class CreateTimestampedAnalogDataPayload : CreateAnalogDataPayload
+    [DisplayName("TimestampedDO3ThresholdLowPayload")]
+    [Description("Creates a timestamped message payload that value below which an ADC read clears DO3 pin. Follows DO3Threshold, without hysteresis, until it is written.")]
+    public partial class CreateTimestampedDO3ThresholdLowPayload : CreateDO3ThresholdLowPayload
     {
         /// <summary>
-        /// Creates a timestamped message that value from a single read of all ADC channels.
+        /// Creates a timestamped message that value below which an ADC read clears DO3 pin. Follows DO3Threshold, without hysteresis, until it is written.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the AnalogData register.</returns>
+        /// <returns>A new timestamped message for the DO3ThresholdLow register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.AnalogData.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DO3ThresholdLow.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that state of the digital input pin 0.
+    /// that time (ms) above threshold value that is required to trigger a DO0 pin event.
     /// </summary>
-    [DisplayName("DigitalInputStatePayload")]
-    [Description("Creates a message payload that state of the digital input pin 0.")]
-    public partial class CreateDigitalInputStatePayload
+    [DisplayName("DO0TimeAboveThresholdPayload")]
+    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO0 pin event.")]
+    public partial class CreateDO0TimeAboveThresholdPayload
     {
         /// <summary>
-        /// Gets or sets the value that state of the digital input pin 0.
+        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO0 pin event.
         /// </summary>
-        [Description("The value that state of the digital input pin 0.")]
-        public DigitalInputs DigitalInputState { get; set; }
+        [Description("The value that time (ms) above threshold value that is required to trigger a DO0 pin event.")]
+        public ushort DO0TimeAboveThreshold { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the DigitalInputState register.
+        /// Creates a message payload for the DO0TimeAboveThreshold register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalInputs GetPayload()
+        public ushort GetPayload()
         {
-            return DigitalInputState;
+            return DO0TimeAboveThreshold;
         }
 
         /// <summary>
-        /// Creates a message that state of the digital input pin 0.
+        /// Creates a message that time (ms) above threshold value that is required to trigger a DO0 pin event.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalInputState register.</returns>
+        /// <returns>A new message for the DO0TimeAboveThreshold register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DigitalInputState.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DO0TimeAboveThreshold.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that state of the digital input pin 0.
+    /// that time (ms) above threshold value that is required to trigger a DO0 pin event.
     /// </summary>
-    [DisplayName("TimestampedDigitalInputStatePayload")]
-    [Description("Creates a timestamped message payload that state of the digital input pin 0.")]
-    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    [DisplayName("TimestampedDO0TimeAboveThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO0 pin event.")]
+    public partial class CreateTimestampedDO0TimeAboveThresholdPayload : CreateDO0TimeAboveThresholdPayload
     {
         /// <summary>
-        /// Creates a timestamped message that state of the digital input pin 0.
+        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO0 pin event.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        /// <returns>A new timestamped message for the DO0TimeAboveThreshold register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DO0TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the range and LowPass filter cutoff of the ADC.
+    /// that time (ms) above threshold value that is required to trigger a DO1 pin event.
     /// </summary>
-    [DisplayName("RangeAndFilterPayload")]
-    [Description("Creates a message payload that sets the range and LowPass filter cutoff of the ADC.")]
-    public partial class CreateRangeAndFilterPayload
+    [DisplayName("DO1TimeAboveThresholdPayload")]
+    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO1 pin event.")]
+    public partial class CreateDO1TimeAboveThresholdPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the range and LowPass filter cutoff of the ADC.
+        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO1 pin event.
         /// </summary>
-        [Description("The value that sets the range and LowPass filter cutoff of the ADC.")]
-        public RangeAndFilterConfig RangeAndFilter { get; set; }
+        [Description("The value that time (ms) above threshold value that is required to trigger a DO1 pin event.")]
+        public ushort DO1TimeAboveThreshold { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the RangeAndFilter register.
+        /// Creates a message payload for the DO1TimeAboveThreshold register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public RangeAndFilterConfig GetPayload()
+        public ushort GetPayload()
         {
-            return RangeAndFilter;
+            return DO1TimeAboveThreshold;
         }
 
         /// <summary>
-        /// Creates a message that sets the range and LowPass filter cutoff of the ADC.
+        /// Creates a message that time (ms) above threshold value that is required to trigger a DO1 pin event.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the RangeAndFilter register.</returns>
+        /// <returns>A new message for the DO1TimeAboveThreshold register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.RangeAndFilter.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DO1TimeAboveThreshold.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the range and LowPass filter cutoff of the ADC.
+    /// that time (ms) above threshold value that is required to trigger a DO1 pin event.
     /// </summary>
-    [DisplayName("TimestampedRangeAndFilterPayload")]
-    [Description("Creates a timestamped message payload that sets the range and LowPass filter cutoff of the ADC.")]
-    public partial class CreateTimestampedRangeAndFilterPayload : CreateRangeAndFilterPayload
+    [DisplayName("TimestampedDO1TimeAboveThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO1 pin event.")]
+    public partial class CreateTimestampedDO1TimeAboveThresholdPayload : CreateDO1TimeAboveThresholdPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the range and LowPass filter cutoff of the ADC.
+        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO1 pin event.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the RangeAndFilter register.</returns>
+        /// <returns>A new timestamped message for the DO1TimeAboveThreshold register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.RangeAndFilter.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DO1TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the sampling frequency of the ADC.
+    /// that time (ms) above threshold value that is required to trigger a DO2 pin event.
     /// </summary>
-    [DisplayName("SamplingRatePayload")]
-    [Description("Creates a message payload that sets the sampling frequency of the ADC.")]
-    public partial class CreateSamplingRatePayload
+    [DisplayName("DO2TimeAboveThresholdPayload")]
+    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO2 pin event.")]
+    public partial class CreateDO2TimeAboveThresholdPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the sampling frequency of the ADC.
+        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO2 pin event.
         /// </summary>
-        [Description("The value that sets the sampling frequency of the ADC.")]
-        public SamplingRateMode SamplingRate { get; set; }
+        [Description("The value that time (ms) above threshold value that is required to trigger a DO2 pin event.")]
+        public ushort DO2TimeAboveThreshold { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the SamplingRate register.
+        /// Creates a message payload for the DO2TimeAboveThreshold register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public SamplingRateMode GetPayload()
+        public ushort GetPayload()
         {
-            return SamplingRate;
+            return DO2TimeAboveThreshold;
         }
 
         /// <summary>
-        /// Creates a message that sets the sampling frequency of the ADC.
+        /// Creates a message that time (ms) above threshold value that is required to trigger a DO2 pin event.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SamplingRate register.</returns>
+        /// <returns>A new message for the DO2TimeAboveThreshold register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.SamplingRate.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DO2TimeAboveThreshold.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the sampling frequency of the ADC.
+    /// that time (ms) above threshold value that is required to trigger a DO2 pin event.
     /// </summary>
-    [DisplayName("TimestampedSamplingRatePayload")]
-    [Description("Creates a timestamped message payload that sets the sampling frequency of the ADC.")]
-    public partial class CreateTimestampedSamplingRatePayload : CreateSamplingRatePayload
+    [DisplayName("TimestampedDO2TimeAboveThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO2 pin event.")]
+    public partial class CreateTimestampedDO2TimeAboveThresholdPayload : CreateDO2TimeAboveThresholdPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the sampling frequency of the ADC.
+        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO2 pin event.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SamplingRate register.</returns>
+        /// <returns>A new timestamped message for the DO2TimeAboveThreshold register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.SamplingRate.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DO2TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configuration of the digital input pin 0.
+    /// that time (ms) above threshold value that is required to trigger a DO3 pin event.
     /// </summary>
-    [DisplayName("DI0TriggerPayload")]
-    [Description("Creates a message payload that configuration of the digital input pin 0.")]
-    public partial class CreateDI0TriggerPayload
+    [DisplayName("DO3TimeAboveThresholdPayload")]
+    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO3 pin event.")]
+    public partial class CreateDO3TimeAboveThresholdPayload
     {
         /// <summary>
-        /// Gets or sets the value that configuration of the digital input pin 0.
+        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO3 pin event.
         /// </summary>
-        [Description("The value that configuration of the digital input pin 0.")]
-        public TriggerConfig DI0Trigger { get; set; }
+        [Description("The value that time (ms) above threshold value that is required to trigger a DO3 pin event.")]
+        public ushort DO3TimeAboveThreshold { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the DI0Trigger register.
+        /// Creates a message payload for the DO3TimeAboveThreshold register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public TriggerConfig GetPayload()
+        public ushort GetPayload()
         {
-            return DI0Trigger;
+            return DO3TimeAboveThreshold;
         }
 
         /// <summary>
-        /// Creates a message that configuration of the digital input pin 0.
+        /// Creates a message that time (ms) above threshold value that is required to trigger a DO3 pin event.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DI0Trigger register.</returns>
+        /// <returns>A new message for the DO3TimeAboveThreshold register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DI0Trigger.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DO3TimeAboveThreshold.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configuration of the digital input pin 0.
+    /// that time (ms) above threshold value that is required to trigger a DO3 pin event.
     /// </summary>
-    [DisplayName("TimestampedDI0TriggerPayload")]
-    [Description("Creates a timestamped message payload that configuration of the digital input pin 0.")]
-    public partial class CreateTimestampedDI0TriggerPayload : CreateDI0TriggerPayload
+    [DisplayName("TimestampedDO3TimeAboveThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO3 pin event.")]
+    public partial class CreateTimestampedDO3TimeAboveThresholdPayload : CreateDO3TimeAboveThresholdPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configuration of the digital input pin 0.
+        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO3 pin event.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DI0Trigger register.</returns>
+        /// <returns>A new timestamped message for the DO3TimeAboveThreshold register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DI0Trigger.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DO3TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configuration of the digital output pin 0.
+    /// that time (ms) below threshold value that is required to trigger a DO0 pin event.
     /// </summary>
-    [DisplayName("DO0SyncPayload")]
-    [Description("Creates a message payload that configuration of the digital output pin 0.")]
-    public partial class CreateDO0SyncPayload
+    [DisplayName("DO0TimeBelowThresholdPayload")]
+    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO0 pin event.")]
+    public partial class CreateDO0TimeBelowThresholdPayload
     {
         /// <summary>
-        /// Gets or sets the value that configuration of the digital output pin 0.
+        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO0 pin event.
         /// </summary>
-        [Description("The value that configuration of the digital output pin 0.")]
-        public SyncConfig DO0Sync { get; set; }
+        [Description("The value that time (ms) below threshold value that is required to trigger a DO0 pin event.")]
+        public ushort DO0TimeBelowThreshold { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the DO0Sync register.
+        /// Creates a message payload for the DO0TimeBelowThreshold register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public SyncConfig GetPayload()
+        public ushort GetPayload()
         {
-            return DO0Sync;
+            return DO0TimeBelowThreshold;
         }
 
         /// <summary>
-        /// Creates a message that configuration of the digital output pin 0.
+        /// Creates a message that time (ms) below threshold value that is required to trigger a DO0 pin event.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0Sync register.</returns>
+        /// <returns>A new message for the DO0TimeBelowThreshold register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO0Sync.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DO0TimeBelowThreshold.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configuration of the digital output pin 0.
+    /// that time (ms) below threshold value that is required to trigger a DO0 pin event.
     /// </summary>
-    [DisplayName("TimestampedDO0SyncPayload")]
-    [Description("Creates a timestamped message payload that configuration of the digital output pin 0.")]
-    public partial class CreateTimestampedDO0SyncPayload : CreateDO0SyncPayload
+    [DisplayName("TimestampedDO0TimeBelowThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO0 pin event.")]
+    public partial class CreateTimestampedDO0TimeBelowThresholdPayload : CreateDO0TimeBelowThresholdPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configuration of the digital output pin 0.
+        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO0 pin event.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0Sync register.</returns>
+        /// <returns>A new timestamped message for the DO0TimeBelowThreshold register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO0Sync.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DO0TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+    /// that time (ms) below threshold value that is required to trigger a DO1 pin event.
     /// </summary>
-    [DisplayName("DO0PulseWidthPayload")]
-    [Description("Creates a message payload that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.")]
-    public partial class CreateDO0PulseWidthPayload
+    [DisplayName("DO1TimeBelowThresholdPayload")]
+    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO1 pin event.")]
+    public partial class CreateDO1TimeBelowThresholdPayload
     {
         /// <summary>
-        /// Gets or sets the value that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO1 pin event.
         /// </summary>
-        [Range(min: 1, max: 250)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.")]
-        public byte DO0PulseWidth { get; set; } = 1;
+        [Description("The value that time (ms) below threshold value that is required to trigger a DO1 pin event.")]
+        public ushort DO1TimeBelowThreshold { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the DO0PulseWidth register.
+        /// Creates a message payload for the DO1TimeBelowThreshold register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte GetPayload()
+        public ushort GetPayload()
         {
-            return DO0PulseWidth;
+            return DO1TimeBelowThreshold;
         }
 
         /// <summary>
-        /// Creates a message that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+        /// Creates a message that time (ms) below threshold value that is required to trigger a DO1 pin event.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0PulseWidth register.</returns>
+        /// <returns>A new message for the DO1TimeBelowThreshold register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO0PulseWidth.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DO1TimeBelowThreshold.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+    /// that time (ms) below threshold value that is required to trigger a DO1 pin event.
     /// </summary>
-    [DisplayName("TimestampedDO0PulseWidthPayload")]
-    [Description("Creates a timestamped message payload that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.")]
-    public partial class CreateTimestampedDO0PulseWidthPayload : CreateDO0PulseWidthPayload
+    [DisplayName("TimestampedDO1TimeBelowThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO1 pin event.")]
+    public partial class CreateTimestampedDO1TimeBelowThresholdPayload : CreateDO1TimeBelowThresholdPayload
     {
         /// <summary>
-        /// Creates a timestamped message that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO1 pin event.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0PulseWidth register.</returns>
+        /// <returns>A new timestamped message for the DO1TimeBelowThreshold register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO0PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DO1TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that set the specified digital output lines.
+    /// that time (ms) below threshold value that is required to trigger a DO2 pin event.
     /// </summary>
-    [DisplayName("DigitalOutputSetPayload")]
-    [Description("Creates a message payload that set the specified digital output lines.")]
-    public partial class CreateDigitalOutputSetPayload
+    [DisplayName("DO2TimeBelowThresholdPayload")]
+    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO2 pin event.")]
+    public partial class CreateDO2TimeBelowThresholdPayload
     {
         /// <summary>
-        /// Gets or sets the value that set the specified digital output lines.
+        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO2 pin event.
         /// </summary>
-        [Description("The value that set the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputSet { get; set; }
+        [Description("The value that time (ms) below threshold value that is required to trigger a DO2 pin event.")]
+        public ushort DO2TimeBelowThreshold { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputSet register.
+        /// Creates a message payload for the DO2TimeBelowThreshold register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public ushort GetPayload()
         {
-            return DigitalOutputSet;
+            return DO2TimeBelowThreshold;
         }
 
         /// <summary>
-        /// Creates a message that set the specified digital output lines.
+        /// Creates a message that time (ms) below threshold value that is required to trigger a DO2 pin event.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputSet register.</returns>
+        /// <returns>A new message for the DO2TimeBelowThreshold register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DigitalOutputSet.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DO2TimeBelowThreshold.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that set the specified digital output lines.
+    /// that time (ms) below threshold value that is required to trigger a DO2 pin event.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputSetPayload")]
-    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputSetPayload : CreateDigitalOutputSetPayload
+    [DisplayName("TimestampedDO2TimeBelowThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO2 pin event.")]
+    public partial class CreateTimestampedDO2TimeBelowThresholdPayload : CreateDO2TimeBelowThresholdPayload
     {
         /// <summary>
-        /// Creates a timestamped message that set the specified digital output lines.
+        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO2 pin event.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputSet register.</returns>
+        /// <returns>A new timestamped message for the DO2TimeBelowThreshold register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DigitalOutputSet.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DO2TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that clear the specified digital output lines.
+    /// that time (ms) below threshold value that is required to trigger a DO3 pin event.
     /// </summary>
-    [DisplayName("DigitalOutputClearPayload")]
-    [Description("Creates a message payload that clear the specified digital output lines.")]
-    public partial class CreateDigitalOutputClearPayload
+    [DisplayName("DO3TimeBelowThresholdPayload")]
+    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO3 pin event.")]
+    public partial class CreateDO3TimeBelowThresholdPayload
     {
         /// <summary>
-        /// Gets or sets the value that clear the specified digital output lines.
+        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO3 pin event.
         /// </summary>
-        [Description("The value that clear the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputClear { get; set; }
+        [Description("The value that time (ms) below threshold value that is required to trigger a DO3 pin event.")]
+        public ushort DO3TimeBelowThreshold { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputClear register.
+        /// Creates a message payload for the DO3TimeBelowThreshold register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public ushort GetPayload()
         {
-            return DigitalOutputClear;
+            return DO3TimeBelowThreshold;
         }
 
         /// <summary>
-        /// Creates a message that clear the specified digital output lines.
+        /// Creates a message that time (ms) below threshold value that is required to trigger a DO3 pin event.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputClear register.</returns>
+        /// <returns>A new message for the DO3TimeBelowThreshold register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DigitalOutputClear.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DO3TimeBelowThreshold.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that clear the specified digital output lines.
+    /// that time (ms) below threshold value that is required to trigger a DO3 pin event.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputClearPayload")]
-    [Description("Creates a timestamped message payload that clear the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputClearPayload : CreateDigitalOutputClearPayload
+    [DisplayName("TimestampedDO3TimeBelowThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO3 pin event.")]
+    public partial class CreateTimestampedDO3TimeBelowThresholdPayload : CreateDO3TimeBelowThresholdPayload
     {
         /// <summary>
-        /// Creates a timestamped message that clear the specified digital output lines.
+        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO3 pin event.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputClear register.</returns>
+        /// <returns>A new timestamped message for the DO3TimeBelowThreshold register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DigitalOutputClear.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DO3TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that toggle the specified digital output lines.
+    /// that sets the sampling period (us) of the ADC when SamplingRate is set to SamplingRateCustom.
     /// </summary>
-    [DisplayName("DigitalOutputTogglePayload")]
-    [Description("Creates a message payload that toggle the specified digital output lines.")]
-    public partial class CreateDigitalOutputTogglePayload
+    [DisplayName("SamplingPeriodPayload")]
+    [Description("Creates a message payload that sets the sampling period (us) of the ADC when SamplingRate is set to SamplingRateCustom.")]
+    public partial class CreateSamplingPeriodPayload
     {
         /// <summary>
-        /// Gets or sets the value that toggle the specified digital output lines.
+        /// Gets or sets the value that sets the sampling period (us) of the ADC when SamplingRate is set to SamplingRateCustom.
         /// </summary>
-        [Description("The value that toggle the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputToggle { get; set; }
+        [Range(min: 50, max: 16000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the sampling period (us) of the ADC when SamplingRate is set to SamplingRateCustom.")]
+        public ushort SamplingPeriod { get; set; } = 1000;
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputToggle register.
+        /// Creates a message payload for the SamplingPeriod register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public ushort GetPayload()
         {
-            return DigitalOutputToggle;
+            return SamplingPeriod;
         }
 
         /// <summary>
-        /// Creates a message that toggle the specified digital output lines.
+        /// Creates a message that sets the sampling period (us) of the ADC when SamplingRate is set to SamplingRateCustom.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputToggle register.</returns>
+        /// <returns>A new message for the SamplingPeriod register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DigitalOutputToggle.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.SamplingPeriod.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that toggle the specified digital output lines.
+    /// that sets the sampling period (us) of the ADC when SamplingRate is set to SamplingRateCustom.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputTogglePayload")]
-    [Description("Creates a timestamped message payload that toggle the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputTogglePayload : CreateDigitalOutputTogglePayload
+    [DisplayName("TimestampedSamplingPeriodPayload")]
+    [Description("Creates a timestamped message payload that sets the sampling period (us) of the ADC when SamplingRate is set to SamplingRateCustom.")]
+    public partial class CreateTimestampedSamplingPeriodPayload : CreateSamplingPeriodPayload
     {
         /// <summary>
-        /// Creates a timestamped message that toggle the specified digital output lines.
+        /// Creates a timestamped message that sets the sampling period (us) of the ADC when SamplingRate is set to SamplingRateCustom.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputToggle register.</returns>
+        /// <returns>A new timestamped message for the SamplingPeriod register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DigitalOutputToggle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.SamplingPeriod.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+    /// that sets the number of ADC reads packed on each AnalogData event. The event is timestamped with the first read. BatchSize times the number of enabled channels must not exceed 120.
     /// </summary>
-    [DisplayName("DigitalOutputStatePayload")]
-    [Description("Creates a message payload that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.")]
-    public partial class CreateDigitalOutputStatePayload
+    [DisplayName("BatchSizePayload")]
+    [Description("Creates a message payload that sets the number of ADC reads packed on each AnalogData event. The event is timestamped with the first read. BatchSize times the number of enabled channels must not exceed 120.")]
+    public partial class CreateBatchSizePayload
     {
         /// <summary>
-        /// Gets or sets the value that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+        /// Gets or sets the value that sets the number of ADC reads packed on each AnalogData event. The event is timestamped with the first read. BatchSize times the number of enabled channels must not exceed 120.
         /// </summary>
-        [Description("The value that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.")]
-        public DigitalOutputs DigitalOutputState { get; set; }
+        [Range(min: 1, max: 120)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the number of ADC reads packed on each AnalogData event. The event is timestamped with the first read. BatchSize times the number of enabled channels must not exceed 120.")]
+        public byte BatchSize { get; set; } = 1;
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputState register.
+        /// Creates a message payload for the BatchSize register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public byte GetPayload()
         {
-            return DigitalOutputState;
+            return BatchSize;
         }
 
         /// <summary>
-        /// Creates a message that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+        /// Creates a message that sets the number of ADC reads packed on each AnalogData event. The event is timestamped with the first read. BatchSize times the number of enabled channels must not exceed 120.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputState register.</returns>
+        /// <returns>A new message for the BatchSize register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DigitalOutputState.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.BatchSize.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+    /// that sets the number of ADC reads packed on each AnalogData event. The event is timestamped with the first read. BatchSize times the number of enabled channels must not exceed 120.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputStatePayload")]
-    [Description("Creates a timestamped message payload that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.")]
-    public partial class CreateTimestampedDigitalOutputStatePayload : CreateDigitalOutputStatePayload
+    [DisplayName("TimestampedBatchSizePayload")]
+    [Description("Creates a timestamped message payload that sets the number of ADC reads packed on each AnalogData event. The event is timestamped with the first read. BatchSize times the number of enabled channels must not exceed 120.")]
+    public partial class CreateTimestampedBatchSizePayload : CreateBatchSizePayload
     {
         /// <summary>
-        /// Creates a timestamped message that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+        /// Creates a timestamped message that sets the number of ADC reads packed on each AnalogData event. The event is timestamped with the first read. BatchSize times the number of enabled channels must not exceed 120.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputState register.</returns>
+        /// <returns>A new timestamped message for the BatchSize register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DigitalOutputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.BatchSize.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that digital output that will be set when acquisition starts.
+    /// that counts the ADC reads lost because the firmware sample buffer was full. Writing any value resets it.
     /// </summary>
-    [DisplayName("SyncOutputPayload")]
-    [Description("Creates a message payload that digital output that will be set when acquisition starts.")]
-    public partial class CreateSyncOutputPayload
+    [DisplayName("SampleRingOverflowsPayload")]
+    [Description("Creates a message payload that counts the ADC reads lost because the firmware sample buffer was full. Writing any value resets it.")]
+    public partial class CreateSampleRingOverflowsPayload
     {
         /// <summary>
-        /// Gets or sets the value that digital output that will be set when acquisition starts.
+        /// Gets or sets the value that counts the ADC reads lost because the firmware sample buffer was full. Writing any value resets it.
         /// </summary>
-        [Description("The value that digital output that will be set when acquisition starts.")]
-        public StartSyncOutputTarget SyncOutput { get; set; }
+        [Description("The value that counts the ADC reads lost because the firmware sample buffer was full. Writing any value resets it.")]
+        public uint SampleRingOverflows { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SyncOutput register.
+        /// Creates a message payload for the SampleRingOverflows register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public StartSyncOutputTarget GetPayload()
+        public uint GetPayload()
         {
-            return SyncOutput;
+            return SampleRingOverflows;
         }
 
         /// <summary>
-        /// Creates a message that digital output that will be set when acquisition starts.
+        /// Creates a message that counts the ADC reads lost because the firmware sample buffer was full. Writing any value resets it.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SyncOutput register.</returns>
+        /// <returns>A new message for the SampleRingOverflows register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.SyncOutput.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.SampleRingOverflows.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that digital output that will be set when acquisition starts.
+    /// that counts the ADC reads lost because the firmware sample buffer was full. Writing any value resets it.
     /// </summary>
-    [DisplayName("TimestampedSyncOutputPayload")]
-    [Description("Creates a timestamped message payload that digital output that will be set when acquisition starts.")]
-    public partial class CreateTimestampedSyncOutputPayload : CreateSyncOutputPayload
+    [DisplayName("TimestampedSampleRingOverflowsPayload")]
+    [Description("Creates a timestamped message payload that counts the ADC reads lost because the firmware sample buffer was full. Writing any value resets it.")]
+    public partial class CreateTimestampedSampleRingOverflowsPayload : CreateSampleRingOverflowsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that digital output that will be set when acquisition starts.
+        /// Creates a timestamped message that counts the ADC reads lost because the firmware sample buffer was full. Writing any value resets it.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SyncOutput register.</returns>
+        /// <returns>A new timestamped message for the SampleRingOverflows register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.SyncOutput.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.SampleRingOverflows.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target ADC channel that will be used to trigger a threshold event on DO0 pin.
+    /// that reports the maximum number of ADC reads waiting to be sent on the firmware sample buffer. Writing any value resets it.
     /// </summary>
-    [DisplayName("DO0TargetChannelPayload")]
-    [Description("Creates a message payload that target ADC channel that will be used to trigger a threshold event on DO0 pin.")]
-    public partial class CreateDO0TargetChannelPayload
+    [DisplayName("SampleRingHighWaterPayload")]
+    [Description("Creates a message payload that reports the maximum number of ADC reads waiting to be sent on the firmware sample buffer. Writing any value resets it.")]
+    public partial class CreateSampleRingHighWaterPayload
     {
         /// <summary>
-        /// Gets or sets the value that target ADC channel that will be used to trigger a threshold event on DO0 pin.
+        /// Gets or sets the value that reports the maximum number of ADC reads waiting to be sent on the firmware sample buffer. Writing any value resets it.
         /// </summary>
-        [Description("The value that target ADC channel that will be used to trigger a threshold event on DO0 pin.")]
-        public AdcChannel DO0TargetChannel { get; set; }
+        [Description("The value that reports the maximum number of ADC reads waiting to be sent on the firmware sample buffer. Writing any value resets it.")]
+        public byte SampleRingHighWater { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0TargetChannel register.
+        /// Creates a message payload for the SampleRingHighWater register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public AdcChannel GetPayload()
+        public byte GetPayload()
         {
-            return DO0TargetChannel;
+            return SampleRingHighWater;
         }
 
         /// <summary>
-        /// Creates a message that target ADC channel that will be used to trigger a threshold event on DO0 pin.
+        /// Creates a message that reports the maximum number of ADC reads waiting to be sent on the firmware sample buffer. Writing any value resets it.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0TargetChannel register.</returns>
+        /// <returns>A new message for the SampleRingHighWater register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO0TargetChannel.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.SampleRingHighWater.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target ADC channel that will be used to trigger a threshold event on DO0 pin.
+    /// that reports the maximum number of ADC reads waiting to be sent on the firmware sample buffer. Writing any value resets it.
     /// </summary>
-    [DisplayName("TimestampedDO0TargetChannelPayload")]
-    [Description("Creates a timestamped message payload that target ADC channel that will be used to trigger a threshold event on DO0 pin.")]
-    public partial class CreateTimestampedDO0TargetChannelPayload : CreateDO0TargetChannelPayload
+    [DisplayName("TimestampedSampleRingHighWaterPayload")]
+    [Description("Creates a timestamped message payload that reports the maximum number of ADC reads waiting to be sent on the firmware sample buffer. Writing any value resets it.")]
+    public partial class CreateTimestampedSampleRingHighWaterPayload : CreateSampleRingHighWaterPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target ADC channel that will be used to trigger a threshold event on DO0 pin.
+        /// Creates a timestamped message that reports the maximum number of ADC reads waiting to be sent on the firmware sample buffer. Writing any value resets it.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0TargetChannel register.</returns>
+        /// <returns>A new timestamped message for the SampleRingHighWater register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO0TargetChannel.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.SampleRingHighWater.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target ADC channel that will be used to trigger a threshold event on DO1 pin.
+    /// that reports the minimum and maximum time between consecutive conversion starts, in units of 250 ns. Writing any value resets it.
     /// </summary>
-    [DisplayName("DO1TargetChannelPayload")]
-    [Description("Creates a message payload that target ADC channel that will be used to trigger a threshold event on DO1 pin.")]
-    public partial class CreateDO1TargetChannelPayload
+    [DisplayName("ConversionIntervalPayload")]
+    [Description("Creates a message payload that reports the minimum and maximum time between consecutive conversion starts, in units of 250 ns. Writing any value resets it.")]
+    public partial class CreateConversionIntervalPayload
     {
         /// <summary>
-        /// Gets or sets the value that target ADC channel that will be used to trigger a threshold event on DO1 pin.
+        /// Gets or sets the value that reports the minimum and maximum time between consecutive conversion starts, in units of 250 ns. Writing any value resets it.
         /// </summary>
-        [Description("The value that target ADC channel that will be used to trigger a threshold event on DO1 pin.")]
-        public AdcChannel DO1TargetChannel { get; set; }
+        [Description("The value that reports the minimum and maximum time between consecutive conversion starts, in units of 250 ns. Writing any value resets it.")]
+        public ushort[] ConversionInterval { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO1TargetChannel register.
+        /// Creates a message payload for the ConversionInterval register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public AdcChannel GetPayload()
+        public ushort[] GetPayload()
         {
-            return DO1TargetChannel;
+            return ConversionInterval;
         }
 
         /// <summary>
-        /// Creates a message that target ADC channel that will be used to trigger a threshold event on DO1 pin.
+        /// Creates a message that reports the minimum and maximum time between consecutive conversion starts, in units of 250 ns. Writing any value resets it.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO1TargetChannel register.</returns>
+        /// <returns>A new message for the ConversionInterval register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO1TargetChannel.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.ConversionInterval.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target ADC channel that will be used to trigger a threshold event on DO1 pin.
+    /// that reports the minimum and maximum time between consecutive conversion starts, in units of 250 ns. Writing any value resets it.
     /// </summary>
-    [DisplayName("TimestampedDO1TargetChannelPayload")]
-    [Description("Creates a timestamped message payload that target ADC channel that will be used to trigger a threshold event on DO1 pin.")]
-    public partial class CreateTimestampedDO1TargetChannelPayload : CreateDO1TargetChannelPayload
+    [DisplayName("TimestampedConversionIntervalPayload")]
+    [Description("Creates a timestamped message payload that reports the minimum and maximum time between consecutive conversion starts, in units of 250 ns. Writing any value resets it.")]
+    public partial class CreateTimestampedConversionIntervalPayload : CreateConversionIntervalPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target ADC channel that will be used to trigger a threshold event on DO1 pin.
+        /// Creates a timestamped message that reports the minimum and maximum time between consecutive conversion starts, in units of 250 ns. Writing any value resets it.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO1TargetChannel register.</returns>
+        /// <returns>A new timestamped message for the ConversionInterval register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO1TargetChannel.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.ConversionInterval.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target ADC channel that will be used to trigger a threshold event on DO2 pin.
+    /// that sets the oversampling ratio of the ADC without changing the range. The conversion time plus the readout must fit in the sampling period.
     /// </summary>
-    [DisplayName("DO2TargetChannelPayload")]
-    [Description("Creates a message payload that target ADC channel that will be used to trigger a threshold event on DO2 pin.")]
-    public partial class CreateDO2TargetChannelPayload
+    [DisplayName("OversamplingRatioPayload")]
+    [Description("Creates a message payload that sets the oversampling ratio of the ADC without changing the range. The conversion time plus the readout must fit in the sampling period.")]
+    public partial class CreateOversamplingRatioPayload
     {
         /// <summary>
-        /// Gets or sets the value that target ADC channel that will be used to trigger a threshold event on DO2 pin.
+        /// Gets or sets the value that sets the oversampling ratio of the ADC without changing the range. The conversion time plus the readout must fit in the sampling period.
         /// </summary>
-        [Description("The value that target ADC channel that will be used to trigger a threshold event on DO2 pin.")]
-        public AdcChannel DO2TargetChannel { get; set; }
+        [Description("The value that sets the oversampling ratio of the ADC without changing the range. The conversion time plus the readout must fit in the sampling period.")]
+        public OversamplingRatioConfig OversamplingRatio { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO2TargetChannel register.
+        /// Creates a message payload for the OversamplingRatio register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public AdcChannel GetPayload()
+        public OversamplingRatioConfig GetPayload()
         {
-            return DO2TargetChannel;
+            return OversamplingRatio;
         }
 
         /// <summary>
-        /// Creates a message that target ADC channel that will be used to trigger a threshold event on DO2 pin.
+        /// Creates a message that sets the oversampling ratio of the ADC without changing the range. The conversion time plus the readout must fit in the sampling period.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO2TargetChannel register.</returns>
+        /// <returns>A new message for the OversamplingRatio register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO2TargetChannel.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.OversamplingRatio.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target ADC channel that will be used to trigger a threshold event on DO2 pin.
+    /// that sets the oversampling ratio of the ADC without changing the range. The conversion time plus the readout must fit in the sampling period.
     /// </summary>
-    [DisplayName("TimestampedDO2TargetChannelPayload")]
-    [Description("Creates a timestamped message payload that target ADC channel that will be used to trigger a threshold event on DO2 pin.")]
-    public partial class CreateTimestampedDO2TargetChannelPayload : CreateDO2TargetChannelPayload
+    [DisplayName("TimestampedOversamplingRatioPayload")]
+    [Description("Creates a timestamped message payload that sets the oversampling ratio of the ADC without changing the range. The conversion time plus the readout must fit in the sampling period.")]
+    public partial class CreateTimestampedOversamplingRatioPayload : CreateOversamplingRatioPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target ADC channel that will be used to trigger a threshold event on DO2 pin.
+        /// Creates a timestamped message that sets the oversampling ratio of the ADC without changing the range. The conversion time plus the readout must fit in the sampling period.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO2TargetChannel register.</returns>
+        /// <returns>A new timestamped message for the OversamplingRatio register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO2TargetChannel.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.OversamplingRatio.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target ADC channel that will be used to trigger a threshold event on DO3 pin.
+    /// that sets the number of ADC reads combined on each AnalogData sample. One disables the decimation.
     /// </summary>
-    [DisplayName("DO3TargetChannelPayload")]
-    [Description("Creates a message payload that target ADC channel that will be used to trigger a threshold event on DO3 pin.")]
-    public partial class CreateDO3TargetChannelPayload
+    [DisplayName("DecimationFactorPayload")]
+    [Description("Creates a message payload that sets the number of ADC reads combined on each AnalogData sample. One disables the decimation.")]
+    public partial class CreateDecimationFactorPayload
     {
         /// <summary>
-        /// Gets or sets the value that target ADC channel that will be used to trigger a threshold event on DO3 pin.
+        /// Gets or sets the value that sets the number of ADC reads combined on each AnalogData sample. One disables the decimation.
         /// </summary>
-        [Description("The value that target ADC channel that will be used to trigger a threshold event on DO3 pin.")]
-        public AdcChannel DO3TargetChannel { get; set; }
+        [Range(min: 1, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the number of ADC reads combined on each AnalogData sample. One disables the decimation.")]
+        public byte DecimationFactor { get; set; } = 1;
 
         /// <summary>
-        /// Creates a message payload for the DO3TargetChannel register.
+        /// Creates a message payload for the DecimationFactor register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public AdcChannel GetPayload()
+        public byte GetPayload()
         {
-            return DO3TargetChannel;
+            return DecimationFactor;
         }
 
         /// <summary>
-        /// Creates a message that target ADC channel that will be used to trigger a threshold event on DO3 pin.
+        /// Creates a message that sets the number of ADC reads combined on each AnalogData sample. One disables the decimation.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO3TargetChannel register.</returns>
+        /// <returns>A new message for the DecimationFactor register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO3TargetChannel.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DecimationFactor.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target ADC channel that will be used to trigger a threshold event on DO3 pin.
+    /// that sets the number of ADC reads combined on each AnalogData sample. One disables the decimation.
     /// </summary>
-    [DisplayName("TimestampedDO3TargetChannelPayload")]
-    [Description("Creates a timestamped message payload that target ADC channel that will be used to trigger a threshold event on DO3 pin.")]
-    public partial class CreateTimestampedDO3TargetChannelPayload : CreateDO3TargetChannelPayload
+    [DisplayName("TimestampedDecimationFactorPayload")]
+    [Description("Creates a timestamped message payload that sets the number of ADC reads combined on each AnalogData sample. One disables the decimation.")]
+    public partial class CreateTimestampedDecimationFactorPayload : CreateDecimationFactorPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target ADC channel that will be used to trigger a threshold event on DO3 pin.
+        /// Creates a timestamped message that sets the number of ADC reads combined on each AnalogData sample. One disables the decimation.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO3TargetChannel register.</returns>
+        /// <returns>A new timestamped message for the DecimationFactor register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO3TargetChannel.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DecimationFactor.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value used to threshold an ADC read, and trigger DO0 pin.
+    /// that sets the filter used to decimate the ADC reads.
     /// </summary>
-    [DisplayName("DO0ThresholdPayload")]
-    [Description("Creates a message payload that value used to threshold an ADC read, and trigger DO0 pin.")]
-    public partial class CreateDO0ThresholdPayload
+    [DisplayName("DecimationFilterPayload")]
+    [Description("Creates a message payload that sets the filter used to decimate the ADC reads.")]
+    public partial class CreateDecimationFilterPayload
     {
         /// <summary>
-        /// Gets or sets the value that value used to threshold an ADC read, and trigger DO0 pin.
+        /// Gets or sets the value that sets the filter used to decimate the ADC reads.
         /// </summary>
-        [Description("The value that value used to threshold an ADC read, and trigger DO0 pin.")]
-        public short DO0Threshold { get; set; }
+        [Description("The value that sets the filter used to decimate the ADC reads.")]
+        public DecimationFilterConfig DecimationFilter { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0Threshold register.
+        /// Creates a message payload for the DecimationFilter register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public DecimationFilterConfig GetPayload()
         {
-            return DO0Threshold;
+            return DecimationFilter;
         }
 
         /// <summary>
-        /// Creates a message that value used to threshold an ADC read, and trigger DO0 pin.
+        /// Creates a message that sets the filter used to decimate the ADC reads.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0Threshold register.</returns>
+        /// <returns>A new message for the DecimationFilter register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO0Threshold.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DecimationFilter.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value used to threshold an ADC read, and trigger DO0 pin.
+    /// that sets the filter used to decimate the ADC reads.
     /// </summary>
-    [DisplayName("TimestampedDO0ThresholdPayload")]
-    [Description("Creates a timestamped message payload that value used to threshold an ADC read, and trigger DO0 pin.")]
-    public partial class CreateTimestampedDO0ThresholdPayload : CreateDO0ThresholdPayload
+    [DisplayName("TimestampedDecimationFilterPayload")]
+    [Description("Creates a timestamped message payload that sets the filter used to decimate the ADC reads.")]
+    public partial class CreateTimestampedDecimationFilterPayload : CreateDecimationFilterPayload
     {
         /// <summary>
-        /// Creates a timestamped message that value used to threshold an ADC read, and trigger DO0 pin.
+        /// Creates a timestamped message that sets the filter used to decimate the ADC reads.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0Threshold register.</returns>
+        /// <returns>A new timestamped message for the DecimationFilter register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO0Threshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DecimationFilter.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value used to threshold an ADC read, and trigger DO1 pin.
+    /// that sets whether the thresholds are evaluated on every ADC read or on the decimated samples.
     /// </summary>
-    [DisplayName("DO1ThresholdPayload")]
-    [Description("Creates a message payload that value used to threshold an ADC read, and trigger DO1 pin.")]
-    public partial class CreateDO1ThresholdPayload
+    [DisplayName("ThresholdSourcePayload")]
+    [Description("Creates a message payload that sets whether the thresholds are evaluated on every ADC read or on the decimated samples.")]
+    public partial class CreateThresholdSourcePayload
     {
         /// <summary>
-        /// Gets or sets the value that value used to threshold an ADC read, and trigger DO1 pin.
+        /// Gets or sets the value that sets whether the thresholds are evaluated on every ADC read or on the decimated samples.
         /// </summary>
-        [Description("The value that value used to threshold an ADC read, and trigger DO1 pin.")]
-        public short DO1Threshold { get; set; }
+        [Description("The value that sets whether the thresholds are evaluated on every ADC read or on the decimated samples.")]
+        public ThresholdSourceConfig ThresholdSource { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO1Threshold register.
+        /// Creates a message payload for the ThresholdSource register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public ThresholdSourceConfig GetPayload()
         {
-            return DO1Threshold;
+            return ThresholdSource;
         }
 
         /// <summary>
-        /// Creates a message that value used to threshold an ADC read, and trigger DO1 pin.
+        /// Creates a message that sets whether the thresholds are evaluated on every ADC read or on the decimated samples.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO1Threshold register.</returns>
+        /// <returns>A new message for the ThresholdSource register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO1Threshold.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.ThresholdSource.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value used to threshold an ADC read, and trigger DO1 pin.
+    /// that sets whether the thresholds are evaluated on every ADC read or on the decimated samples.
     /// </summary>
-    [DisplayName("TimestampedDO1ThresholdPayload")]
-    [Description("Creates a timestamped message payload that value used to threshold an ADC read, and trigger DO1 pin.")]
-    public partial class CreateTimestampedDO1ThresholdPayload : CreateDO1ThresholdPayload
+    [DisplayName("TimestampedThresholdSourcePayload")]
+    [Description("Creates a timestamped message payload that sets whether the thresholds are evaluated on every ADC read or on the decimated samples.")]
+    public partial class CreateTimestampedThresholdSourcePayload : CreateThresholdSourcePayload
     {
         /// <summary>
-        /// Creates a timestamped message that value used to threshold an ADC read, and trigger DO1 pin.
+        /// Creates a timestamped message that sets whether the thresholds are evaluated on every ADC read or on the decimated samples.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO1Threshold register.</returns>
+        /// <returns>A new timestamped message for the ThresholdSource register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO1Threshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.ThresholdSource.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value used to threshold an ADC read, and trigger DO2 pin.
+    /// that sets the ADC channels sent on the AnalogData events. At least one channel must be enabled.
     /// </summary>
-    [DisplayName("DO2ThresholdPayload")]
-    [Description("Creates a message payload that value used to threshold an ADC read, and trigger DO2 pin.")]
-    public partial class CreateDO2ThresholdPayload
+    [DisplayName("EnabledChannelsPayload")]
+    [Description("Creates a message payload that sets the ADC channels sent on the AnalogData events. At least one channel must be enabled.")]
+    public partial class CreateEnabledChannelsPayload
     {
         /// <summary>
-        /// Gets or sets the value that value used to threshold an ADC read, and trigger DO2 pin.
+        /// Gets or sets the value that sets the ADC channels sent on the AnalogData events. At least one channel must be enabled.
         /// </summary>
-        [Description("The value that value used to threshold an ADC read, and trigger DO2 pin.")]
-        public short DO2Threshold { get; set; }
+        [Description("The value that sets the ADC channels sent on the AnalogData events. At least one channel must be enabled.")]
+        public AnalogChannels EnabledChannels { get; set; } = AnalogChannels.Channel0 | AnalogChannels.Channel1 | AnalogChannels.Channel2 | AnalogChannels.Channel3;
 
         /// <summary>
-        /// Creates a message payload for the DO2Threshold register.
+        /// Creates a message payload for the EnabledChannels register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public AnalogChannels GetPayload()
         {
-            return DO2Threshold;
+            return EnabledChannels;
         }
 
         /// <summary>
-        /// Creates a message that value used to threshold an ADC read, and trigger DO2 pin.
+        /// Creates a message that sets the ADC channels sent on the AnalogData events. At least one channel must be enabled.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO2Threshold register.</returns>
+        /// <returns>A new message for the EnabledChannels register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO2Threshold.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.EnabledChannels.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value used to threshold an ADC read, and trigger DO2 pin.
+    /// that sets the ADC channels sent on the AnalogData events. At least one channel must be enabled.
     /// </summary>
-    [DisplayName("TimestampedDO2ThresholdPayload")]
-    [Description("Creates a timestamped message payload that value used to threshold an ADC read, and trigger DO2 pin.")]
-    public partial class CreateTimestampedDO2ThresholdPayload : CreateDO2ThresholdPayload
+    [DisplayName("TimestampedEnabledChannelsPayload")]
+    [Description("Creates a timestamped message payload that sets the ADC channels sent on the AnalogData events. At least one channel must be enabled.")]
+    public partial class CreateTimestampedEnabledChannelsPayload : CreateEnabledChannelsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that value used to threshold an ADC read, and trigger DO2 pin.
+        /// Creates a timestamped message that sets the ADC channels sent on the AnalogData events. At least one channel must be enabled.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO2Threshold register.</returns>
+        /// <returns>A new timestamped message for the EnabledChannels register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO2Threshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.EnabledChannels.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value used to threshold an ADC read, and trigger DO3 pin.
+    /// that sets whether each ADC result is read before the next conversion starts or while it runs. Pipelined mode needs an oversampling ratio of 8x or more and can only be changed while stopped.
     /// </summary>
-    [DisplayName("DO3ThresholdPayload")]
-    [Description("Creates a message payload that value used to threshold an ADC read, and trigger DO3 pin.")]
-    public partial class CreateDO3ThresholdPayload
+    [DisplayName("AcquisitionModePayload")]
+    [Description("Creates a message payload that sets whether each ADC result is read before the next conversion starts or while it runs. Pipelined mode needs an oversampling ratio of 8x or more and can only be changed while stopped.")]
+    public partial class CreateAcquisitionModePayload
     {
         /// <summary>
-        /// Gets or sets the value that value used to threshold an ADC read, and trigger DO3 pin.
+        /// Gets or sets the value that sets whether each ADC result is read before the next conversion starts or while it runs. Pipelined mode needs an oversampling ratio of 8x or more and can only be changed while stopped.
         /// </summary>
-        [Description("The value that value used to threshold an ADC read, and trigger DO3 pin.")]
-        public short DO3Threshold { get; set; }
+        [Description("The value that sets whether each ADC result is read before the next conversion starts or while it runs. Pipelined mode needs an oversampling ratio of 8x or more and can only be changed while stopped.")]
+        public AcquisitionModeConfig AcquisitionMode { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO3Threshold register.
+        /// Creates a message payload for the AcquisitionMode register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public AcquisitionModeConfig GetPayload()
         {
-            return DO3Threshold;
+            return AcquisitionMode;
         }
 
         /// <summary>
-        /// Creates a message that value used to threshold an ADC read, and trigger DO3 pin.
+        /// Creates a message that sets whether each ADC result is read before the next conversion starts or while it runs. Pipelined mode needs an oversampling ratio of 8x or more and can only be changed while stopped.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO3Threshold register.</returns>
+        /// <returns>A new message for the AcquisitionMode register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO3Threshold.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.AcquisitionMode.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value used to threshold an ADC read, and trigger DO3 pin.
+    /// that sets whether each ADC result is read before the next conversion starts or while it runs. Pipelined mode needs an oversampling ratio of 8x or more and can only be changed while stopped.
     /// </summary>
-    [DisplayName("TimestampedDO3ThresholdPayload")]
-    [Description("Creates a timestamped message payload that value used to threshold an ADC read, and trigger DO3 pin.")]
-    public partial class CreateTimestampedDO3ThresholdPayload : CreateDO3ThresholdPayload
+    [DisplayName("TimestampedAcquisitionModePayload")]
+    [Description("Creates a timestamped message payload that sets whether each ADC result is read before the next conversion starts or while it runs. Pipelined mode needs an oversampling ratio of 8x or more and can only be changed while stopped.")]
+    public partial class CreateTimestampedAcquisitionModePayload : CreateAcquisitionModePayload
     {
         /// <summary>
-        /// Creates a timestamped message that value used to threshold an ADC read, and trigger DO3 pin.
+        /// Creates a timestamped message that sets whether each ADC result is read before the next conversion starts or while it runs. Pipelined mode needs an oversampling ratio of 8x or more and can only be changed while stopped.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO3Threshold register.</returns>
+        /// <returns>A new timestamped message for the AcquisitionMode register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO3Threshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.AcquisitionMode.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time (ms) above threshold value that is required to trigger a DO0 pin event.
+    /// that sets the trigger of the capture windows. While capturing, only the samples of each window are sent on AnalogData, and an event is sent when a window is triggered. Can only be changed while stopped.
     /// </summary>
-    [DisplayName("DO0TimeAboveThresholdPayload")]
-    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO0 pin event.")]
-    public partial class CreateDO0TimeAboveThresholdPayload
+    [DisplayName("CaptureTriggerPayload")]
+    [Description("Creates a message payload that sets the trigger of the capture windows. While capturing, only the samples of each window are sent on AnalogData, and an event is sent when a window is triggered. Can only be changed while stopped.")]
+    public partial class CreateCaptureTriggerPayload
     {
         /// <summary>
-        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO0 pin event.
+        /// Gets or sets the value that sets the trigger of the capture windows. While capturing, only the samples of each window are sent on AnalogData, and an event is sent when a window is triggered. Can only be changed while stopped.
         /// </summary>
-        [Description("The value that time (ms) above threshold value that is required to trigger a DO0 pin event.")]
-        public ushort DO0TimeAboveThreshold { get; set; } = 0;
+        [Description("The value that sets the trigger of the capture windows. While capturing, only the samples of each window are sent on AnalogData, and an event is sent when a window is triggered. Can only be changed while stopped.")]
+        public CaptureTriggerConfig CaptureTrigger { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0TimeAboveThreshold register.
+        /// Creates a message payload for the CaptureTrigger register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public CaptureTriggerConfig GetPayload()
         {
-            return DO0TimeAboveThreshold;
+            return CaptureTrigger;
         }
 
         /// <summary>
-        /// Creates a message that time (ms) above threshold value that is required to trigger a DO0 pin event.
+        /// Creates a message that sets the trigger of the capture windows. While capturing, only the samples of each window are sent on AnalogData, and an event is sent when a window is triggered. Can only be changed while stopped.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0TimeAboveThreshold register.</returns>
+        /// <returns>A new message for the CaptureTrigger register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO0TimeAboveThreshold.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.CaptureTrigger.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) above threshold value that is required to trigger a DO0 pin event.
+    /// that sets the trigger of the capture windows. While capturing, only the samples of each window are sent on AnalogData, and an event is sent when a window is triggered. Can only be changed while stopped.
     /// </summary>
-    [DisplayName("TimestampedDO0TimeAboveThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO0 pin event.")]
-    public partial class CreateTimestampedDO0TimeAboveThresholdPayload : CreateDO0TimeAboveThresholdPayload
+    [DisplayName("TimestampedCaptureTriggerPayload")]
+    [Description("Creates a timestamped message payload that sets the trigger of the capture windows. While capturing, only the samples of each window are sent on AnalogData, and an event is sent when a window is triggered. Can only be changed while stopped.")]
+    public partial class CreateTimestampedCaptureTriggerPayload : CreateCaptureTriggerPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO0 pin event.
+        /// Creates a timestamped message that sets the trigger of the capture windows. While capturing, only the samples of each window are sent on AnalogData, and an event is sent when a window is triggered. Can only be changed while stopped.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0TimeAboveThreshold register.</returns>
+        /// <returns>A new timestamped message for the CaptureTrigger register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO0TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.CaptureTrigger.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time (ms) above threshold value that is required to trigger a DO1 pin event.
+    /// that sets the number of samples from before the trigger sent on each capture window. Can only be changed while stopped.
     /// </summary>
-    [DisplayName("DO1TimeAboveThresholdPayload")]
-    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO1 pin event.")]
-    public partial class CreateDO1TimeAboveThresholdPayload
+    [DisplayName("CapturePreSamplesPayload")]
+    [Description("Creates a message payload that sets the number of samples from before the trigger sent on each capture window. Can only be changed while stopped.")]
+    public partial class CreateCapturePreSamplesPayload
     {
         /// <summary>
-        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO1 pin event.
+        /// Gets or sets the value that sets the number of samples from before the trigger sent on each capture window. Can only be changed while stopped.
         /// </summary>
-        [Description("The value that time (ms) above threshold value that is required to trigger a DO1 pin event.")]
-        public ushort DO1TimeAboveThreshold { get; set; } = 0;
+        [Range(min: byte.MinValue, max: 128)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the number of samples from before the trigger sent on each capture window. Can only be changed while stopped.")]
+        public byte CapturePreSamples { get; set; } = 64;
 
         /// <summary>
-        /// Creates a message payload for the DO1TimeAboveThreshold register.
+        /// Creates a message payload for the CapturePreSamples register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public byte GetPayload()
         {
-            return DO1TimeAboveThreshold;
+            return CapturePreSamples;
         }
 
         /// <summary>
-        /// Creates a message that time (ms) above threshold value that is required to trigger a DO1 pin event.
+        /// Creates a message that sets the number of samples from before the trigger sent on each capture window. Can only be changed while stopped.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO1TimeAboveThreshold register.</returns>
+        /// <returns>A new message for the CapturePreSamples register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO1TimeAboveThreshold.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.CapturePreSamples.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) above threshold value that is required to trigger a DO1 pin event.
+    /// that sets the number of samples from before the trigger sent on each capture window. Can only be changed while stopped.
     /// </summary>
-    [DisplayName("TimestampedDO1TimeAboveThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO1 pin event.")]
-    public partial class CreateTimestampedDO1TimeAboveThresholdPayload : CreateDO1TimeAboveThresholdPayload
+    [DisplayName("TimestampedCapturePreSamplesPayload")]
+    [Description("Creates a timestamped message payload that sets the number of samples from before the trigger sent on each capture window. Can only be changed while stopped.")]
+    public partial class CreateTimestampedCapturePreSamplesPayload : CreateCapturePreSamplesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO1 pin event.
+        /// Creates a timestamped message that sets the number of samples from before the trigger sent on each capture window. Can only be changed while stopped.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO1TimeAboveThreshold register.</returns>
+        /// <returns>A new timestamped message for the CapturePreSamples register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO1TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.CapturePreSamples.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time (ms) above threshold value that is required to trigger a DO2 pin event.
+    /// that sets the number of samples from after the trigger sent on each capture window. Can only be changed while stopped.
     /// </summary>
-    [DisplayName("DO2TimeAboveThresholdPayload")]
-    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO2 pin event.")]
-    public partial class CreateDO2TimeAboveThresholdPayload
+    [DisplayName("CapturePostSamplesPayload")]
+    [Description("Creates a message payload that sets the number of samples from after the trigger sent on each capture window. Can only be changed while stopped.")]
+    public partial class CreateCapturePostSamplesPayload
     {
         /// <summary>
-        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO2 pin event.
+        /// Gets or sets the value that sets the number of samples from after the trigger sent on each capture window. Can only be changed while stopped.
         /// </summary>
-        [Description("The value that time (ms) above threshold value that is required to trigger a DO2 pin event.")]
-        public ushort DO2TimeAboveThreshold { get; set; } = 0;
+        [Description("The value that sets the number of samples from after the trigger sent on each capture window. Can only be changed while stopped.")]
+        public ushort CapturePostSamples { get; set; } = 64;
 
         /// <summary>
-        /// Creates a message payload for the DO2TimeAboveThreshold register.
+        /// Creates a message payload for the CapturePostSamples register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public ushort GetPayload()
         {
-            return DO2TimeAboveThreshold;
+            return CapturePostSamples;
         }
 
         /// <summary>
-        /// Creates a message that time (ms) above threshold value that is required to trigger a DO2 pin event.
+        /// Creates a message that sets the number of samples from after the trigger sent on each capture window. Can only be changed while stopped.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO2TimeAboveThreshold register.</returns>
+        /// <returns>A new message for the CapturePostSamples register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO2TimeAboveThreshold.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.CapturePostSamples.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) above threshold value that is required to trigger a DO2 pin event.
+    /// that sets the number of samples from after the trigger sent on each capture window. Can only be changed while stopped.
     /// </summary>
-    [DisplayName("TimestampedDO2TimeAboveThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO2 pin event.")]
-    public partial class CreateTimestampedDO2TimeAboveThresholdPayload : CreateDO2TimeAboveThresholdPayload
+    [DisplayName("TimestampedCapturePostSamplesPayload")]
+    [Description("Creates a timestamped message payload that sets the number of samples from after the trigger sent on each capture window. Can only be changed while stopped.")]
+    public partial class CreateTimestampedCapturePostSamplesPayload : CreateCapturePostSamplesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO2 pin event.
+        /// Creates a timestamped message that sets the number of samples from after the trigger sent on each capture window. Can only be changed while stopped.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO2TimeAboveThreshold register.</returns>
+        /// <returns>A new timestamped message for the CapturePostSamples register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO2TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.CapturePostSamples.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time (ms) above threshold value that is required to trigger a DO3 pin event.
+    /// that sets the number of samples acquired on each burst when SamplingRate is set to SamplingRateBurst. BurstSamples times the number of enabled channels must not exceed 896.
     /// </summary>
-    [DisplayName("DO3TimeAboveThresholdPayload")]
-    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO3 pin event.")]
-    public partial class CreateDO3TimeAboveThresholdPayload
+    [DisplayName("BurstSamplesPayload")]
+    [Description("Creates a message payload that sets the number of samples acquired on each burst when SamplingRate is set to SamplingRateBurst. BurstSamples times the number of enabled channels must not exceed 896.")]
+    public partial class CreateBurstSamplesPayload
     {
         /// <summary>
-        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO3 pin event.
+        /// Gets or sets the value that sets the number of samples acquired on each burst when SamplingRate is set to SamplingRateBurst. BurstSamples times the number of enabled channels must not exceed 896.
         /// </summary>
-        [Description("The value that time (ms) above threshold value that is required to trigger a DO3 pin event.")]
-        public ushort DO3TimeAboveThreshold { get; set; } = 0;
+        [Range(min: 1, max: 896)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the number of samples acquired on each burst when SamplingRate is set to SamplingRateBurst. BurstSamples times the number of enabled channels must not exceed 896.")]
+        public ushort BurstSamples { get; set; } = 224;
 
         /// <summary>
-        /// Creates a message payload for the DO3TimeAboveThreshold register.
+        /// Creates a message payload for the BurstSamples register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public ushort GetPayload()
         {
-            return DO3TimeAboveThreshold;
+            return BurstSamples;
         }
 
         /// <summary>
-        /// Creates a message that time (ms) above threshold value that is required to trigger a DO3 pin event.
+        /// Creates a message that sets the number of samples acquired on each burst when SamplingRate is set to SamplingRateBurst. BurstSamples times the number of enabled channels must not exceed 896.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO3TimeAboveThreshold register.</returns>
+        /// <returns>A new message for the BurstSamples register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO3TimeAboveThreshold.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.BurstSamples.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) above threshold value that is required to trigger a DO3 pin event.
+    /// that sets the number of samples acquired on each burst when SamplingRate is set to SamplingRateBurst. BurstSamples times the number of enabled channels must not exceed 896.
     /// </summary>
-    [DisplayName("TimestampedDO3TimeAboveThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO3 pin event.")]
-    public partial class CreateTimestampedDO3TimeAboveThresholdPayload : CreateDO3TimeAboveThresholdPayload
+    [DisplayName("TimestampedBurstSamplesPayload")]
+    [Description("Creates a timestamped message payload that sets the number of samples acquired on each burst when SamplingRate is set to SamplingRateBurst. BurstSamples times the number of enabled channels must not exceed 896.")]
+    public partial class CreateTimestampedBurstSamplesPayload : CreateBurstSamplesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO3 pin event.
+        /// Creates a timestamped message that sets the number of samples acquired on each burst when SamplingRate is set to SamplingRateBurst. BurstSamples times the number of enabled channels must not exceed 896.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO3TimeAboveThreshold register.</returns>
+        /// <returns>A new timestamped message for the BurstSamples register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO3TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.BurstSamples.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time (ms) below threshold value that is required to trigger a DO0 pin event.
+    /// that sets the trigger of the bursts. With Immediate, a new burst starts as soon as the previous one is sent.
     /// </summary>
-    [DisplayName("DO0TimeBelowThresholdPayload")]
-    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO0 pin event.")]
-    public partial class CreateDO0TimeBelowThresholdPayload
+    [DisplayName("BurstTriggerPayload")]
+    [Description("Creates a message payload that sets the trigger of the bursts. With Immediate, a new burst starts as soon as the previous one is sent.")]
+    public partial class CreateBurstTriggerPayload
     {
         /// <summary>
-        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO0 pin event.
+        /// Gets or sets the value that sets the trigger of the bursts. With Immediate, a new burst starts as soon as the previous one is sent.
         /// </summary>
-        [Description("The value that time (ms) below threshold value that is required to trigger a DO0 pin event.")]
-        public ushort DO0TimeBelowThreshold { get; set; } = 0;
+        [Description("The value that sets the trigger of the bursts. With Immediate, a new burst starts as soon as the previous one is sent.")]
+        public BurstTriggerConfig BurstTrigger { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0TimeBelowThreshold register.
+        /// Creates a message payload for the BurstTrigger register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public BurstTriggerConfig GetPayload()
         {
-            return DO0TimeBelowThreshold;
+            return BurstTrigger;
         }
 
         /// <summary>
-        /// Creates a message that time (ms) below threshold value that is required to trigger a DO0 pin event.
+        /// Creates a message that sets the trigger of the bursts. With Immediate, a new burst starts as soon as the previous one is sent.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0TimeBelowThreshold register.</returns>
+        /// <returns>A new message for the BurstTrigger register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO0TimeBelowThreshold.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.BurstTrigger.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) below threshold value that is required to trigger a DO0 pin event.
+    /// that sets the trigger of the bursts. With Immediate, a new burst starts as soon as the previous one is sent.
     /// </summary>
-    [DisplayName("TimestampedDO0TimeBelowThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO0 pin event.")]
-    public partial class CreateTimestampedDO0TimeBelowThresholdPayload : CreateDO0TimeBelowThresholdPayload
+    [DisplayName("TimestampedBurstTriggerPayload")]
+    [Description("Creates a timestamped message payload that sets the trigger of the bursts. With Immediate, a new burst starts as soon as the previous one is sent.")]
+    public partial class CreateTimestampedBurstTriggerPayload : CreateBurstTriggerPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO0 pin event.
+        /// Creates a timestamped message that sets the trigger of the bursts. With Immediate, a new burst starts as soon as the previous one is sent.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0TimeBelowThreshold register.</returns>
+        /// <returns>A new timestamped message for the BurstTrigger register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO0TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.BurstTrigger.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time (ms) below threshold value that is required to trigger a DO1 pin event.
+    /// that reports the mean time between the conversions of the last burst (units of 250 ns). Sent before the AnalogData events of each burst, with the timestamp of its first sample.
     /// </summary>
-    [DisplayName("DO1TimeBelowThresholdPayload")]
-    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO1 pin event.")]
-    public partial class CreateDO1TimeBelowThresholdPayload
+    [DisplayName("BurstIntervalPayload")]
+    [Description("Creates a message payload that reports the mean time between the conversions of the last burst (units of 250 ns). Sent before the AnalogData events of each burst, with the timestamp of its first sample.")]
+    public partial class CreateBurstIntervalPayload
     {
         /// <summary>
-        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO1 pin event.
+        /// Gets or sets the value that reports the mean time between the conversions of the last burst (units of 250 ns). Sent before the AnalogData events of each burst, with the timestamp of its first sample.
         /// </summary>
-        [Description("The value that time (ms) below threshold value that is required to trigger a DO1 pin event.")]
-        public ushort DO1TimeBelowThreshold { get; set; } = 0;
+        [Description("The value that reports the mean time between the conversions of the last burst (units of 250 ns). Sent before the AnalogData events of each burst, with the timestamp of its first sample.")]
+        public ushort BurstInterval { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO1TimeBelowThreshold register.
+        /// Creates a message payload for the BurstInterval register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public ushort GetPayload()
         {
-            return DO1TimeBelowThreshold;
+            return BurstInterval;
         }
 
         /// <summary>
-        /// Creates a message that time (ms) below threshold value that is required to trigger a DO1 pin event.
+        /// Creates a message that reports the mean time between the conversions of the last burst (units of 250 ns). Sent before the AnalogData events of each burst, with the timestamp of its first sample.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO1TimeBelowThreshold register.</returns>
+        /// <returns>A new message for the BurstInterval register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO1TimeBelowThreshold.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.BurstInterval.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) below threshold value that is required to trigger a DO1 pin event.
+    /// that reports the mean time between the conversions of the last burst (units of 250 ns). Sent before the AnalogData events of each burst, with the timestamp of its first sample.
     /// </summary>
-    [DisplayName("TimestampedDO1TimeBelowThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO1 pin event.")]
-    public partial class CreateTimestampedDO1TimeBelowThresholdPayload : CreateDO1TimeBelowThresholdPayload
+    [DisplayName("TimestampedBurstIntervalPayload")]
+    [Description("Creates a timestamped message payload that reports the mean time between the conversions of the last burst (units of 250 ns). Sent before the AnalogData events of each burst, with the timestamp of its first sample.")]
+    public partial class CreateTimestampedBurstIntervalPayload : CreateBurstIntervalPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO1 pin event.
+        /// Creates a timestamped message that reports the mean time between the conversions of the last burst (units of 250 ns). Sent before the AnalogData events of each burst, with the timestamp of its first sample.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO1TimeBelowThreshold register.</returns>
+        /// <returns>A new timestamped message for the BurstInterval register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO1TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.BurstInterval.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time (ms) below threshold value that is required to trigger a DO2 pin event.
+    /// that sets the encoding of the ADC reads. With Delta, the AnalogData events are replaced by AnalogDataDelta events. Bursts are always sent on AnalogData.
     /// </summary>
-    [DisplayName("DO2TimeBelowThresholdPayload")]
-    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO2 pin event.")]
-    public partial class CreateDO2TimeBelowThresholdPayload
+    [DisplayName("DataEncodingPayload")]
+    [Description("Creates a message payload that sets the encoding of the ADC reads. With Delta, the AnalogData events are replaced by AnalogDataDelta events. Bursts are always sent on AnalogData.")]
+    public partial class CreateDataEncodingPayload
     {
         /// <summary>
-        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO2 pin event.
+        /// Gets or sets the value that sets the encoding of the ADC reads. With Delta, the AnalogData events are replaced by AnalogDataDelta events. Bursts are always sent on AnalogData.
         /// </summary>
-        [Description("The value that time (ms) below threshold value that is required to trigger a DO2 pin event.")]
-        public ushort DO2TimeBelowThreshold { get; set; } = 0;
+        [Description("The value that sets the encoding of the ADC reads. With Delta, the AnalogData events are replaced by AnalogDataDelta events. Bursts are always sent on AnalogData.")]
+        public DataEncodingConfig DataEncoding { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO2TimeBelowThreshold register.
+        /// Creates a message payload for the DataEncoding register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public DataEncodingConfig GetPayload()
         {
-            return DO2TimeBelowThreshold;
+            return DataEncoding;
         }
 
         /// <summary>
-        /// Creates a message that time (ms) below threshold value that is required to trigger a DO2 pin event.
+        /// Creates a message that sets the encoding of the ADC reads. With Delta, the AnalogData events are replaced by AnalogDataDelta events. Bursts are always sent on AnalogData.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO2TimeBelowThreshold register.</returns>
+        /// <returns>A new message for the DataEncoding register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO2TimeBelowThreshold.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.DataEncoding.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) below threshold value that is required to trigger a DO2 pin event.
+    /// that sets the encoding of the ADC reads. With Delta, the AnalogData events are replaced by AnalogDataDelta events. Bursts are always sent on AnalogData.
     /// </summary>
-    [DisplayName("TimestampedDO2TimeBelowThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO2 pin event.")]
-    public partial class CreateTimestampedDO2TimeBelowThresholdPayload : CreateDO2TimeBelowThresholdPayload
+    [DisplayName("TimestampedDataEncodingPayload")]
+    [Description("Creates a timestamped message payload that sets the encoding of the ADC reads. With Delta, the AnalogData events are replaced by AnalogDataDelta events. Bursts are always sent on AnalogData.")]
+    public partial class CreateTimestampedDataEncodingPayload : CreateDataEncodingPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO2 pin event.
+        /// Creates a timestamped message that sets the encoding of the ADC reads. With Delta, the AnalogData events are replaced by AnalogDataDelta events. Bursts are always sent on AnalogData.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO2TimeBelowThreshold register.</returns>
+        /// <returns>A new timestamped message for the DataEncoding register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO2TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.DataEncoding.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time (ms) below threshold value that is required to trigger a DO3 pin event.
+    /// that reports the delta encoded ADC reads when DataEncoding is set to Delta. The payload has the enabled channels, the values of the first read, and then one byte per value with the zig-zag encoded difference to the previous value of its channel, or 0xFF followed by the value. Each event carries up to BatchSize reads and is timestamped with the first one.
     /// </summary>
-    [DisplayName("DO3TimeBelowThresholdPayload")]
-    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO3 pin event.")]
-    public partial class CreateDO3TimeBelowThresholdPayload
+    [DisplayName("AnalogDataDeltaPayload")]
+    [Description("Creates a message payload that reports the delta encoded ADC reads when DataEncoding is set to Delta. The payload has the enabled channels, the values of the first read, and then one byte per value with the zig-zag encoded difference to the previous value of its channel, or 0xFF followed by the value. Each event carries up to BatchSize reads and is timestamped with the first one.")]
+    public partial class CreateAnalogDataDeltaPayload
     {
         /// <summary>
-        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO3 pin event.
+        /// Gets or sets the value that reports the delta encoded ADC reads when DataEncoding is set to Delta. The payload has the enabled channels, the values of the first read, and then one byte per value with the zig-zag encoded difference to the previous value of its channel, or 0xFF followed by the value. Each event carries up to BatchSize reads and is timestamped with the first one.
         /// </summary>
-        [Description("The value that time (ms) below threshold value that is required to trigger a DO3 pin event.")]
-        public ushort DO3TimeBelowThreshold { get; set; } = 0;
+        [Description("The value that reports the delta encoded ADC reads when DataEncoding is set to Delta. The payload has the enabled channels, the values of the first read, and then one byte per value with the zig-zag encoded difference to the previous value of its channel, or 0xFF followed by the value. Each event carries up to BatchSize reads and is timestamped with the first one.")]
+        public byte[] AnalogDataDelta { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO3TimeBelowThreshold register.
+        /// Creates a message payload for the AnalogDataDelta register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public byte[] GetPayload()
         {
-            return DO3TimeBelowThreshold;
+            return AnalogDataDelta;
         }
 
         /// <summary>
-        /// Creates a message that time (ms) below threshold value that is required to trigger a DO3 pin event.
+        /// Creates a message that reports the delta encoded ADC reads when DataEncoding is set to Delta. The payload has the enabled channels, the values of the first read, and then one byte per value with the zig-zag encoded difference to the previous value of its channel, or 0xFF followed by the value. Each event carries up to BatchSize reads and is timestamped with the first one.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO3TimeBelowThreshold register.</returns>
+        /// <returns>A new message for the AnalogDataDelta register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AnalogInput.DO3TimeBelowThreshold.FromPayload(messageType, GetPayload());
+            return Harp.AnalogInput.AnalogDataDelta.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) below threshold value that is required to trigger a DO3 pin event.
+    /// that reports the delta encoded ADC reads when DataEncoding is set to Delta. The payload has the enabled channels, the values of the first read, and then one byte per value with the zig-zag encoded difference to the previous value of its channel, or 0xFF followed by the value. Each event carries up to BatchSize reads and is timestamped with the first one.
     /// </summary>
-    [DisplayName("TimestampedDO3TimeBelowThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO3 pin event.")]
-    public partial class CreateTimestampedDO3TimeBelowThresholdPayload : CreateDO3TimeBelowThresholdPayload
+    [DisplayName("TimestampedAnalogDataDeltaPayload")]
+    [Description("Creates a timestamped message payload that reports the delta encoded ADC reads when DataEncoding is set to Delta. The payload has the enabled channels, the values of the first read, and then one byte per value with the zig-zag encoded difference to the previous value of its channel, or 0xFF followed by the value. Each event carries up to BatchSize reads and is timestamped with the first one.")]
+    public partial class CreateTimestampedAnalogDataDeltaPayload : CreateAnalogDataDeltaPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO3 pin event.
+        /// Creates a timestamped message that reports the delta encoded ADC reads when DataEncoding is set to Delta. The payload has the enabled channels, the values of the first read, and then one byte per value with the zig-zag encoded difference to the previous value of its channel, or 0xFF followed by the value. Each event carries up to BatchSize reads and is timestamped with the first one.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO3TimeBelowThreshold register.</returns>
+        /// <returns>A new timestamped message for the AnalogDataDelta register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AnalogInput.DO3TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AnalogInput.AnalogDataDelta.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
@@ -5682,6 +9289,19 @@ namespace Harp.AnalogInput
         DO4Changed = 0x80
     }
 
+    /// <summary>
+    /// Specifies the ADC channels.
+    /// </summary>
+    [Flags]
+    public enum AnalogChannels : byte
+    {
+        None = 0x0,
+        Channel0 = 0x1,
+        Channel1 = 0x2,
+        Channel2 = 0x4,
+        Channel3 = 0x8
+    }
+
     /// <summary>
     /// Available settings to set the range (Volt) and LowPass filter cutoff (Hz) of the ADC.
     /// </summary>
@@ -5707,7 +9327,80 @@ namespace Harp.AnalogInput
     public enum SamplingRateMode : byte
     {
         SamplingRate1000Hz = 0,
-        SamplingRate2000Hz = 1
+        SamplingRate2000Hz = 1,
+        SamplingRateCustom = 2,
+        SamplingRateBurst = 3
+    }
+
+    /// <summary>
+    /// Available oversampling ratios of the ADC.
+    /// </summary>
+    public enum OversamplingRatioConfig : byte
+    {
+        Oversampling1x = 0,
+        Oversampling2x = 1,
+        Oversampling4x = 2,
+        Oversampling8x = 3,
+        Oversampling16x = 4,
+        Oversampling32x = 5,
+        Oversampling64x = 6
+    }
+
+    /// <summary>
+    /// Available filters to decimate the ADC reads.
+    /// </summary>
+    public enum DecimationFilterConfig : byte
+    {
+        Boxcar = 0,
+        Cic2 = 1
+    }
+
+    /// <summary>
+    /// Available sources for the threshold events.
+    /// </summary>
+    public enum ThresholdSourceConfig : byte
+    {
+        AdcReads = 0,
+        DecimatedSamples = 1
+    }
+
+    /// <summary>
+    /// Available ways of overlapping the ADC conversions and readouts.
+    /// </summary>
+    public enum AcquisitionModeConfig : byte
+    {
+        Serialized = 0,
+        Pipelined = 1
+    }
+
+    /// <summary>
+    /// Available triggers of the capture windows.
+    /// </summary>
+    public enum CaptureTriggerConfig : byte
+    {
+        None = 0,
+        DI0RisingEdge = 1,
+        DI0FallingEdge = 2,
+        Threshold = 3
+    }
+
+    /// <summary>
+    /// Available triggers of the bursts.
+    /// </summary>
+    public enum BurstTriggerConfig : byte
+    {
+        Immediate = 0,
+        DI0RisingEdge = 1,
+        DI0FallingEdge = 2
+    }
+
+    /// <summary>
+    /// Available encodings of the ADC reads.
+    /// </summary>
+    public enum DataEncodingConfig : byte
+    {
+        Raw = 0,
+        Delta = 1
     }
 
     /// <summary>